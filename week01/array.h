@@ -9,7 +9,7 @@
  *      | |   | |    | | | |    | |   / / _
  *     _| |_  |  `--'  | |  `--'  |  / / (_)
  *    |_____|  '.____.'   '.____.'  /_/
- *    
+ *
  *    This will contain the class definition of:
  *       array             : similar to std::array
  *       array :: iterator : an iterator through the array
@@ -19,7 +19,9 @@
 
 #pragma once
 
+#include <cstddef>     // for size_t
 #include <stdexcept>
+#include <utility>     // for std::move
 
 class TestArray;
 
@@ -28,11 +30,17 @@ namespace custom
 
 /************************************************
  * ARRAY
- * A class that holds stuff
+ * A class that holds stuff. Align can raise the alignment
+ * of the elements to 32 or 64 bytes so a loop over them
+ * can use aligned vector loads.
  ***********************************************/
-template <int N>
+template <class T, size_t N, size_t Align = alignof(T)>
 struct array
 {
+   static_assert(N > 0, "an array needs at least one element");
+   static_assert(Align >= alignof(T), "Align cannot be weaker than the element's own");
+   static_assert((Align & (Align - 1)) == 0, "Align must be a power of two");
+
 public:
    //
    // Construct
@@ -46,6 +54,21 @@ public:
 
    // No assignment operators needed here
 
+   constexpr void fill(const T & t)
+   {
+      for (size_t i = 0; i < N; i++)
+         __elems_[i] = t;
+   }
+   constexpr void swap(array & rhs)
+   {
+      for (size_t i = 0; i < N; i++)
+      {
+         T temp = std::move(__elems_[i]);
+         __elems_[i] = std::move(rhs.__elems_[i]);
+         rhs.__elems_[i] = std::move(temp);
+      }
+   }
+
    //
    // Iterator
    //
@@ -54,41 +77,41 @@ public:
    class iterator;
 
    // Begin and end methods
-   iterator begin() 
-   { 
-      return iterator(&front()); 
+   constexpr iterator begin()
+   {
+      return iterator(__elems_);
    }
-   iterator end()   
-   { 
-      return iterator(&back() + 1); 
+   constexpr iterator end()
+   {
+      return iterator(__elems_ + N);
    }
 
-   // 
+   //
    // Access
    //
 
    // Subscript
-   int& operator [] (size_t index)       
-   { 
-      return __elems_[index]; 
+   constexpr T& operator [] (size_t index)
+   {
+      return __elems_[index];
    }
-   const int& operator [] (size_t index) const 
-   { 
-      return __elems_[index]; 
+   constexpr const T& operator [] (size_t index) const
+   {
+      return __elems_[index];
    }
 
    // At
-   int& at(size_t index)
+   constexpr T& at(size_t index)
    {
-      if (index < 0 || index >= size())
+      if (index >= size())
       {
          throw std::out_of_range("ARRAY: index out of range");
       }
       return __elems_[index];
    }
-   const int& at(size_t index) const
+   constexpr const T& at(size_t index) const
    {
-      if (index < 0 || index >= size())
+      if (index >= size())
       {
          throw std::out_of_range("ARRAY: index out of range");
       }
@@ -96,23 +119,27 @@ public:
    }
 
    // Front and Back
-   int& front()       
-   { 
-      return at(0);
+   constexpr T& front()
+   {
+      return __elems_[0];
    }
-   int& back()        
+   constexpr T& back()
    {
-      return at(size() - 1);
+      return __elems_[N - 1];
    }
-   const int& front() const 
+   constexpr const T& front() const
    {
-      return at(0);
+      return __elems_[0];
    }
-   const int& back()  const 
+   constexpr const T& back()  const
    {
-      return at(size() - 1);
+      return __elems_[N - 1];
    }
 
+   // the contiguous buffer, for bulk loops
+   constexpr       T* data()       { return __elems_; }
+   constexpr const T* data() const { return __elems_; }
+
    //
    // Remove
 
@@ -123,24 +150,21 @@ public:
    //
 
    // number of elements in the array
-   size_t size()  const 
-   { 
-      size_t size;
-      size = N;
-
-      return size;           
+   constexpr size_t size()  const
+   {
+      return N;
    }
-   bool empty() const 
-   { 
-      return size() == size_t(0); 
+   constexpr bool empty() const
+   {
+      return size() == size_t(0);
    }
-   
+
    //
    // Member Variable
    //
 
    // statically allocated array of T
-   int __elems_[N];
+   alignas(Align) T __elems_[N];
 };
 
 
@@ -148,69 +172,74 @@ public:
  * ARRAY ITERATOR
  * An iterator through array
  *************************************************/
-template <int N>
-class array <N> :: iterator
+template <class T, size_t N, size_t Align>
+class array <T, N, Align> :: iterator
 {
    friend class ::TestArray;
 public:
    // constructors, destructors, and assignment operator
-   iterator()     
-   { 
-      p = nullptr;
+   constexpr iterator() : p(nullptr)
+   {
    }
-   iterator(int * p)   
-   { 
-      this->p = p;
+   constexpr iterator(T * p) : p(p)
+   {
    }
-   iterator(const iterator & rhs) 
-   {  
-      this->p = rhs.p;
+   constexpr iterator(const iterator & rhs) : p(rhs.p)
+   {
    }
-   iterator & operator = (const iterator & rhs)
+   constexpr iterator & operator = (const iterator & rhs)
    {
       this->p = rhs.p;
       return *this;
    }
-   
+
    // equals, not equals operator
-   bool operator != (const iterator & rhs) const 
-   { 
-      return this->p != rhs.p; 
+   constexpr bool operator != (const iterator & rhs) const
+   {
+      return this->p != rhs.p;
    }
-   bool operator == (const iterator & rhs) const 
-   { 
+   constexpr bool operator == (const iterator & rhs) const
+   {
       return this->p == rhs.p;
    }
-   
+
    // dereference operator
-   int & operator * ()       
-   { 
-      return *p; 
+   constexpr T & operator * ()
+   {
+      return *p;
    }
-   const int & operator * () const 
-   { 
-      return *p; 
+   constexpr const T & operator * () const
+   {
+      return *p;
    }
-   
+
    // prefix increment
-   iterator & operator ++ ()
+   constexpr iterator & operator ++ ()
    {
       p ++;
       return *this;
    }
-   
+
    // postfix increment
-   iterator operator ++ (int postfix)
+   constexpr iterator operator ++ (int postfix)
    {
       iterator copy = *this;
       p++;
       return copy;
    }
-   
+
 private:
-   int * p;
+   T * p;
 };
 
-
+/************************************************
+ * SWAP
+ * Swap the contents of two arrays
+ ***********************************************/
+template <class T, size_t N, size_t Align>
+constexpr void swap(array <T, N, Align> & lhs, array <T, N, Align> & rhs)
+{
+   lhs.swap(rhs);
+}
 
 }; // namespace custom
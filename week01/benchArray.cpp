@@ -0,0 +1,94 @@
+/***********************************************************************
+ * Source:
+ *    Bench Array
+ * Summary:
+ *    Time sum, min, and max over an array of ints, at the
+ *    element's own alignment and raised to 32 and 64 bytes, with
+ *    std::array as the yardstick. Each array is small enough to
+ *    stay in cache, so the loop itself is what is measured. The
+ *    report is nanoseconds per element. Build the BenchArray project
+ *    in Release, or, to let the compiler use the widest loads:
+ *       g++ -O3 -march=native -std=c++14 benchArray.cpp
+ * Author
+ *    Noah Li, Steven Sellers, Josh Hamilton.
+ ************************************************************************/
+
+#include "array.h"    // for array
+
+#include <array>      // for std::array, the yardstick
+#include <chrono>     // for steady_clock
+#include <cstddef>    // for size_t
+#include <iomanip>    // for setw and setprecision
+#include <iostream>   // for cout
+
+const size_t NUM_ELEMENTS = 4096;     // elements in every array
+const int    NUM_PASSES   = 100000;   // walks through each array
+
+// static, so the over-aligned ones need no aligned new
+std::array<int, NUM_ELEMENTS>            aStd;
+custom::array<int, NUM_ELEMENTS>         aNatural;
+custom::array<int, NUM_ELEMENTS, 32>     a32;
+custom::array<int, NUM_ELEMENTS, 64>     a64;
+
+/**********************************************************************
+ * VALUE AT
+ * The i'th value. A fixed scramble, so min and max have work to do
+ ***********************************************************************/
+int valueAt(size_t i)
+{
+   return int((i * 7919) % NUM_ELEMENTS);
+}
+
+/**********************************************************************
+ * TIME SUM MIN MAX
+ * Walk the array NUM_PASSES times keeping a sum, a min, and a max.
+ * All three are printed so the walk cannot be optimized away
+ ***********************************************************************/
+template <class Array>
+void timeSumMinMax(const char * name, const Array & a)
+{
+   long long sum = 0;
+   int least = 0;
+   int most = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (int pass = 0; pass < NUM_PASSES; pass++)
+   {
+      int passSum = 0;
+      int passLeast = a[0];
+      int passMost = a[0];
+      for (size_t i = 0; i < NUM_ELEMENTS; i++)
+      {
+         passSum += a[i];
+         passLeast = a[i] < passLeast ? a[i] : passLeast;
+         passMost  = a[i] > passMost  ? a[i] : passMost;
+      }
+      sum += passSum;
+      least += passLeast;
+      most += passMost;
+   }
+   auto finish = std::chrono::steady_clock::now();
+
+   double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+   std::cout << std::left  << std::setw(24) << name
+             << std::right << std::setw(8)  << std::fixed << std::setprecision(3)
+             << ns / (double(NUM_ELEMENTS) * NUM_PASSES) << " ns/element"
+             << "   (sum " << sum << ", min " << least << ", max " << most << ")\n";
+}
+
+/**********************************************************************
+ * MAIN
+ * Fill each array with the same values, then walk them
+ ***********************************************************************/
+int main()
+{
+   for (size_t i = 0; i < NUM_ELEMENTS; i++)
+      aStd[i] = aNatural[i] = a32[i] = a64[i] = valueAt(i);
+
+   std::cout << NUM_ELEMENTS << " elements, " << NUM_PASSES << " passes\n";
+   timeSumMinMax("std::array", aStd);
+   timeSumMinMax("array", aNatural);
+   timeSumMinMax("array (32-byte aligned)", a32);
+   timeSumMinMax("array (64-byte aligned)", a64);
+
+   return 0;
+}
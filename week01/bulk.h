@@ -0,0 +1,740 @@
+/***********************************************************************
+ * Header:
+ *    BULK
+ * Summary:
+ *    Whole-buffer kernels over arithmetic elements
+ *
+ *      __       ____       ____         __
+ *     /  |    .'    '.   .'    '.   _  / /
+ *     `| |   |  .--.  | |  .--.  | (_)/ /
+ *      | |   | |    | | | |    | |   / / _
+ *     _| |_  |  `--'  | |  `--'  |  / / (_)
+ *    |_____|  '.____.'   '.____.'  /_/
+ *
+ *
+ *    This will contain the definitions of:
+ *        reduce      : the sum of the elements
+ *        dot         : the sum of the products of two buffers
+ *        axpy        : y += alpha * x
+ *        min_index   : the smallest element and where it is
+ *        max_index   : the largest element and where it is
+ *        count_if    : how many elements compare true against a value
+ *    Each works on a pointer and a count, or on any contiguous
+ *    container with operator[] and size(), such as custom::vector
+ *    or custom::array. float and int use SSE4.1 or AVX2, picked
+ *    at run time from what the CPU supports. Every other type,
+ *    and every CPU that is not x86, uses the scalar loop.
+ *    SIMD sums add in a different order, so float results can
+ *    differ from the scalar loop in the last bits.
+ * Author
+ *    Noah Li, Josh Hamilton & Steven Sellers
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>      // because I am paranoid. lol
+#include <cstddef>      // for size_t
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CUSTOM_BULK_X86
+#include <immintrin.h>  // for the SSE and AVX intrinsics
+#ifdef _MSC_VER
+#include <intrin.h>     // for __cpuid
+#define CUSTOM_BULK_TARGET(x)
+#else
+#define CUSTOM_BULK_TARGET(x) __attribute__((target(x)))
+#endif
+#endif
+
+class TestBulk; // forward declaration for unit tests
+
+namespace custom
+{
+namespace bulk
+{
+
+/*****************************************
+ * COMPARE
+ * The comparison count_if applies: element OP value
+ ****************************************/
+enum class compare { less, less_equal, equal, not_equal, greater, greater_equal };
+
+/*****************************************
+ * INDEXED
+ * An element and its index, from min_index and max_index
+ ****************************************/
+template <class T>
+struct indexed
+{
+   T value;
+   size_t index;
+};
+
+/*****************************************
+ * CPU
+ * The instruction sets the kernels may use, weakest first
+ ****************************************/
+enum class cpu { scalar, sse41, avx2 };
+
+/*****************************************
+ * CPU DETECTED
+ * What this machine supports. AVX2 also needs the OS
+ * to save the wide registers, which cpuid reports.
+ ****************************************/
+inline cpu cpuDetected()
+{
+#if defined(CUSTOM_BULK_X86) && defined(_MSC_VER)
+   int info[4];
+   __cpuid(info, 0);
+   int numIds = info[0];
+   __cpuid(info, 1);
+   bool sse41 = (info[2] & (1 << 19)) != 0;
+   bool osxsave = (info[2] & (1 << 27)) != 0;
+   bool avx = (info[2] & (1 << 28)) != 0;
+   bool avx2 = false;
+   if (numIds >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6)
+   {
+      __cpuidex(info, 7, 0);
+      avx2 = (info[1] & (1 << 5)) != 0;
+   }
+   return avx2 ? cpu::avx2 : sse41 ? cpu::sse41 : cpu::scalar;
+#elif defined(CUSTOM_BULK_X86)
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx2"))
+      return cpu::avx2;
+   if (__builtin_cpu_supports("sse4.1"))
+      return cpu::sse41;
+   return cpu::scalar;
+#else
+   return cpu::scalar;
+#endif
+}
+
+/*****************************************
+ * CPU LEVEL
+ * The level the kernels use. It starts at what was detected
+ * and can be lowered, say to test or time the slower paths.
+ ****************************************/
+inline cpu & cpuCurrent()
+{
+   static cpu level = cpuDetected();
+   return level;
+}
+inline cpu cpuLevel()
+{
+   return cpuCurrent();
+}
+inline void setCpuLevel(cpu level)
+{
+   cpu detected = cpuDetected();
+   cpuCurrent() = level < detected ? level : detected;
+}
+
+/*****************************************
+ * SCALAR
+ * The plain loops. Every type can use these.
+ ****************************************/
+namespace scalar
+{
+
+template <class T>
+T reduce(const T * p, size_t num)
+{
+   T sum = T();
+   for (size_t i = 0; i < num; i++)
+      sum += p[i];
+   return sum;
+}
+
+template <class T>
+T dot(const T * pLHS, const T * pRHS, size_t num)
+{
+   T sum = T();
+   for (size_t i = 0; i < num; i++)
+      sum += pLHS[i] * pRHS[i];
+   return sum;
+}
+
+template <class T>
+void axpy(T alpha, const T * pX, T * pY, size_t num)
+{
+   for (size_t i = 0; i < num; i++)
+      pY[i] += alpha * pX[i];
+}
+
+template <class T>
+indexed<T> min_index(const T * p, size_t num)
+{
+   assert(num > 0);
+   indexed<T> result = { p[0], 0 };
+   for (size_t i = 1; i < num; i++)
+      if (p[i] < result.value)
+         result = { p[i], i };
+   return result;
+}
+
+template <class T>
+indexed<T> max_index(const T * p, size_t num)
+{
+   assert(num > 0);
+   indexed<T> result = { p[0], 0 };
+   for (size_t i = 1; i < num; i++)
+      if (result.value < p[i])
+         result = { p[i], i };
+   return result;
+}
+
+template <class T>
+bool test(const T & t, compare op, const T & value)
+{
+   switch (op)
+   {
+      case compare::less:          return t <  value;
+      case compare::less_equal:    return t <= value;
+      case compare::equal:         return t == value;
+      case compare::not_equal:     return t != value;
+      case compare::greater:       return t >  value;
+      case compare::greater_equal: return t >= value;
+   }
+   return false;
+}
+
+template <class T>
+size_t count_if(const T * p, size_t num, compare op, const T & value)
+{
+   size_t count = 0;
+   for (size_t i = 0; i < num; i++)
+      if (test(p[i], op, value))
+         count++;
+   return count;
+}
+
+/*****************************************
+ * FIND FROM
+ * The first index at or after indexBegin holding value.
+ * The SIMD min and max find the value, then this finds
+ * where it first appears.
+ ****************************************/
+template <class T>
+size_t find_from(const T * p, size_t indexBegin, size_t num, const T & value)
+{
+   for (size_t i = indexBegin; i < num; i++)
+      if (p[i] == value)
+         return i;
+   return num;
+}
+
+} // namespace scalar
+
+#ifdef CUSTOM_BULK_X86
+
+/*****************************************
+ * BIT COUNT
+ * Number of lanes set in a movemask result
+ ****************************************/
+inline size_t bitCount(int mask)
+{
+   size_t count = 0;
+   for (; mask; mask &= mask - 1)
+      count++;
+   return count;
+}
+
+/*****************************************
+ * SSE4.1
+ * Four lanes of float or int at a time
+ ****************************************/
+namespace sse41
+{
+
+CUSTOM_BULK_TARGET("sse4.1")
+inline float sum(__m128 x)
+{
+   x = _mm_add_ps(x, _mm_movehl_ps(x, x));
+   x = _mm_add_ss(x, _mm_shuffle_ps(x, x, 1));
+   return _mm_cvtss_f32(x);
+}
+
+CUSTOM_BULK_TARGET("sse4.1")
+inline int sum(__m128i x)
+{
+   x = _mm_add_epi32(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2)));
+   x = _mm_add_epi32(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1)));
+   return _mm_cvtsi128_si32(x);
+}
+
+CUSTOM_BULK_TARGET("sse4.1")
+inline float reduce(const float * p, size_t num)
+{
+   __m128 acc = _mm_setzero_ps();
+   size_t i = 0;
+   for (; i + 4 <= num; i += 4)
+      acc = _mm_add_ps(acc, _mm_loadu_ps(p + i));
+   return sum(acc) + scalar::reduce(p + i, num - i);
+}
+
+CUSTOM_BULK_TARGET("sse4.1")
+inline int reduce(const int * p, size_t num)
+{
+   __m128i acc = _mm_setzero_si128();
+   size_t i = 0;
+   for (; i + 4 <= num; i += 4)
+      acc = _mm_add_epi32(acc, _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)));
+   return sum(acc) + scalar::reduce(p + i, num - i);
+}
+
+CUSTOM_BULK_TARGET("sse4.1")
+inline float dot(const float * pLHS, const float * pRHS, size_t num)
+{
+   __m128 acc = _mm_setzero_ps();
+   size_t i = 0;
+   for (; i + 4 <= num; i += 4)
+      acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(pLHS + i), _mm_loadu_ps(pRHS + i)));
+   return sum(acc) + scalar::dot(pLHS + i, pRHS + i, num - i);
+}
+
+CUSTOM_BULK_TARGET("sse4.1")
+inline int dot(const int * pLHS, const int * pRHS, size_t num)
+{
+   __m128i acc = _mm_setzero_si128();
+   size_t i = 0;
+   for (; i + 4 <= num; i += 4)
+      acc = _mm_add_epi32(acc, _mm_mullo_epi32(
+         _mm_loadu_si128(reinterpret_cast<const __m128i *>(pLHS + i)),
+         _mm_loadu_si128(reinterpret_cast<const __m128i *>(pRHS + i))));
+   return sum(acc) + scalar::dot(pLHS + i, pRHS + i, num - i);
+}
+
+CUSTOM_BULK_TARGET("sse4.1")
+inline void axpy(float alpha, const float * pX, float * pY, size_t num)
+{
+   __m128 a = _mm_set1_ps(alpha);
+   size_t i = 0;
+   for (; i + 4 <= num; i += 4)
+      _mm_storeu_ps(pY + i, _mm_add_ps(_mm_loadu_ps(pY + i), _mm_mul_ps(a, _mm_loadu_ps(pX + i))));
+   scalar::axpy(alpha, pX + i, pY + i, num - i);
+}
+
+CUSTOM_BULK_TARGET("sse4.1")
+inline void axpy(int alpha, const int * pX, int * pY, size_t num)
+{
+   __m128i a = _mm_set1_epi32(alpha);
+   size_t i = 0;
+   for (; i + 4 <= num; i += 4)
+   {
+      __m128i * pDest = reinterpret_cast<__m128i *>(pY + i);
+      __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pX + i));
+      _mm_storeu_si128(pDest, _mm_add_epi32(_mm_loadu_si128(pDest), _mm_mullo_epi32(a, x)));
+   }
+   scalar::axpy(alpha, pX + i, pY + i, num - i);
+}
+
+// the smallest or largest value; the caller finds where it is.
+// min and max hand back their second operand when either is NaN,
+// so with acc second and seeded from a number, a NaN is skipped
+// just as the scalar < skips it. The last lane overlaps the rest
+CUSTOM_BULK_TARGET("sse4.1")
+inline float extreme(const float * p, size_t num, bool isMin)
+{
+   assert(num >= 4 && p[0] == p[0]);
+   __m128 acc = _mm_set1_ps(p[0]);
+   size_t i = 0;
+   for (; i + 4 <= num; i += 4)
+      acc = isMin ? _mm_min_ps(_mm_loadu_ps(p + i), acc) : _mm_max_ps(_mm_loadu_ps(p + i), acc);
+   if (i < num)
+      acc = isMin ? _mm_min_ps(_mm_loadu_ps(p + num - 4), acc) : _mm_max_ps(_mm_loadu_ps(p + num - 4), acc);
+   float lanes[4];
+   _mm_storeu_ps(lanes, acc);
+   return isMin ? scalar::min_index(lanes, 4).value : scalar::max_index(lanes, 4).value;
+}
+
+CUSTOM_BULK_TARGET("sse4.1")
+inline int extreme(const int * p, size_t num, bool isMin)
+{
+   assert(num >= 4);
+   __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+   size_t i = 4;
+   for (; i + 4 <= num; i += 4)
+   {
+      __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+      acc = isMin ? _mm_min_epi32(acc, x) : _mm_max_epi32(acc, x);
+   }
+   int lanes[4];
+   _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), acc);
+   indexed<int> lane = isMin ? scalar::min_index(lanes, 4) : scalar::max_index(lanes, 4);
+   indexed<int> tail = isMin ? scalar::min_index(p + num - 4, 4) : scalar::max_index(p + num - 4, 4);
+   return isMin ? (tail.value < lane.value ? tail.value : lane.value)
+                : (lane.value < tail.value ? tail.value : lane.value);
+}
+
+CUSTOM_BULK_TARGET("sse4.1")
+inline int mask(__m128 x, compare op, __m128 v)
+{
+   switch (op)
+   {
+      case compare::less:          return _mm_movemask_ps(_mm_cmplt_ps(x, v));
+      case compare::less_equal:    return _mm_movemask_ps(_mm_cmple_ps(x, v));
+      case compare::equal:         return _mm_movemask_ps(_mm_cmpeq_ps(x, v));
+      case compare::not_equal:     return _mm_movemask_ps(_mm_cmpneq_ps(x, v));
+      case compare::greater:       return _mm_movemask_ps(_mm_cmpgt_ps(x, v));
+      case compare::greater_equal: return _mm_movemask_ps(_mm_cmpge_ps(x, v));
+   }
+   return 0;
+}
+
+CUSTOM_BULK_TARGET("sse4.1")
+inline int mask(__m128i x, compare op, __m128i v)
+{
+   switch (op)
+   {
+      case compare::less:          return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(x, v)));
+      case compare::less_equal:    return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(x, v))) ^ 0xF;
+      case compare::equal:         return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(x, v)));
+      case compare::not_equal:     return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(x, v))) ^ 0xF;
+      case compare::greater:       return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(x, v)));
+      case compare::greater_equal: return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(x, v))) ^ 0xF;
+   }
+   return 0;
+}
+
+CUSTOM_BULK_TARGET("sse4.1")
+inline size_t count_if(const float * p, size_t num, compare op, float value)
+{
+   __m128 v = _mm_set1_ps(value);
+   size_t count = 0;
+   size_t i = 0;
+   for (; i + 4 <= num; i += 4)
+      count += bitCount(mask(_mm_loadu_ps(p + i), op, v));
+   return count + scalar::count_if(p + i, num - i, op, value);
+}
+
+CUSTOM_BULK_TARGET("sse4.1")
+inline size_t count_if(const int * p, size_t num, compare op, int value)
+{
+   __m128i v = _mm_set1_epi32(value);
+   size_t count = 0;
+   size_t i = 0;
+   for (; i + 4 <= num; i += 4)
+      count += bitCount(mask(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)), op, v));
+   return count + scalar::count_if(p + i, num - i, op, value);
+}
+
+} // namespace sse41
+
+/*****************************************
+ * AVX2
+ * Eight lanes of float or int at a time
+ ****************************************/
+namespace avx2
+{
+
+CUSTOM_BULK_TARGET("avx2")
+inline float sum(__m256 x)
+{
+   __m128 half = _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+   half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+   half = _mm_add_ss(half, _mm_shuffle_ps(half, half, 1));
+   return _mm_cvtss_f32(half);
+}
+
+CUSTOM_BULK_TARGET("avx2")
+inline int sum(__m256i x)
+{
+   __m128i half = _mm_add_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+   half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+   half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+   return _mm_cvtsi128_si32(half);
+}
+
+CUSTOM_BULK_TARGET("avx2")
+inline float reduce(const float * p, size_t num)
+{
+   __m256 acc = _mm256_setzero_ps();
+   size_t i = 0;
+   for (; i + 8 <= num; i += 8)
+      acc = _mm256_add_ps(acc, _mm256_loadu_ps(p + i));
+   return sum(acc) + scalar::reduce(p + i, num - i);
+}
+
+CUSTOM_BULK_TARGET("avx2")
+inline int reduce(const int * p, size_t num)
+{
+   __m256i acc = _mm256_setzero_si256();
+   size_t i = 0;
+   for (; i + 8 <= num; i += 8)
+      acc = _mm256_add_epi32(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)));
+   return sum(acc) + scalar::reduce(p + i, num - i);
+}
+
+CUSTOM_BULK_TARGET("avx2")
+inline float dot(const float * pLHS, const float * pRHS, size_t num)
+{
+   __m256 acc = _mm256_setzero_ps();
+   size_t i = 0;
+   for (; i + 8 <= num; i += 8)
+      acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(pLHS + i), _mm256_loadu_ps(pRHS + i)));
+   return sum(acc) + scalar::dot(pLHS + i, pRHS + i, num - i);
+}
+
+CUSTOM_BULK_TARGET("avx2")
+inline int dot(const int * pLHS, const int * pRHS, size_t num)
+{
+   __m256i acc = _mm256_setzero_si256();
+   size_t i = 0;
+   for (; i + 8 <= num; i += 8)
+      acc = _mm256_add_epi32(acc, _mm256_mullo_epi32(
+         _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pLHS + i)),
+         _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pRHS + i))));
+   return sum(acc) + scalar::dot(pLHS + i, pRHS + i, num - i);
+}
+
+CUSTOM_BULK_TARGET("avx2")
+inline void axpy(float alpha, const float * pX, float * pY, size_t num)
+{
+   __m256 a = _mm256_set1_ps(alpha);
+   size_t i = 0;
+   for (; i + 8 <= num; i += 8)
+      _mm256_storeu_ps(pY + i, _mm256_add_ps(_mm256_loadu_ps(pY + i), _mm256_mul_ps(a, _mm256_loadu_ps(pX + i))));
+   scalar::axpy(alpha, pX + i, pY + i, num - i);
+}
+
+CUSTOM_BULK_TARGET("avx2")
+inline void axpy(int alpha, const int * pX, int * pY, size_t num)
+{
+   __m256i a = _mm256_set1_epi32(alpha);
+   size_t i = 0;
+   for (; i + 8 <= num; i += 8)
+   {
+      __m256i * pDest = reinterpret_cast<__m256i *>(pY + i);
+      __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pX + i));
+      _mm256_storeu_si256(pDest, _mm256_add_epi32(_mm256_loadu_si256(pDest), _mm256_mullo_epi32(a, x)));
+   }
+   scalar::axpy(alpha, pX + i, pY + i, num - i);
+}
+
+CUSTOM_BULK_TARGET("avx2")
+inline float extreme(const float * p, size_t num, bool isMin)
+{
+   assert(num >= 8 && p[0] == p[0]);
+   __m256 acc = _mm256_set1_ps(p[0]);
+   size_t i = 0;
+   for (; i + 8 <= num; i += 8)
+      acc = isMin ? _mm256_min_ps(_mm256_loadu_ps(p + i), acc) : _mm256_max_ps(_mm256_loadu_ps(p + i), acc);
+   if (i < num)
+      acc = isMin ? _mm256_min_ps(_mm256_loadu_ps(p + num - 8), acc) : _mm256_max_ps(_mm256_loadu_ps(p + num - 8), acc);
+   float lanes[8];
+   _mm256_storeu_ps(lanes, acc);
+   return isMin ? scalar::min_index(lanes, 8).value : scalar::max_index(lanes, 8).value;
+}
+
+CUSTOM_BULK_TARGET("avx2")
+inline int extreme(const int * p, size_t num, bool isMin)
+{
+   assert(num >= 8);
+   __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+   size_t i = 8;
+   for (; i + 8 <= num; i += 8)
+   {
+      __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+      acc = isMin ? _mm256_min_epi32(acc, x) : _mm256_max_epi32(acc, x);
+   }
+   int lanes[8];
+   _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), acc);
+   indexed<int> lane = isMin ? scalar::min_index(lanes, 8) : scalar::max_index(lanes, 8);
+   indexed<int> tail = isMin ? scalar::min_index(p + num - 8, 8) : scalar::max_index(p + num - 8, 8);
+   return isMin ? (tail.value < lane.value ? tail.value : lane.value)
+                : (lane.value < tail.value ? tail.value : lane.value);
+}
+
+CUSTOM_BULK_TARGET("avx2")
+inline int mask(__m256 x, compare op, __m256 v)
+{
+   switch (op)
+   {
+      case compare::less:          return _mm256_movemask_ps(_mm256_cmp_ps(x, v, _CMP_LT_OQ));
+      case compare::less_equal:    return _mm256_movemask_ps(_mm256_cmp_ps(x, v, _CMP_LE_OQ));
+      case compare::equal:         return _mm256_movemask_ps(_mm256_cmp_ps(x, v, _CMP_EQ_OQ));
+      case compare::not_equal:     return _mm256_movemask_ps(_mm256_cmp_ps(x, v, _CMP_NEQ_UQ));
+      case compare::greater:       return _mm256_movemask_ps(_mm256_cmp_ps(x, v, _CMP_GT_OQ));
+      case compare::greater_equal: return _mm256_movemask_ps(_mm256_cmp_ps(x, v, _CMP_GE_OQ));
+   }
+   return 0;
+}
+
+CUSTOM_BULK_TARGET("avx2")
+inline int mask(__m256i x, compare op, __m256i v)
+{
+   switch (op)
+   {
+      case compare::less:          return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, x)));
+      case compare::less_equal:    return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x, v))) ^ 0xFF;
+      case compare::equal:         return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, v)));
+      case compare::not_equal:     return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, v))) ^ 0xFF;
+      case compare::greater:       return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x, v)));
+      case compare::greater_equal: return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, x))) ^ 0xFF;
+   }
+   return 0;
+}
+
+CUSTOM_BULK_TARGET("avx2")
+inline size_t count_if(const float * p, size_t num, compare op, float value)
+{
+   __m256 v = _mm256_set1_ps(value);
+   size_t count = 0;
+   size_t i = 0;
+   for (; i + 8 <= num; i += 8)
+      count += bitCount(mask(_mm256_loadu_ps(p + i), op, v));
+   return count + scalar::count_if(p + i, num - i, op, value);
+}
+
+CUSTOM_BULK_TARGET("avx2")
+inline size_t count_if(const int * p, size_t num, compare op, int value)
+{
+   __m256i v = _mm256_set1_epi32(value);
+   size_t count = 0;
+   size_t i = 0;
+   for (; i + 8 <= num; i += 8)
+      count += bitCount(mask(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)), op, v));
+   return count + scalar::count_if(p + i, num - i, op, value);
+}
+
+} // namespace avx2
+
+#endif // CUSTOM_BULK_X86
+
+/*****************************************
+ * DISPATCH
+ * The generic templates run the scalar loop. float and int
+ * have exact-match overloads that pick the widest level.
+ ****************************************/
+template <class T>
+T reduce(const T * p, size_t num)
+{
+   return scalar::reduce(p, num);
+}
+template <class T>
+T dot(const T * pLHS, const T * pRHS, size_t num)
+{
+   return scalar::dot(pLHS, pRHS, num);
+}
+template <class T>
+void axpy(T alpha, const T * pX, T * pY, size_t num)
+{
+   scalar::axpy(alpha, pX, pY, num);
+}
+template <class T>
+indexed<T> min_index(const T * p, size_t num)
+{
+   return scalar::min_index(p, num);
+}
+template <class T>
+indexed<T> max_index(const T * p, size_t num)
+{
+   return scalar::max_index(p, num);
+}
+template <class T>
+size_t count_if(const T * p, size_t num, compare op, const T & value)
+{
+   return scalar::count_if(p, num, op, value);
+}
+
+#ifdef CUSTOM_BULK_X86
+
+#define CUSTOM_BULK_DISPATCH(call)                  \
+   switch (cpuLevel())                              \
+   {                                                \
+      case cpu::avx2:   return avx2::call;          \
+      case cpu::sse41:  return sse41::call;         \
+      default:          return scalar::call;        \
+   }
+
+inline float  reduce(const float * p, size_t num) { CUSTOM_BULK_DISPATCH(reduce(p, num)) }
+inline int    reduce(const int   * p, size_t num) { CUSTOM_BULK_DISPATCH(reduce(p, num)) }
+
+inline float  dot(const float * pLHS, const float * pRHS, size_t num) { CUSTOM_BULK_DISPATCH(dot(pLHS, pRHS, num)) }
+inline int    dot(const int   * pLHS, const int   * pRHS, size_t num) { CUSTOM_BULK_DISPATCH(dot(pLHS, pRHS, num)) }
+
+inline void   axpy(float alpha, const float * pX, float * pY, size_t num) { CUSTOM_BULK_DISPATCH(axpy(alpha, pX, pY, num)) }
+inline void   axpy(int   alpha, const int   * pX, int   * pY, size_t num) { CUSTOM_BULK_DISPATCH(axpy(alpha, pX, pY, num)) }
+
+inline size_t count_if(const float * p, size_t num, compare op, float value) { CUSTOM_BULK_DISPATCH(count_if(p, num, op, value)) }
+inline size_t count_if(const int   * p, size_t num, compare op, int   value) { CUSTOM_BULK_DISPATCH(count_if(p, num, op, value)) }
+
+#undef CUSTOM_BULK_DISPATCH
+
+/*****************************************
+ * EXTREME INDEX
+ * SIMD finds the smallest or largest value, then a
+ * scalar pass finds the first place it appears. A NaN
+ * in front wins under <, so that one is left to scalar
+ ****************************************/
+template <class T>
+indexed<T> extremeIndex(const T * p, size_t num, bool isMin)
+{
+   assert(num > 0);
+   T value;
+   if (p[0] != p[0])
+      return { p[0], 0 };
+   if (cpuLevel() == cpu::avx2 && num >= 8)
+      value = avx2::extreme(p, num, isMin);
+   else if (cpuLevel() >= cpu::sse41 && num >= 4)
+      value = sse41::extreme(p, num, isMin);
+   else
+      return isMin ? scalar::min_index(p, num) : scalar::max_index(p, num);
+   size_t index = scalar::find_from(p, 0, num, value);
+   return { p[index], index };
+}
+
+inline indexed<float> min_index(const float * p, size_t num) { return extremeIndex(p, num, true);  }
+inline indexed<int>   min_index(const int   * p, size_t num) { return extremeIndex(p, num, true);  }
+inline indexed<float> max_index(const float * p, size_t num) { return extremeIndex(p, num, false); }
+inline indexed<int>   max_index(const int   * p, size_t num) { return extremeIndex(p, num, false); }
+
+#endif // CUSTOM_BULK_X86
+
+/*****************************************
+ * CONTAINERS
+ * Run a kernel over the contiguous buffer of a container
+ * such as custom::vector or custom::array
+ ****************************************/
+template <class Container>
+auto reduce(const Container & c) -> decltype(reduce(&c[0], c.size()))
+{
+   return c.size() == 0 ? decltype(reduce(&c[0], c.size()))() : reduce(&c[0], c.size());
+}
+
+template <class Container>
+auto dot(const Container & lhs, const Container & rhs) -> decltype(dot(&lhs[0], &rhs[0], lhs.size()))
+{
+   assert(lhs.size() == rhs.size());
+   return lhs.size() == 0 ? decltype(dot(&lhs[0], &rhs[0], lhs.size()))() : dot(&lhs[0], &rhs[0], lhs.size());
+}
+
+template <class Container, class T>
+void axpy(T alpha, const Container & x, Container & y)
+{
+   assert(x.size() == y.size());
+   if (x.size() != 0)
+      axpy(alpha, &x[0], &y[0], x.size());
+}
+
+template <class Container>
+auto min_index(const Container & c) -> decltype(min_index(&c[0], c.size()))
+{
+   return min_index(&c[0], c.size());
+}
+
+template <class Container>
+auto max_index(const Container & c) -> decltype(max_index(&c[0], c.size()))
+{
+   return max_index(&c[0], c.size());
+}
+
+template <class Container, class T>
+size_t count_if(const Container & c, compare op, const T & value)
+{
+   return c.size() == 0 ? 0 : count_if(&c[0], c.size(), op, value);
+}
+
+} // namespace bulk
+} // namespace custom
@@ -15,6 +15,18 @@
 #include "array.h"      // class under test
 #include "unitTest.h"   // unit test baseclass
 
+/***********************************************
+ * SUM OF
+ * A compile-time loop over an array, for test_constexpr_sum
+ ***********************************************/
+constexpr int sumOf(const custom::array<int, 4> & a)
+{
+   int sum = 0;
+   for (size_t i = 0; i < a.size(); i++)
+      sum += a[i];
+   return sum;
+}
+
 /***********************************************
  * TEST ARRAY
  * Unit tests for the Array class
@@ -66,6 +78,13 @@ public:
       test_iterator_incrementPrefix();
       test_iterator_incrementPostfix();
 
+      // Fill, swap and other element types
+      test_fill_standard();
+      test_swap_standard();
+      test_generic_double();
+      test_constexpr_sum();
+      test_align_sixtyFour();
+
       report("Array");
    }
    
@@ -77,7 +96,7 @@ public:
    // size of a one-element array
    void test_size_one()
    {  // setup
-      const custom::array<1> a{};
+      const custom::array<int, 1> a{};
       // exercise
       size_t size = a.size();
       // verify
@@ -91,9 +110,9 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> aRW;
+      custom::array<int, 4> aRW;
       setupStandardFixture(aRW);
-      const custom::array<4> a(aRW);
+      const custom::array<int, 4> a(aRW);
       // exercise
       size_t size = a.size();
       // verify
@@ -108,7 +127,7 @@ public:
    // one-element array empty?
    void test_empty_one()
    {  // setup
-      const custom::array<1> a{};
+      const custom::array<int, 1> a{};
       // exercise
       bool empty = a.empty();
       // verify
@@ -122,9 +141,9 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> aRW;
+      custom::array<int, 4> aRW;
       setupStandardFixture(aRW);
-      const custom::array<4> a(aRW);
+      const custom::array<int, 4> a(aRW);
       // exercise
       bool empty = a.empty();
       // verify
@@ -148,9 +167,9 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> aRW;
+      custom::array<int, 4> aRW;
       setupStandardFixture(aRW);
-      const custom::array<4> a(aRW);
+      const custom::array<int, 4> a(aRW);
       int s = 0;
       // exercise
       s = a[1];
@@ -170,7 +189,7 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
       int s = 99;
       // exercise
@@ -192,9 +211,9 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> aRW;
+      custom::array<int, 4> aRW;
       setupStandardFixture(aRW);
-      const custom::array<4> a(aRW);
+      const custom::array<int, 4> a(aRW);
       int s = 0;
       // exercise
       s = a.at(1);
@@ -214,7 +233,7 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
       int s = 99;
       // exercise
@@ -236,9 +255,9 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> aRW;
+      custom::array<int, 4> aRW;
       setupStandardFixture(aRW);
-      const custom::array<4> a(aRW);
+      const custom::array<int, 4> a(aRW);
       int s = 0;
       // exercise
       try
@@ -266,7 +285,7 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
       int s = 99;
       // exercise
@@ -298,9 +317,9 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> aRW;
+      custom::array<int, 4> aRW;
       setupStandardFixture(aRW);
-      const custom::array<4> a(aRW);
+      const custom::array<int, 4> a(aRW);
       int s = 99;
       // exerciase
       s = a.front();
@@ -316,7 +335,7 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
       int s = 99;
       // exerciase
@@ -338,9 +357,9 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> aRW;
+      custom::array<int, 4> aRW;
       setupStandardFixture(aRW);
-      const custom::array<4> a(aRW);
+      const custom::array<int, 4> a(aRW);
       int s = 99;
       // exerciase
       s = a.back();
@@ -356,7 +375,7 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
       int s = 99;
       // exerciase
@@ -383,9 +402,9 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
-      custom::array<4>::iterator it;
+      custom::array<int, 4>::iterator it;
       // exercise
       it = a.begin();
       // verify
@@ -404,9 +423,9 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
-      custom::array<4>::iterator it;
+      custom::array<int, 4>::iterator it;
       // exercise
       it = a.end();
       // verify
@@ -425,10 +444,10 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
       // exercise
-      custom::array<4>::iterator it;
+      custom::array<int, 4>::iterator it;
       // verify
       assertUnit(it.p == nullptr);
       //      0    1    2    3
@@ -445,10 +464,10 @@ public:
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
       // exercise
-      custom::array<4>::iterator it(&(a.__elems_[2]));
+      custom::array<int, 4>::iterator it(&(a.__elems_[2]));
       // verify
       assertUnit(it.p == &(a.__elems_[2]));
       //      0    1    2    3
@@ -467,12 +486,12 @@ public:
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
       //               itRHS
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
-      custom::array<4>::iterator itRHS;
+      custom::array<int, 4>::iterator itRHS;
       itRHS.p = &(a.__elems_[2]);    
       // exercise
-      custom::array<4>::iterator itLHS(itRHS);
+      custom::array<int, 4>::iterator itLHS(itRHS);
       // verify
       assertUnit(itLHS.p == itRHS.p);
       //      0    1    2    3
@@ -490,11 +509,11 @@ public:
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
       //               itRHS
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
-      custom::array<4>::iterator itRHS;
+      custom::array<int, 4>::iterator itRHS;
       itRHS.p = &(a.__elems_[2]);
-      custom::array<4>::iterator itLHS;
+      custom::array<int, 4>::iterator itLHS;
       // exercise
       itLHS = itRHS;
       // verify
@@ -515,11 +534,11 @@ public:
       //    +----+----+----+----+
       //               itLHS
       //               itRHS
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
-      custom::array<4>::iterator itLHS;
+      custom::array<int, 4>::iterator itLHS;
       itLHS.p = &(a.__elems_[2]);
-      custom::array<4>::iterator itRHS;
+      custom::array<int, 4>::iterator itRHS;
       itRHS.p = &(a.__elems_[2]);
       bool b;
       // exercise
@@ -541,11 +560,11 @@ public:
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
       //    itLHS      itRHS
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
-      custom::array<4>::iterator itLHS;
+      custom::array<int, 4>::iterator itLHS;
       itLHS.p = &(a.__elems_[0]);
-      custom::array<4>::iterator itRHS;
+      custom::array<int, 4>::iterator itRHS;
       itRHS.p = &(a.__elems_[2]);
       bool b;
       // exercise
@@ -567,18 +586,18 @@ public:
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
       //    itLHS      
-      custom::array<4> aLHS;
+      custom::array<int, 4> aLHS;
       setupStandardFixture(aLHS);
-      custom::array<4>::iterator itLHS;
+      custom::array<int, 4>::iterator itLHS;
       itLHS.p = &(aLHS.__elems_[0]);
       //      0    1    2    3
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
       //    itRHS      
-      custom::array<4> aRHS;
+      custom::array<int, 4> aRHS;
       setupStandardFixture(aRHS);
-      custom::array<4>::iterator itRHS;
+      custom::array<int, 4>::iterator itRHS;
       itRHS.p = &(aRHS.__elems_[0]);
       bool b;
       // exercise
@@ -602,11 +621,11 @@ public:
       //    +----+----+----+----+
       //               itLHS
       //               itRHS
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
-      custom::array<4>::iterator itLHS;
+      custom::array<int, 4>::iterator itLHS;
       itLHS.p = &(a.__elems_[2]);
-      custom::array<4>::iterator itRHS;
+      custom::array<int, 4>::iterator itRHS;
       itRHS.p = &(a.__elems_[2]);
       bool b;
       // exercise
@@ -628,11 +647,11 @@ public:
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
       //    itLHS      itRHS
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
-      custom::array<4>::iterator itLHS;
+      custom::array<int, 4>::iterator itLHS;
       itLHS.p = &(a.__elems_[0]);
-      custom::array<4>::iterator itRHS;
+      custom::array<int, 4>::iterator itRHS;
       itRHS.p = &(a.__elems_[2]);
       bool b;
       // exercise
@@ -654,18 +673,18 @@ public:
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
       //    itLHS      
-      custom::array<4> aLHS;
+      custom::array<int, 4> aLHS;
       setupStandardFixture(aLHS);
-      custom::array<4>::iterator itLHS;
+      custom::array<int, 4>::iterator itLHS;
       itLHS.p = &(aLHS.__elems_[0]);
       //      0    1    2    3
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
       //    itRHS      
-      custom::array<4> aRHS;
+      custom::array<int, 4> aRHS;
       setupStandardFixture(aRHS);
-      custom::array<4>::iterator itRHS;
+      custom::array<int, 4>::iterator itRHS;
       itRHS.p = &(aRHS.__elems_[0]);
       bool b;
       // exercise
@@ -688,9 +707,9 @@ public:
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
       //               it
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
-      custom::array<4>::iterator it;
+      custom::array<int, 4>::iterator it;
       it.p = &(a.__elems_[2]);
       int s;
       // exercise
@@ -713,9 +732,9 @@ public:
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
       //               it
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
-      custom::array<4>::iterator it;
+      custom::array<int, 4>::iterator it;
       it.p = &(a.__elems_[2]);
       int s = 99;
       // exercise
@@ -739,11 +758,11 @@ public:
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
       //               itRHS
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
-      custom::array<4>::iterator itRHS;
+      custom::array<int, 4>::iterator itRHS;
       itRHS.p = &(a.__elems_[2]);
-      custom::array<4>::iterator itLHS;
+      custom::array<int, 4>::iterator itLHS;
       // exercise
       itLHS = ++itRHS;
       // verify
@@ -766,11 +785,11 @@ public:
       //    | 26 | 49 | 67 | 89 |
       //    +----+----+----+----+
       //               itRHS
-      custom::array<4> a;
+      custom::array<int, 4> a;
       setupStandardFixture(a);
-      custom::array<4>::iterator itRHS;
+      custom::array<int, 4>::iterator itRHS;
       itRHS.p = &(a.__elems_[2]);
-      custom::array<4>::iterator itLHS;
+      custom::array<int, 4>::iterator itLHS;
       // exercise
       itLHS = itRHS++;
       // verify
@@ -785,6 +804,83 @@ public:
       assertStandardFixture(a);
    }  // teardown
 
+   /***************************************
+    * FILL SWAP GENERIC
+    ***************************************/
+
+   // fill every slot with one value
+   void test_fill_standard()
+   {  // setup
+      custom::array<int, 4> a;
+      setupStandardFixture(a);
+      // exercise
+      a.fill(99);
+      // verify
+      //      0    1    2    3
+      //    +----+----+----+----+
+      //    | 99 | 99 | 99 | 99 |
+      //    +----+----+----+----+
+      assertUnit(a.__elems_[0] == 99);
+      assertUnit(a.__elems_[1] == 99);
+      assertUnit(a.__elems_[2] == 99);
+      assertUnit(a.__elems_[3] == 99);
+   }  // teardown
+
+   // swap the standard fixture with a filled array
+   void test_swap_standard()
+   {  // setup
+      custom::array<int, 4> aLHS;
+      setupStandardFixture(aLHS);
+      custom::array<int, 4> aRHS;
+      aRHS.fill(11);
+      // exercise
+      swap(aLHS, aRHS);
+      // verify
+      assertUnit(aLHS.__elems_[0] == 11);
+      assertUnit(aLHS.__elems_[3] == 11);
+      assertStandardFixture(aRHS);
+   }  // teardown
+
+   // the array holds doubles as well as ints
+   void test_generic_double()
+   {  // setup
+      custom::array<double, 3> a{ { 1.5, 2.5, 3.5 } };
+      // exercise
+      double sum = 0.0;
+      for (custom::array<double, 3>::iterator it = a.begin(); it != a.end(); ++it)
+         sum += *it;
+      // verify
+      assertUnit(sum == 7.5);
+      assertUnit(a.front() == 1.5);
+      assertUnit(a.back() == 3.5);
+      assertUnit(sizeof(a) == sizeof(double) * 3);
+   }  // teardown
+
+   // size, subscript and iteration all work at compile time
+   void test_constexpr_sum()
+   {  // setup
+      constexpr custom::array<int, 4> a{ { 26, 49, 67, 89 } };
+      // exercise
+      static_assert(a.size() == 4, "size is known at compile time");
+      static_assert(a[2] == 67, "subscript is known at compile time");
+      static_assert(a.back() == 89, "back is known at compile time");
+      constexpr int sum = sumOf(a);
+      // verify
+      assertUnit(sum == 26 + 49 + 67 + 89);
+   }  // teardown
+
+   // an over-aligned array starts on a 64 byte boundary
+   void test_align_sixtyFour()
+   {  // setup
+      custom::array<float, 8, 64> a{};
+      // exercise
+      size_t address = reinterpret_cast<size_t>(a.data());
+      // verify
+      assertUnit(alignof(custom::array<float, 8, 64>) == 64);
+      assertUnit(address % 64 == 0);
+      assertUnit(a.size() == 8);
+   }  // teardown
+
    /*************************************************************
     * SETUP STANDARD FIXTURE
     *      0    1    2    3
@@ -792,7 +888,7 @@ public:
     *    | 26 | 49 | 67 | 89 |
     *    +----+----+----+----+
     *************************************************************/
-   void setupStandardFixture(custom::array<4> & a)
+   void setupStandardFixture(custom::array<int, 4> & a)
    {
       a.__elems_[0] = 26;
       a.__elems_[1] = 49;
@@ -807,7 +903,7 @@ public:
     *    | 26 | 49 | 67 | 89 |
     *    +----+----+----+----+
     *************************************************************/
-   void assertStandardFixtureParameters(const custom::array<4> & a, int line, const char * function)
+   void assertStandardFixtureParameters(const custom::array<int, 4> & a, int line, const char * function)
    {
       assertIndirect(a.size() == 4);
       assertIndirect(a.__elems_[0] == 26);
@@ -0,0 +1,205 @@
+/***********************************************************************
+ * Header:
+ *    TEST BULK
+ * Summary:
+ *    Unit tests for the bulk kernels over custom::array
+ * Author
+ *    Noah Li, Josh Hamilton & Steven Sellers
+ ************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG
+
+#include "bulk.h"       // kernels under test
+#include "array.h"      // the container they run over
+#include "unitTest.h"   // unit test baseclass
+
+#include <limits>
+
+/***********************************************
+ * TEST BULK
+ * Unit tests for the bulk kernels
+ ***********************************************/
+class TestBulk : public UnitTest
+{
+public:
+   void run()
+   {
+      reset();
+
+      // Kernels over an aligned array
+      test_reduce_aligned();
+      test_dot_aligned();
+      test_axpy_aligned();
+      test_minMax_int();
+      test_minMax_nanSkipped();
+      test_minMax_nanInFront();
+      test_countIf_int();
+
+      report("Bulk");
+   }
+
+   /***************************************
+    * KERNELS
+    ***************************************/
+
+   // the sum of 1..37 over a 32 byte aligned array, at every level
+   void test_reduce_aligned()
+   {  // setup
+      custom::array<float, 37, 32> a;
+      setupFixture(a);
+      for (custom::bulk::cpu level : LEVELS)
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         float sum = custom::bulk::reduce(a);
+         // verify
+         assertUnit(sum == float(37 * 38 / 2));
+      }
+      restoreLevel();
+   }  // teardown
+
+   // the dot product of 1..37 with itself
+   void test_dot_aligned()
+   {  // setup
+      custom::array<float, 37, 32> a;
+      setupFixture(a);
+      for (custom::bulk::cpu level : LEVELS)
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         float sum = custom::bulk::dot(a, a);
+         // verify
+         assertUnit(sum == float(37 * 38 * 75 / 6));
+      }
+      restoreLevel();
+   }  // teardown
+
+   // y += 2x makes y three times 1..37
+   void test_axpy_aligned()
+   {
+      for (custom::bulk::cpu level : LEVELS)
+      {  // setup
+         custom::array<float, 37, 32> x;
+         custom::array<float, 37, 32> y;
+         setupFixture(x);
+         setupFixture(y);
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         custom::bulk::axpy(2.0f, x, y);
+         // verify
+         assertUnit(y[0] == 3.0f);
+         assertUnit(y[20] == 63.0f);
+         assertUnit(y[36] == 111.0f);
+      }
+      restoreLevel();
+   }  // teardown
+
+   // the smallest and largest of a shuffled int array
+   void test_minMax_int()
+   {  // setup
+      custom::array<int, 37> a;
+      for (size_t i = 0; i < a.size(); i++)
+         a[i] = int((i * 11) % 37);
+      for (custom::bulk::cpu level : LEVELS)
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         custom::bulk::indexed<int> smallest = custom::bulk::min_index(a);
+         custom::bulk::indexed<int> largest = custom::bulk::max_index(a);
+         // verify
+         assertUnit(smallest.value == 0);
+         assertUnit(smallest.index == 0);
+         assertUnit(largest.value == 36);
+         assertUnit(largest.index == 10);
+      }
+      restoreLevel();
+   }  // teardown
+
+   // a NaN past the front is skipped, as the scalar < skips it
+   void test_minMax_nanSkipped()
+   {  // setup
+      custom::array<float, 37, 32> a;
+      setupFixture(a);
+      a[5] = std::numeric_limits<float>::quiet_NaN();
+      a[36] = std::numeric_limits<float>::quiet_NaN();
+      for (custom::bulk::cpu level : LEVELS)
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         custom::bulk::indexed<float> smallest = custom::bulk::min_index(a);
+         custom::bulk::indexed<float> largest = custom::bulk::max_index(a);
+         // verify
+         assertUnit(smallest.value == 1.0f);
+         assertUnit(smallest.index == 0);
+         assertUnit(largest.value == 36.0f);
+         assertUnit(largest.index == 35);
+      }
+      restoreLevel();
+   }  // teardown
+
+   // a NaN in front is never beaten under <
+   void test_minMax_nanInFront()
+   {  // setup
+      custom::array<float, 37, 32> a;
+      setupFixture(a);
+      a[0] = std::numeric_limits<float>::quiet_NaN();
+      for (custom::bulk::cpu level : LEVELS)
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         custom::bulk::indexed<float> smallest = custom::bulk::min_index(a);
+         custom::bulk::indexed<float> largest = custom::bulk::max_index(a);
+         // verify
+         assertUnit(smallest.value != smallest.value);
+         assertUnit(smallest.index == 0);
+         assertUnit(largest.value != largest.value);
+         assertUnit(largest.index == 0);
+      }
+      restoreLevel();
+   }  // teardown
+
+   // count the elements above a threshold
+   void test_countIf_int()
+   {  // setup
+      custom::array<int, 37> a;
+      for (size_t i = 0; i < a.size(); i++)
+         a[i] = int(i);
+      for (custom::bulk::cpu level : LEVELS)
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         size_t count = custom::bulk::count_if(a, custom::bulk::compare::greater_equal, 30);
+         // verify
+         assertUnit(count == 7);
+      }
+      restoreLevel();
+   }  // teardown
+
+   /*************************************************************
+    * SETUP FIXTURE
+    * 1, 2, ... 37. 37 is not a multiple of any lane width,
+    * so every kernel runs its tail loop too
+    *************************************************************/
+   template <size_t Align>
+   void setupFixture(custom::array<float, 37, Align> & a)
+   {
+      for (size_t i = 0; i < a.size(); i++)
+         a[i] = float(i + 1);
+   }
+
+   // every level, from scalar up to AVX2
+   const custom::bulk::cpu LEVELS[3] =
+   {
+      custom::bulk::cpu::scalar, custom::bulk::cpu::sse41, custom::bulk::cpu::avx2
+   };
+
+   // go back to the best level this CPU has
+   void restoreLevel()
+   {
+      custom::bulk::setCpuLevel(custom::bulk::cpu::avx2);
+   }
+};
+
+#endif // DEBUG
@@ -0,0 +1,88 @@
+/***********************************************************************
+ * Source:
+ *    Bench Small Vector
+ * Summary:
+ *    Time many short-lived vectors. Each round builds a vector,
+ *    pushes a handful of ints onto it, sums them, and lets it go.
+ *    vector and std::vector touch the heap every round; small_vector
+ *    only does when the handful outgrows its inline room. The report
+ *    is nanoseconds per vector. Build the BenchSmallVector project
+ *    in Release, or:
+ *       g++ -O2 -std=c++14 benchSmallVector.cpp
+ * Author
+ *    Noah Li, Steven Sellers, Josh Hamilton.
+ ************************************************************************/
+
+#include "vector.h"         // for vector
+#include "small_vector.h"   // for small_vector
+
+#include <chrono>           // for steady_clock
+#include <cstddef>          // for size_t
+#include <iomanip>          // for setw and setprecision
+#include <iostream>         // for cout
+#include <vector>           // for std::vector, the yardstick
+
+const size_t NUM_VECTORS = 10000000;   // vectors built and thrown away
+const size_t INLINE_ROOM = 16;         // elements a small_vector holds inline
+
+/**********************************************************************
+ * SIZE AT
+ * How many elements the i'th vector gets: 1 .. maxSize, scrambled
+ * so the branch predictor cannot learn the loop lengths
+ ***********************************************************************/
+size_t sizeAt(size_t i, size_t maxSize)
+{
+   return (i * 7919) % maxSize + 1;
+}
+
+/**********************************************************************
+ * TIME ROUNDS
+ * Build, fill, sum, and destroy NUM_VECTORS vectors of up to maxSize
+ * elements. The sum is printed so the rounds cannot be optimized away
+ ***********************************************************************/
+template <class Vector>
+void timeRounds(const char * name, size_t maxSize)
+{
+   long long sum = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < NUM_VECTORS; i++)
+   {
+      Vector v;
+      size_t num = sizeAt(i, maxSize);
+      for (size_t j = 0; j < num; j++)
+         v.push_back(int(i + j));
+      for (size_t j = 0; j < v.size(); j++)
+         sum += v[j];
+   }
+   auto finish = std::chrono::steady_clock::now();
+
+   double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+   std::cout << std::left  << std::setw(28) << name
+             << std::right << std::setw(8)  << std::fixed << std::setprecision(2)
+             << ns / double(NUM_VECTORS) << " ns/vector"
+             << "   (sum " << sum << ")\n";
+}
+
+/**********************************************************************
+ * MAIN
+ * Time each vector once with every round fitting inline, and once
+ * with half the rounds spilling to the heap
+ ***********************************************************************/
+int main()
+{
+   typedef custom::small_vector<int, INLINE_ROOM> Small;
+
+   std::cout << NUM_VECTORS << " vectors, " << INLINE_ROOM << " elements inline\n";
+
+   std::cout << "up to " << INLINE_ROOM << " elements\n";
+   timeRounds<std::vector<int>>("std::vector", INLINE_ROOM);
+   timeRounds<custom::vector<int>>("vector", INLINE_ROOM);
+   timeRounds<Small>("small_vector", INLINE_ROOM);
+
+   std::cout << "up to " << INLINE_ROOM * 2 << " elements\n";
+   timeRounds<std::vector<int>>("std::vector", INLINE_ROOM * 2);
+   timeRounds<custom::vector<int>>("vector", INLINE_ROOM * 2);
+   timeRounds<Small>("small_vector", INLINE_ROOM * 2);
+
+   return 0;
+}
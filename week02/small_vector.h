@@ -0,0 +1,585 @@
+/***********************************************************************
+ * Header:
+ *    SMALL VECTOR
+ * Summary:
+ *    A vector that keeps its first few elements inside itself
+ *
+ *      __       ____       ____         __
+ *     /  |    .'    '.   .'    '.   _  / /
+ *     `| |   |  .--.  | |  .--.  | (_)/ /
+ *      | |   | |    | | | |    | |   / / _
+ *     _| |_  |  `--'  | |  `--'  |  / / (_)
+ *    |_____|  '.____.'   '.____.'  /_/
+ *
+ *
+ *    This will contain the class definition of:
+ *        small_vector           : A vector with N elements of inline room
+ *        small_vector::iterator : An interator through small_vector
+ * Author
+ *    Noah Li, Josh Hamilton & Steven Sellers
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>      // because I am paranoid. lol
+#include <cstring>      // for std::memcpy
+#include <new>          // std::bad_alloc and placement new
+#include <type_traits>  // for std::is_trivially_destructible
+#include <utility>      // for std::move, std::forward, and std::move_if_noexcept
+#include "vector.h"     // for the growth policies and is_trivially_relocatable
+
+class TestSmallVector; // forward declaration for unit tests
+
+namespace custom
+{
+
+/*****************************************
+ * SMALL VECTOR
+ * Just like custom::vector, but the first N elements live
+ * in a buffer inside the object. The heap is only touched
+ * when the vector grows past N.
+ ****************************************/
+template <typename T, size_t N, class Growth = growth_double>
+class small_vector
+{
+   static_assert(N > 0, "a small vector needs room for at least one element");
+
+   friend class ::TestSmallVector; // give unit tests access to the privates
+public:
+
+   //
+   // Construct
+   //
+
+   small_vector();
+   small_vector(size_t numElements                );
+   small_vector(size_t numElements, const T & t   );
+   small_vector(const std::initializer_list<T>& l );
+   small_vector(const small_vector &  rhs);
+   small_vector(      small_vector && rhs);
+   ~small_vector();
+
+   //
+   // Assign
+   //
+
+   void swap(small_vector& rhs);
+   small_vector & operator = (const small_vector & rhs);
+   small_vector & operator = (small_vector && rhs);
+
+   //
+   // Iterator
+   //
+
+   class iterator;
+   iterator       begin() { return iterator(data); }
+   iterator       end()   { return iterator(data + numElements); }
+
+   //
+   // Access
+   //
+
+         T& operator [] (size_t index)       { return data[index]; }
+   const T& operator [] (size_t index) const { return data[index]; }
+         T& front()                          { return data[0]; }
+   const T& front() const                    { return data[0]; }
+         T& back()                           { return data[numElements - 1]; }
+   const T& back() const                     { return data[numElements - 1]; }
+
+   //
+   // Insert
+   //
+
+   void push_back(const T& t) { emplace_back(t);            }
+   void push_back(T&& t)      { emplace_back(std::move(t)); }
+   template <class ... Args>
+   T& emplace_back(Args&& ... args);
+   void reserve(size_t newCapacity);
+   void resize(size_t newElements);
+   void resize(size_t newElements, const T& t);
+
+   //
+   // Remove
+   //
+
+   void clear();
+   void pop_back();
+   void shrink_to_fit();
+
+   //
+   // Status
+   //
+
+   size_t  size()          const { return numElements;}
+   size_t  capacity()      const { return numCapacity;}
+   bool empty()            const { return numElements == 0;}
+   bool isInline()         const { return data == inlineData(); }
+
+private:
+
+   // the inline buffer, raw until an element is built there
+   T *       inlineData()       { return reinterpret_cast<T *>(buffer);       }
+   const T * inlineData() const { return reinterpret_cast<const T *>(buffer); }
+
+   static void relocate(T * pSrc, size_t num, T * pDest);
+   static void endLives(T * p, size_t num);
+   void destroy(size_t indexBegin, size_t indexEnd);
+   void release();
+   void reallocate(size_t newCapacity);
+   void stealFrom(small_vector & rhs);
+
+   alignas(T) unsigned char buffer[N * sizeof(T)]; // room for the first N elements
+   T *  data;                 // the inline buffer or a dynamically-allocated array
+   size_t  numCapacity;       // the capacity of the array
+   size_t  numElements;       // the number of items currently used
+};
+
+/**************************************************
+ * SMALL VECTOR ITERATOR
+ * The same bi-directional iterator as vector::iterator
+ *************************************************/
+template <typename T, size_t N, class Growth>
+class small_vector <T, N, Growth> ::iterator
+{
+   friend class ::TestSmallVector; // give unit tests access to the privates
+public:
+   // constructors, destructors, and assignment operator
+   iterator()                           { this->p = nullptr; }
+   iterator(T* p)                       { this->p = p; }
+   iterator(const iterator& rhs)        { this->p = rhs.p; }
+   iterator(size_t index, small_vector& v) { this->p = &v[index]; }
+   iterator& operator = (const iterator& rhs)
+   {
+      this->p = rhs.p;
+      return *this;
+   }
+
+   // equals, not equals operator
+   bool operator != (const iterator& rhs) const { return this->p != rhs.p; }
+   bool operator == (const iterator& rhs) const { return this->p == rhs.p; }
+
+   // dereference operator
+   T& operator * ()
+   {
+      return *p;
+   }
+
+   // prefix increment
+   iterator& operator ++ ()
+   {
+      p++;
+      return *this;
+   }
+
+   // postfix increment
+   iterator operator ++ (int postfix)
+   {
+      iterator copy = *this;
+      p++;
+      return copy;
+   }
+
+   // prefix decrement
+   iterator& operator -- ()
+   {
+      p--;
+      return *this;
+   }
+
+   // postfix decrement
+   iterator operator -- (int postfix)
+   {
+      iterator copy = *this;
+      p--;
+      return copy;
+   }
+
+private:
+   T* p;
+};
+
+/*****************************************
+ * SMALL VECTOR :: DEFAULT constructor
+ * Start out in the inline buffer
+ ****************************************/
+template <typename T, size_t N, class Growth>
+small_vector <T, N, Growth> :: small_vector()
+{
+   data = inlineData();
+   numCapacity = N;
+   numElements = 0;
+}
+
+/*****************************************
+ * SMALL VECTOR :: NON-DEFAULT constructors
+ * Make room, then build each element in place
+ ****************************************/
+template <typename T, size_t N, class Growth>
+small_vector <T, N, Growth> :: small_vector(size_t num) : small_vector()
+{
+   resize(num);
+}
+
+template <typename T, size_t N, class Growth>
+small_vector <T, N, Growth> :: small_vector(size_t num, const T & t) : small_vector()
+{
+   resize(num, t);
+}
+
+/*****************************************
+ * SMALL VECTOR :: INITIALIZATION LIST constructor
+ ****************************************/
+template <typename T, size_t N, class Growth>
+small_vector <T, N, Growth> :: small_vector(const std::initializer_list<T> & l) : small_vector()
+{
+   reserve(l.size());
+   for (const T & it : l)
+      new (data + numElements++) T(it);
+}
+
+/*****************************************
+ * SMALL VECTOR :: COPY CONSTRUCTOR
+ * The copy only goes to the heap if it will not fit inline
+ ****************************************/
+template <typename T, size_t N, class Growth>
+small_vector <T, N, Growth> :: small_vector(const small_vector & rhs) : small_vector()
+{
+   reserve(rhs.numElements);
+   for (size_t i = 0; i < rhs.numElements; i++)
+      new (data + i) T(rhs.data[i]);
+   numElements = rhs.numElements;
+}
+
+/*****************************************
+ * SMALL VECTOR :: MOVE CONSTRUCTOR
+ * A heap buffer is stolen. Inline elements have to move
+ ****************************************/
+template <typename T, size_t N, class Growth>
+small_vector <T, N, Growth> :: small_vector(small_vector && rhs) : small_vector()
+{
+   stealFrom(rhs);
+}
+
+/*****************************************
+ * SMALL VECTOR :: DESTRUCTOR
+ ****************************************/
+template <typename T, size_t N, class Growth>
+small_vector <T, N, Growth> :: ~small_vector()
+{
+   destroy(0, numElements);
+   release();
+}
+
+/***************************************
+ * SMALL VECTOR :: ASSIGNMENT
+ * Assign over the elements we have and copy-construct the rest
+ **************************************/
+template <typename T, size_t N, class Growth>
+small_vector <T, N, Growth> & small_vector <T, N, Growth> :: operator = (const small_vector & rhs)
+{
+   if (this == &rhs)
+      return *this;
+
+   if (rhs.numElements > numCapacity)
+   {
+      clear();
+      reserve(rhs.numElements);
+   }
+
+   size_t numAssign = numElements < rhs.numElements ? numElements : rhs.numElements;
+   for (size_t i = 0; i < numAssign; i++)
+      data[i] = rhs.data[i];
+   for (size_t i = numAssign; i < rhs.numElements; i++)
+      new (data + i) T(rhs.data[i]);
+   destroy(rhs.numElements, numElements);
+   numElements = rhs.numElements;
+   return *this;
+}
+
+template <typename T, size_t N, class Growth>
+small_vector <T, N, Growth> & small_vector <T, N, Growth> :: operator = (small_vector && rhs)
+{
+   if (this == &rhs)
+      return *this;
+
+   clear();
+   release();
+   data = inlineData();
+   numCapacity = N;
+   stealFrom(rhs);
+   return *this;
+}
+
+/***************************************
+ * SMALL VECTOR :: SWAP
+ * Two heap buffers trade pointers. Otherwise at least one
+ * side is inline and the elements themselves have to move.
+ **************************************/
+template <typename T, size_t N, class Growth>
+void small_vector <T, N, Growth> :: swap(small_vector & rhs)
+{
+   if (this == &rhs)
+      return;
+
+   if (!isInline() && !rhs.isInline())
+   {
+      std::swap(data, rhs.data);
+      std::swap(numCapacity, rhs.numCapacity);
+      std::swap(numElements, rhs.numElements);
+      return;
+   }
+
+   small_vector temp(std::move(rhs));
+   rhs = std::move(*this);
+   *this = std::move(temp);
+}
+
+/***************************************
+ * SMALL VECTOR :: EMPLACE BACK
+ * Build a new element at the end. When the buffer is full
+ * the new element is built in the new buffer first, since
+ * the arguments may live in the old one.
+ **************************************/
+template <typename T, size_t N, class Growth>
+template <class ... Args>
+T & small_vector <T, N, Growth> :: emplace_back(Args&& ... args)
+{
+   if (numElements < numCapacity)
+   {
+      new (data + numElements++) T(std::forward<Args>(args)...);
+      return back();
+   }
+
+   size_t newCapacity = Growth::grow(numCapacity);
+   assert(newCapacity > numElements);
+   T * newData = static_cast<T *>(::operator new[](newCapacity * sizeof(T)));
+   bool isBuilt = false;   // is the new item in newData?
+   try
+   {
+      new (newData + numElements) T(std::forward<Args>(args)...);
+      isBuilt = true;
+      relocate(data, numElements, newData);
+   }
+   catch (...)
+   {
+      if (isBuilt)
+         newData[numElements].~T();
+      ::operator delete[](newData);
+      throw;
+   }
+   endLives(data, numElements);
+   release();
+   data = newData;
+   numCapacity = newCapacity;
+   numElements++;
+   return back();
+}
+
+/***************************************
+ * SMALL VECTOR :: RESERVE
+ * Move to a bigger heap buffer. Inline room
+ * is never given back here.
+ **************************************/
+template <typename T, size_t N, class Growth>
+void small_vector <T, N, Growth> :: reserve(size_t newCapacity)
+{
+   if (newCapacity > numCapacity)
+      reallocate(newCapacity);
+}
+
+/***************************************
+ * SMALL VECTOR :: RESIZE
+ * Grow or shrink to newElements
+ **************************************/
+template <typename T, size_t N, class Growth>
+void small_vector <T, N, Growth> :: resize(size_t newElements)
+{
+   if (newElements < numElements)
+      destroy(newElements, numElements);
+   else
+   {
+      reserve(newElements);
+      for (size_t i = numElements; i < newElements; i++)
+         new (data + i) T();
+   }
+   numElements = newElements;
+}
+
+template <typename T, size_t N, class Growth>
+void small_vector <T, N, Growth> :: resize(size_t newElements, const T & t)
+{
+   if (newElements < numElements)
+      destroy(newElements, numElements);
+   else
+   {
+      reserve(newElements);
+      for (size_t i = numElements; i < newElements; i++)
+         new (data + i) T(t);
+   }
+   numElements = newElements;
+}
+
+/***************************************
+ * SMALL VECTOR :: CLEAR
+ * Keeps the capacity, like vector::clear
+ **************************************/
+template <typename T, size_t N, class Growth>
+void small_vector <T, N, Growth> :: clear()
+{
+   destroy(0, numElements);
+   numElements = 0;
+}
+
+/***************************************
+ * SMALL VECTOR :: POP BACK
+ **************************************/
+template <typename T, size_t N, class Growth>
+void small_vector <T, N, Growth> :: pop_back()
+{
+   if (numElements > 0)
+   {
+      destroy(numElements - 1, numElements);
+      --numElements;
+   }
+}
+
+/***************************************
+ * SMALL VECTOR :: SHRINK TO FIT
+ * Come back inline when the elements fit there
+ **************************************/
+template <typename T, size_t N, class Growth>
+void small_vector <T, N, Growth> :: shrink_to_fit()
+{
+   if (isInline() || numCapacity == numElements)
+      return;
+
+   if (numElements <= N)
+   {
+      relocate(data, numElements, inlineData());
+      endLives(data, numElements);
+      release();
+      data = inlineData();
+      numCapacity = N;
+   }
+   else
+      reallocate(numElements);
+}
+
+/***************************************
+ * SMALL VECTOR :: RELOCATE
+ * Move num items into uninitialized room, copying
+ * any whose move might throw. The originals live on
+ * until endLives(). If one throws, the ones already
+ * built are destroyed and the originals are untouched.
+ **************************************/
+template <typename T, size_t N, class Growth>
+void small_vector <T, N, Growth> :: relocate(T * pSrc, size_t num, T * pDest)
+{
+   if (num == 0)
+      return;
+
+   if (is_trivially_relocatable<T>::value)
+   {
+      std::memcpy(static_cast<void *>(pDest), static_cast<const void *>(pSrc), num * sizeof(T));
+      return;
+   }
+
+   size_t i = 0;
+   try
+   {
+      for (; i < num; i++)
+         new (pDest + i) T(std::move_if_noexcept(pSrc[i]));
+   }
+   catch (...)
+   {
+      endLives(pDest, i);
+      throw;
+   }
+}
+
+/***************************************
+ * SMALL VECTOR :: END LIVES
+ * Destroy num items on either side of a relocate()
+ **************************************/
+template <typename T, size_t N, class Growth>
+void small_vector <T, N, Growth> :: endLives(T * p, size_t num)
+{
+   if (!is_trivially_relocatable<T>::value && !std::is_trivially_destructible<T>::value)
+      for (size_t i = 0; i < num; i++)
+         p[i].~T();
+}
+
+/***************************************
+ * SMALL VECTOR :: DESTROY
+ * Call the destructor on [indexBegin, indexEnd)
+ **************************************/
+template <typename T, size_t N, class Growth>
+void small_vector <T, N, Growth> :: destroy(size_t indexBegin, size_t indexEnd)
+{
+   if (!std::is_trivially_destructible<T>::value)
+      for (size_t i = indexBegin; i < indexEnd; i++)
+         data[i].~T();
+}
+
+/***************************************
+ * SMALL VECTOR :: RELEASE
+ * Free the heap buffer, if there is one. The
+ * elements must already be gone or moved out.
+ **************************************/
+template <typename T, size_t N, class Growth>
+void small_vector <T, N, Growth> :: release()
+{
+   if (!isInline())
+      ::operator delete[](data);
+}
+
+/***************************************
+ * SMALL VECTOR :: REALLOCATE
+ * Move the items into a heap buffer of newCapacity
+ **************************************/
+template <typename T, size_t N, class Growth>
+void small_vector <T, N, Growth> :: reallocate(size_t newCapacity)
+{
+   assert(newCapacity >= numElements && newCapacity > N);
+   T * newData = static_cast<T *>(::operator new[](newCapacity * sizeof(T)));
+   try
+   {
+      relocate(data, numElements, newData);
+   }
+   catch (...)
+   {
+      ::operator delete[](newData);
+      throw;
+   }
+   endLives(data, numElements);
+   release();
+   data = newData;
+   numCapacity = newCapacity;
+}
+
+/***************************************
+ * SMALL VECTOR :: STEAL FROM
+ * Take the elements of rhs into an empty, inline *this.
+ * rhs is left empty and inline.
+ **************************************/
+template <typename T, size_t N, class Growth>
+void small_vector <T, N, Growth> :: stealFrom(small_vector & rhs)
+{
+   assert(isInline() && numElements == 0);
+   if (rhs.isInline())
+   {
+      relocate(rhs.data, rhs.numElements, data);
+      endLives(rhs.data, rhs.numElements);
+   }
+   else
+   {
+      data = rhs.data;
+      numCapacity = rhs.numCapacity;
+      rhs.data = rhs.inlineData();
+      rhs.numCapacity = N;
+   }
+   numElements = rhs.numElements;
+   rhs.numElements = 0;
+}
+
+} // namespace custom
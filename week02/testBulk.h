@@ -0,0 +1,424 @@
+/***********************************************************************
+ * Header:
+ *    TEST BULK
+ * Summary:
+ *    Unit tests for the bulk kernels over custom::vector
+ * Author
+ *    Noah Li, Josh Hamilton & Steven Sellers
+ ************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG
+
+#include "bulk.h"
+#include "vector.h"
+#include "unitTest.h"
+
+#include <cassert>
+#include <limits>
+
+class TestBulk : public UnitTest
+{
+
+public:
+   void run()
+   {
+      reset();
+
+      // Reduce and dot
+      test_reduce_empty();
+      test_reduce_int();
+      test_reduce_float();
+      test_dot_int();
+      test_dot_float();
+
+      // Axpy
+      test_axpy_int();
+      test_axpy_float();
+
+      // Min and max
+      test_minIndex_int();
+      test_maxIndex_float();
+      test_minIndex_short();
+      test_maxIndex_firstOfTies();
+      test_minMaxIndex_nanSkipped();
+      test_minMaxIndex_nanFullLanes();
+      test_minMaxIndex_nanInFront();
+
+      // Count
+      test_countIf_int();
+      test_countIf_float();
+
+      // Other types
+      test_reduce_double();
+
+      // Dispatch
+      test_cpuLevel_lower();
+
+      report("Bulk");
+   }
+
+   /***************************************
+    * REDUCE DOT
+    ***************************************/
+
+   // the sum of nothing is zero
+   void test_reduce_empty()
+   {  // setup
+      custom::vector<int> v;
+      // exercise
+      int sum = custom::bulk::reduce(v);
+      // verify
+      assertUnit(sum == 0);
+   }  // teardown
+
+   // the sum of 1..37 at every level
+   void test_reduce_int()
+   {  // setup
+      custom::vector<int> v;
+      setupFixture(v, NUM);
+      for (custom::bulk::cpu level : levels())
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         int sum = custom::bulk::reduce(v);
+         // verify
+         assertUnit(sum == NUM * (NUM + 1) / 2);
+      }
+      restoreLevel();
+   }  // teardown
+
+   // whole floats add exactly in any order
+   void test_reduce_float()
+   {  // setup
+      custom::vector<float> v;
+      setupFixture(v, NUM);
+      for (custom::bulk::cpu level : levels())
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         float sum = custom::bulk::reduce(v);
+         // verify
+         assertUnit(sum == float(NUM * (NUM + 1) / 2));
+      }
+      restoreLevel();
+   }  // teardown
+
+   // the dot product of 1..37 with itself
+   void test_dot_int()
+   {  // setup
+      custom::vector<int> v;
+      setupFixture(v, NUM);
+      for (custom::bulk::cpu level : levels())
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         int sum = custom::bulk::dot(v, v);
+         // verify
+         assertUnit(sum == NUM * (NUM + 1) * (2 * NUM + 1) / 6);
+      }
+      restoreLevel();
+   }  // teardown
+
+   void test_dot_float()
+   {  // setup
+      custom::vector<float> v;
+      setupFixture(v, NUM);
+      for (custom::bulk::cpu level : levels())
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         float sum = custom::bulk::dot(v, v);
+         // verify
+         assertUnit(sum == float(NUM * (NUM + 1) * (2 * NUM + 1) / 6));
+      }
+      restoreLevel();
+   }  // teardown
+
+   /***************************************
+    * AXPY
+    ***************************************/
+
+   // y += 3x with x = y = 1..37 makes y = 4 * (1..37)
+   void test_axpy_int()
+   {
+      for (custom::bulk::cpu level : levels())
+      {  // setup
+         custom::vector<int> x;
+         custom::vector<int> y;
+         setupFixture(x, NUM);
+         setupFixture(y, NUM);
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         custom::bulk::axpy(3, x, y);
+         // verify
+         bool correct = true;
+         for (int i = 0; i < NUM; i++)
+            correct = correct && y[i] == 4 * (i + 1);
+         assertUnit(correct);
+         assertUnit(x[NUM - 1] == NUM);
+      }
+      restoreLevel();
+   }  // teardown
+
+   void test_axpy_float()
+   {
+      for (custom::bulk::cpu level : levels())
+      {  // setup
+         custom::vector<float> x;
+         custom::vector<float> y;
+         setupFixture(x, NUM);
+         setupFixture(y, NUM);
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         custom::bulk::axpy(0.5f, x, y);
+         // verify
+         bool correct = true;
+         for (int i = 0; i < NUM; i++)
+            correct = correct && y[i] == 1.5f * float(i + 1);
+         assertUnit(correct);
+      }
+      restoreLevel();
+   }  // teardown
+
+   /***************************************
+    * MIN MAX
+    ***************************************/
+
+   // the smallest value sits in the tail past the last full lane
+   void test_minIndex_int()
+   {  // setup
+      custom::vector<int> v;
+      setupFixture(v, NUM);
+      v[NUM - 2] = -5;
+      for (custom::bulk::cpu level : levels())
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         custom::bulk::indexed<int> result = custom::bulk::min_index(v);
+         // verify
+         assertUnit(result.value == -5);
+         assertUnit(result.index == NUM - 2);
+      }
+      restoreLevel();
+   }  // teardown
+
+   // the largest value sits in the middle
+   void test_maxIndex_float()
+   {  // setup
+      custom::vector<float> v;
+      setupFixture(v, NUM);
+      v[10] = 99.5f;
+      for (custom::bulk::cpu level : levels())
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         custom::bulk::indexed<float> result = custom::bulk::max_index(v);
+         // verify
+         assertUnit(result.value == 99.5f);
+         assertUnit(result.index == 10);
+      }
+      restoreLevel();
+   }  // teardown
+
+   // fewer elements than one lane fall back to the scalar loop
+   void test_minIndex_short()
+   {  // setup
+      custom::vector<int> v{ 26, 11, 49 };
+      // exercise
+      custom::bulk::indexed<int> result = custom::bulk::min_index(v);
+      // verify
+      assertUnit(result.value == 11);
+      assertUnit(result.index == 1);
+   }  // teardown
+
+   // the first of several equal largest values wins
+   void test_maxIndex_firstOfTies()
+   {  // setup
+      custom::vector<int> v;
+      setupFixture(v, NUM);
+      v[3] = 100;
+      v[20] = 100;
+      v[NUM - 1] = 100;
+      for (custom::bulk::cpu level : levels())
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         custom::bulk::indexed<int> result = custom::bulk::max_index(v);
+         // verify
+         assertUnit(result.value == 100);
+         assertUnit(result.index == 3);
+      }
+      restoreLevel();
+   }  // teardown
+
+   // a NaN past the front is skipped, as the scalar < skips it
+   void test_minMaxIndex_nanSkipped()
+   {  // setup
+      custom::vector<float> v;
+      setupFixture(v, NUM);
+      v[5] = std::numeric_limits<float>::quiet_NaN();
+      v[NUM - 1] = std::numeric_limits<float>::quiet_NaN();
+      for (custom::bulk::cpu level : levels())
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         custom::bulk::indexed<float> smallest = custom::bulk::min_index(v);
+         custom::bulk::indexed<float> largest = custom::bulk::max_index(v);
+         // verify
+         assertUnit(smallest.value == 1.0f);
+         assertUnit(smallest.index == 0);
+         assertUnit(largest.value == float(NUM - 1));
+         assertUnit(largest.index == NUM - 2);
+      }
+      restoreLevel();
+   }  // teardown
+
+   // sixteen floats fill every lane with no tail, one of them NaN
+   void test_minMaxIndex_nanFullLanes()
+   {  // setup
+      custom::vector<float> v;
+      setupFixture(v, 16);
+      v[9] = std::numeric_limits<float>::quiet_NaN();
+      for (custom::bulk::cpu level : levels())
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         custom::bulk::indexed<float> smallest = custom::bulk::min_index(v);
+         custom::bulk::indexed<float> largest = custom::bulk::max_index(v);
+         // verify
+         assertUnit(smallest.value == 1.0f);
+         assertUnit(smallest.index == 0);
+         assertUnit(largest.value == 16.0f);
+         assertUnit(largest.index == 15);
+      }
+      restoreLevel();
+   }  // teardown
+
+   // a NaN in front is never beaten under <
+   void test_minMaxIndex_nanInFront()
+   {  // setup
+      custom::vector<float> v;
+      setupFixture(v, NUM);
+      v[0] = std::numeric_limits<float>::quiet_NaN();
+      for (custom::bulk::cpu level : levels())
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise
+         custom::bulk::indexed<float> smallest = custom::bulk::min_index(v);
+         custom::bulk::indexed<float> largest = custom::bulk::max_index(v);
+         // verify
+         assertUnit(smallest.value != smallest.value);
+         assertUnit(smallest.index == 0);
+         assertUnit(largest.value != largest.value);
+         assertUnit(largest.index == 0);
+      }
+      restoreLevel();
+   }  // teardown
+
+   /***************************************
+    * COUNT IF
+    ***************************************/
+
+   // every comparison against 10 over 1..37
+   void test_countIf_int()
+   {  // setup
+      custom::vector<int> v;
+      setupFixture(v, NUM);
+      for (custom::bulk::cpu level : levels())
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise and verify
+         assertUnit(custom::bulk::count_if(v, custom::bulk::compare::less, 10) == 9);
+         assertUnit(custom::bulk::count_if(v, custom::bulk::compare::less_equal, 10) == 10);
+         assertUnit(custom::bulk::count_if(v, custom::bulk::compare::equal, 10) == 1);
+         assertUnit(custom::bulk::count_if(v, custom::bulk::compare::not_equal, 10) == NUM - 1);
+         assertUnit(custom::bulk::count_if(v, custom::bulk::compare::greater, 10) == NUM - 10);
+         assertUnit(custom::bulk::count_if(v, custom::bulk::compare::greater_equal, 10) == NUM - 9);
+      }
+      restoreLevel();
+   }  // teardown
+
+   void test_countIf_float()
+   {  // setup
+      custom::vector<float> v;
+      setupFixture(v, NUM);
+      for (custom::bulk::cpu level : levels())
+      {
+         custom::bulk::setCpuLevel(level);
+         // exercise and verify
+         assertUnit(custom::bulk::count_if(v, custom::bulk::compare::less, 10.5f) == 10);
+         assertUnit(custom::bulk::count_if(v, custom::bulk::compare::less_equal, 10.0f) == 10);
+         assertUnit(custom::bulk::count_if(v, custom::bulk::compare::equal, 10.0f) == 1);
+         assertUnit(custom::bulk::count_if(v, custom::bulk::compare::not_equal, 10.0f) == NUM - 1);
+         assertUnit(custom::bulk::count_if(v, custom::bulk::compare::greater, 10.5f) == NUM - 10);
+         assertUnit(custom::bulk::count_if(v, custom::bulk::compare::greater_equal, 10.0f) == NUM - 9);
+      }
+      restoreLevel();
+   }  // teardown
+
+   /***************************************
+    * OTHER TYPES
+    ***************************************/
+
+   // doubles take the scalar loop
+   void test_reduce_double()
+   {  // setup
+      custom::vector<double> v;
+      setupFixture(v, NUM);
+      // exercise
+      double sum = custom::bulk::reduce(v);
+      custom::bulk::indexed<double> result = custom::bulk::max_index(v);
+      // verify
+      assertUnit(sum == double(NUM * (NUM + 1) / 2));
+      assertUnit(result.value == double(NUM));
+      assertUnit(result.index == NUM - 1);
+   }  // teardown
+
+   /***************************************
+    * DISPATCH
+    ***************************************/
+
+   // the level can be lowered but never raised past the CPU
+   void test_cpuLevel_lower()
+   {  // setup
+      custom::bulk::cpu detected = custom::bulk::cpuDetected();
+      // exercise
+      custom::bulk::setCpuLevel(custom::bulk::cpu::scalar);
+      custom::bulk::cpu lowered = custom::bulk::cpuLevel();
+      custom::bulk::setCpuLevel(custom::bulk::cpu::avx2);
+      custom::bulk::cpu raised = custom::bulk::cpuLevel();
+      // verify
+      assertUnit(lowered == custom::bulk::cpu::scalar);
+      assertUnit(raised == detected);
+   }  // teardown
+
+   /***************************************************
+    * SETUP FIXTURE
+    * 1, 2, ... num. 37 is not a multiple of any lane
+    * width, so every kernel runs its tail loop too
+    ***************************************************/
+   enum { NUM = 37 };
+
+   template <class T>
+   void setupFixture(custom::vector<T> & v, int num)
+   {
+      for (int i = 1; i <= num; i++)
+         v.push_back(T(i));
+   }
+
+   // every level, from scalar up to AVX2
+   static custom::vector<custom::bulk::cpu> levels()
+   {
+      return { custom::bulk::cpu::scalar, custom::bulk::cpu::sse41, custom::bulk::cpu::avx2 };
+   }
+
+   // go back to the best level this CPU has
+   void restoreLevel()
+   {
+      custom::bulk::setCpuLevel(custom::bulk::cpu::avx2);
+   }
+};
+
+#endif // DEBUG
@@ -0,0 +1,360 @@
+/***********************************************************************
+ * Header:
+ *    TEST SMALL VECTOR
+ * Summary:
+ *    Unit tests for small_vector
+ * Author
+ *    Noah Li, Josh Hamilton & Steven Sellers
+ ************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG
+
+#include "small_vector.h"
+#include "spy.h"
+#include "unitTest.h"
+
+#include <cassert>
+#include <utility>
+
+class TestSmallVector : public UnitTest
+{
+
+public:
+   void run()
+   {
+      reset();
+
+      // Construct
+      test_construct_default();
+      test_construct_sizeInline();
+      test_construct_sizeSpill();
+      test_constructCopy_inline();
+      test_constructMove_inline();
+      test_constructMove_heap();
+
+      // Assign
+      test_assignMove_heapToInline();
+      test_swap_inlineHeap();
+
+      // Insert
+      test_pushback_inline();
+      test_pushback_spill();
+      test_pushback_spyNoAlloc();
+      test_pushback_spillThrowOnCopy();
+      test_resize_shrink();
+      test_reserve_inline();
+
+      // Remove
+      test_shrink_backInline();
+      test_shrink_staysHeap();
+
+      report("SmallVector");
+   }
+
+   /***************************************
+    * CONSTRUCTOR
+    ***************************************/
+
+   // default constructor uses the inline buffer
+   void test_construct_default()
+   {  // setup
+      // exercise
+      custom::small_vector<int, 4> v;
+      // verify
+      assertUnit(v.isInline());
+      assertUnit(v.numCapacity == 4);
+      assertUnit(v.numElements == 0);
+   }  // teardown
+
+   // four elements fit inline
+   void test_construct_sizeInline()
+   {  // setup
+      // exercise
+      custom::small_vector<int, 4> v(4, 7);
+      // verify
+      assertUnit(v.isInline());
+      assertUnit(v.numCapacity == 4);
+      assertUnit(v.numElements == 4);
+      assertUnit(v.data[0] == 7);
+      assertUnit(v.data[3] == 7);
+   }  // teardown
+
+   // six elements go to the heap
+   void test_construct_sizeSpill()
+   {  // setup
+      // exercise
+      custom::small_vector<int, 4> v(6);
+      // verify
+      assertUnit(!v.isInline());
+      assertUnit(v.numCapacity == 6);
+      assertUnit(v.numElements == 6);
+      assertUnit(v.data[5] == 0);
+   }  // teardown
+
+   // a copy of an inline vector is inline
+   void test_constructCopy_inline()
+   {  // setup
+      custom::small_vector<int, 4> vSrc{ 26, 49, 67 };
+      // exercise
+      custom::small_vector<int, 4> vDest(vSrc);
+      // verify
+      assertUnit(vDest.isInline());
+      assertUnit(vDest.data != vSrc.data);
+      assertUnit(vDest.numElements == 3);
+      assertUnit(vDest.data[0] == 26);
+      assertUnit(vDest.data[2] == 67);
+      assertUnit(vSrc.numElements == 3);
+   }  // teardown
+
+   // moving an inline vector moves each element
+   void test_constructMove_inline()
+   {  // setup
+      custom::small_vector<Spy, 4> vSrc;
+      vSrc.emplace_back(26);
+      vSrc.emplace_back(49);
+      Spy::reset();
+      // exercise
+      custom::small_vector<Spy, 4> vDest(std::move(vSrc));
+      // verify
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numCopyMove() == 2);
+      assertUnit(Spy::numAlloc() == 0);
+      assertUnit(vDest.isInline());
+      assertUnit(vDest.numElements == 2);
+      assertUnit(vDest.data[0].get() == 26);
+      assertUnit(vDest.data[1].get() == 49);
+      assertUnit(vSrc.isInline());
+      assertUnit(vSrc.numElements == 0);
+   }  // teardown
+
+   // moving a heap vector steals the buffer
+   void test_constructMove_heap()
+   {  // setup
+      custom::small_vector<Spy, 2> vSrc;
+      vSrc.emplace_back(26);
+      vSrc.emplace_back(49);
+      vSrc.emplace_back(67);
+      Spy * p = vSrc.data;
+      Spy::reset();
+      // exercise
+      custom::small_vector<Spy, 2> vDest(std::move(vSrc));
+      // verify
+      assertUnit(Spy::numCopyMove() == 0);
+      assertUnit(vDest.data == p);
+      assertUnit(vDest.numElements == 3);
+      assertUnit(vDest.numCapacity == 4);
+      assertUnit(vSrc.isInline());
+      assertUnit(vSrc.numCapacity == 2);
+      assertUnit(vSrc.numElements == 0);
+   }  // teardown
+
+   /***************************************
+    * ASSIGN
+    ***************************************/
+
+   // move a heap vector onto an inline one
+   void test_assignMove_heapToInline()
+   {  // setup
+      custom::small_vector<int, 2> vSrc{ 26, 49, 67 };
+      custom::small_vector<int, 2> vDest{ 11 };
+      int * p = vSrc.data;
+      // exercise
+      vDest = std::move(vSrc);
+      // verify
+      assertUnit(vDest.data == p);
+      assertUnit(vDest.numElements == 3);
+      assertUnit(vDest.data[2] == 67);
+      assertUnit(vSrc.isInline());
+      assertUnit(vSrc.numElements == 0);
+   }  // teardown
+
+   // swap an inline vector with a heap one
+   void test_swap_inlineHeap()
+   {  // setup
+      custom::small_vector<int, 2> vLeft{ 11 };
+      custom::small_vector<int, 2> vRight{ 26, 49, 67 };
+      // exercise
+      vLeft.swap(vRight);
+      // verify
+      assertUnit(!vLeft.isInline());
+      assertUnit(vLeft.numElements == 3);
+      assertUnit(vLeft.data[0] == 26);
+      assertUnit(vLeft.data[2] == 67);
+      assertUnit(vRight.isInline());
+      assertUnit(vRight.numElements == 1);
+      assertUnit(vRight.data[0] == 11);
+   }  // teardown
+
+   /***************************************
+    * INSERT
+    ***************************************/
+
+   // push into the inline buffer
+   void test_pushback_inline()
+   {  // setup
+      custom::small_vector<int, 4> v;
+      // exercise
+      v.push_back(26);
+      v.push_back(49);
+      // verify
+      assertUnit(v.isInline());
+      assertUnit(v.numCapacity == 4);
+      assertUnit(v.numElements == 2);
+      assertUnit(v.data[1] == 49);
+   }  // teardown
+
+   // push past the inline buffer. Capacity should double
+   void test_pushback_spill()
+   {  // setup
+      custom::small_vector<int, 4> v{ 26, 49, 67, 89 };
+      // exercise
+      v.push_back(v[0]);
+      // verify
+      assertUnit(!v.isInline());
+      assertUnit(v.numCapacity == 8);
+      assertUnit(v.numElements == 5);
+      assertUnit(v.data[0] == 26);
+      assertUnit(v.data[3] == 89);
+      assertUnit(v.data[4] == 26);
+   }  // teardown
+
+   // filling the inline buffer builds each element once and nothing else
+   void test_pushback_spyNoAlloc()
+   {  // setup
+      custom::small_vector<Spy, 4> v;
+      Spy::reset();
+      // exercise
+      for (int i = 0; i < 4; i++)
+         v.emplace_back(i);
+      // verify
+      assertUnit(Spy::numNondefault() == 4);
+      assertUnit(Spy::numDefault() == 0);
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numCopyMove() == 0);
+      assertUnit(v.isInline());
+      assertUnit(v.numElements == 4);
+   }  // teardown
+
+   // a copy that throws while spilling leaves the inline elements as they were
+   void test_pushback_spillThrowOnCopy()
+   {  // setup
+      ThrowOnCopy::live() = 0;
+      {
+         custom::small_vector<ThrowOnCopy, 4> v;
+         for (int i = 0; i < 4; i++)
+            v.emplace_back(i);
+         ThrowOnCopy::copiesLeft() = 3;
+         bool thrown = false;
+         // exercise
+         try
+         {
+            v.emplace_back(4);
+         }
+         catch (...)
+         {
+            thrown = true;
+         }
+         // verify
+         assertUnit(thrown);
+         assertUnit(v.isInline());
+         assertUnit(v.numCapacity == 4);
+         assertUnit(v.numElements == 4);
+         assertUnit(v.data[0].value == 0);
+         assertUnit(v.data[3].value == 3);
+         assertUnit(ThrowOnCopy::live() == 4);
+         ThrowOnCopy::copiesLeft() = -1;
+      }
+      assertUnit(ThrowOnCopy::live() == 0);
+   }  // teardown
+
+   // resize smaller destroys the tail
+   void test_resize_shrink()
+   {  // setup
+      custom::small_vector<Spy, 4> v;
+      v.emplace_back(26);
+      v.emplace_back(49);
+      v.emplace_back(67);
+      Spy::reset();
+      // exercise
+      v.resize(1);
+      // verify
+      assertUnit(Spy::numDestructor() == 2);
+      assertUnit(v.numElements == 1);
+      assertUnit(v.numCapacity == 4);
+      assertUnit(v.data[0].get() == 26);
+   }  // teardown
+
+   // reserving what fits inline does nothing
+   void test_reserve_inline()
+   {  // setup
+      custom::small_vector<int, 4> v{ 26 };
+      // exercise
+      v.reserve(3);
+      // verify
+      assertUnit(v.isInline());
+      assertUnit(v.numCapacity == 4);
+      assertUnit(v.data[0] == 26);
+   }  // teardown
+
+   /***************************************
+    * REMOVE
+    ***************************************/
+
+   // shrink a heap vector that fits inline again
+   void test_shrink_backInline()
+   {  // setup
+      custom::small_vector<int, 4> v{ 26, 49, 67, 89, 11 };
+      v.pop_back();
+      v.pop_back();
+      // exercise
+      v.shrink_to_fit();
+      // verify
+      assertUnit(v.isInline());
+      assertUnit(v.numCapacity == 4);
+      assertUnit(v.numElements == 3);
+      assertUnit(v.data[0] == 26);
+      assertUnit(v.data[2] == 67);
+   }  // teardown
+
+   // shrink a heap vector that is still too big for inline
+   void test_shrink_staysHeap()
+   {  // setup
+      custom::small_vector<int, 2> v{ 26, 49, 67 };
+      v.push_back(89);
+      v.push_back(11);
+      // exercise
+      v.shrink_to_fit();
+      // verify
+      assertUnit(!v.isInline());
+      assertUnit(v.numCapacity == 5);
+      assertUnit(v.numElements == 5);
+      assertUnit(v.data[4] == 11);
+   }  // teardown
+
+   /**************************************************************
+    * THROW ON COPY
+    * An int whose copy constructor throws when copiesLeft runs
+    * down to zero. With no move constructor, every relocation is
+    * a copy. live counts the ones in existence, so a leak shows
+    *************************************************************/
+   struct ThrowOnCopy
+   {
+      ThrowOnCopy(int value = 0) : value(value) { live()++; }
+      ThrowOnCopy(const ThrowOnCopy& rhs) : value(rhs.value)
+      {
+         if (--copiesLeft() == 0)
+            throw "ERROR: unable to copy";
+         live()++;
+      }
+      ThrowOnCopy& operator = (const ThrowOnCopy& rhs) = default;
+      ~ThrowOnCopy() { live()--; }
+
+      static int& live()       { static int num = 0;  return num; }
+      static int& copiesLeft() { static int num = -1; return num; }
+      int value;
+   };
+};
+
+#endif // DEBUG
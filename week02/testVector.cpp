@@ -13,6 +13,8 @@
  //#undef DEBUG  // Remove this comment to disable unit tests
 
 #include "testVector.h"     // for the vector unit tests
+#include "testSmallVector.h" // for the small vector unit tests
+#include "testBulk.h"       // for the bulk kernel unit tests
 #include "testSpy.h"        // for the spy unit tests
 int Spy::counters[] = {};
 
@@ -27,6 +29,8 @@ int main()
    // unit tests
    TestSpy().run();
    TestVector().run();
+   TestSmallVector().run();
+   TestBulk().run();
 #endif // DEBUG
    
    return 0;
@@ -13,6 +13,7 @@
 
 #include <vector>
 #include "vector.h"
+#include "spy.h"
 #include "unitTest.h"
 
 
@@ -87,6 +88,15 @@ public:
       test_pushback_moveEmpty();
       test_pushback_moveExcessCapacity();
       test_pushback_moveRequireReallocate();
+      test_pushback_growthHalf();
+      test_pushback_selfReallocate();
+      test_emplaceback_spyNoCopy();
+      test_emplaceback_requireReallocate();
+      test_emplace_middle();
+      test_emplace_end();
+      test_emplace_requireReallocate();
+      test_emplace_throwOnCopyItem();
+      test_emplace_throwOnCopyRelocate();
       test_resize_emptyZero();
       test_resize_emptyFourDefault();
       test_resize_emptyFourValue();
@@ -100,6 +110,8 @@ public:
       test_reserve_fourTen();
       test_reserve_standardZero();
       test_reserve_standardTen();
+      test_reserve_spyRelocate();
+      test_reserve_throwOnCopy();
 
       // Remove
       test_popback_empty();
@@ -543,10 +555,10 @@ public:
       // verify
       //      0    1    2    3    4    5
       //    +----+----+----+----+----+----+
-      //    | 26 | 49 | 67 | 89 |    |    |
+      //    | 26 | 49 | 67 | 89 | 00 | 00 |
       //    +----+----+----+----+----+----+
       assertUnit(v.numCapacity == 6);
-      assertUnit(v.numElements == 4);
+      assertUnit(v.numElements == 6);
       
       if (v.data)
       {
@@ -735,6 +747,61 @@ public:
       // teardown
       teardownStandardFixture(v);
    }
+
+   // reserve moves the items over and builds nothing in the spare room
+   void test_reserve_spyRelocate()
+   {  // setup
+      custom::vector<Spy> v;
+      v.push_back(Spy(26));
+      v.push_back(Spy(49));
+      Spy::reset();
+      // exercise
+      v.reserve(10);
+      // verify
+      assertUnit(Spy::numDefault() == 0);
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numCopyMove() == 2);
+      assertUnit(Spy::numDestructor() == 2);
+      assertUnit(Spy::numAlloc() == 0);
+      assertUnit(v.numCapacity == 10);
+      assertUnit(v.numElements == 2);
+      if (v.data && v.numElements == 2)
+      {
+         assertUnit(v.data[0] == Spy(26));
+         assertUnit(v.data[1] == Spy(49));
+      }
+   }  // teardown
+
+   // a copy that throws midway leaves the old buffer as it was
+   void test_reserve_throwOnCopy()
+   {  // setup
+      ThrowOnCopy::live() = 0;
+      {
+         custom::vector<ThrowOnCopy> v;
+         setupThrowOnCopyFixture(v);
+         ThrowOnCopy * pData = v.data;
+         ThrowOnCopy::copiesLeft() = 3;
+         bool thrown = false;
+         // exercise
+         try
+         {
+            v.reserve(10);
+         }
+         catch (...)
+         {
+            thrown = true;
+         }
+         // verify
+         assertUnit(thrown);
+         assertUnit(v.data == pData);
+         assertUnit(v.numCapacity == 4);
+         assertUnit(ThrowOnCopy::live() == 4);
+         assertStandardFixture(v);
+         ThrowOnCopy::copiesLeft() = -1;
+      }
+      assertUnit(ThrowOnCopy::live() == 0);
+   }  // teardown
    
    // shrink an empty fixture
    void test_shrink_empty()
@@ -1844,6 +1911,253 @@ public:
       // teardown
       teardownStandardFixture(v);
    }
+
+   // add an element to a full vector that grows by half
+   void test_pushback_growthHalf()
+   {  // setup
+      //      0    1    2    3
+      //    +----+----+----+----+
+      //    | 26 | 49 | 67 | 89 |
+      //    +----+----+----+----+
+      custom::vector<int, custom::growth_half> v;
+      v.data = new int[4];
+      v.data[0] = 26;
+      v.data[1] = 49;
+      v.data[2] = 67;
+      v.data[3] = 89;
+      v.numElements = 4;
+      v.numCapacity = 4;
+      // exercise
+      v.push_back(99);
+      // verify
+      //      0    1    2    3    4    5
+      //    +----+----+----+----+----+----+
+      //    | 26 | 49 | 67 | 89 | 99 |    |
+      //    +----+----+----+----+----+----+
+      assertUnit(v.numCapacity == 6);
+      assertUnit(v.numElements == 5);
+      if (v.data && v.numElements == 5)
+      {
+         assertUnit(v.data[0] == 26);
+         assertUnit(v.data[3] == 89);
+         assertUnit(v.data[4] == 99);
+      }
+   }  // teardown
+
+   // add an element of the vector itself when there is not room
+   void test_pushback_selfReallocate()
+   {  // setup
+      //      0    1    2    3
+      //    +----+----+----+----+
+      //    | 26 | 49 | 67 | 89 |
+      //    +----+----+----+----+
+      custom::vector<int> v;
+      setupStandardFixture(v);
+      // exercise
+      v.push_back(v.data[0]);
+      // verify
+      //      0    1    2    3    4    5    6    7
+      //    +----+----+----+----+----+----+----+----+
+      //    | 26 | 49 | 67 | 89 | 26 |    |    |    |
+      //    +----+----+----+----+----+----+----+----+
+      assertUnit(v.numCapacity == 8);
+      assertUnit(v.numElements == 5);
+      if (v.data && v.numElements == 5)
+         assertUnit(v.data[4] == 26);
+      v.numCapacity = 4;
+      v.numElements = 4;
+      assertStandardFixture(v);
+   }  // teardown
+
+   // build an element in place at the back when there is room
+   void test_emplaceback_spyNoCopy()
+   {  // setup
+      custom::vector<Spy> v;
+      v.reserve(4);
+      Spy::reset();
+      // exercise
+      Spy & s = v.emplace_back(99);
+      // verify
+      assertUnit(Spy::numNondefault() == 1);
+      assertUnit(Spy::numDefault() == 0);
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numCopyMove() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numAssignMove() == 0);
+      assertUnit(&s == v.data);
+      assertUnit(v.numCapacity == 4);
+      assertUnit(v.numElements == 1);
+      if (v.data && v.numElements == 1)
+         assertUnit(v.data[0].get() == 99);
+   }  // teardown
+
+   // build an element at the back when there is not room. Capacity should double
+   void test_emplaceback_requireReallocate()
+   {  // setup
+      //      0    1    2    3
+      //    +----+----+----+----+
+      //    | 26 | 49 | 67 | 89 |
+      //    +----+----+----+----+
+      custom::vector<int> v;
+      setupStandardFixture(v);
+      // exercise
+      v.emplace_back(99);
+      // verify
+      //      0    1    2    3    4    5    6    7
+      //    +----+----+----+----+----+----+----+----+
+      //    | 26 | 49 | 67 | 89 | 99 |    |    |    |
+      //    +----+----+----+----+----+----+----+----+
+      assertUnit(v.numCapacity == 8);
+      assertUnit(v.numElements == 5);
+      if (v.data && v.numElements == 5)
+         assertUnit(v.data[4] == 99);
+      v.numCapacity = 4;
+      v.numElements = 4;
+      assertStandardFixture(v);
+   }  // teardown
+
+   // build an element in the middle when there is room
+   void test_emplace_middle()
+   {  // setup
+      //      0    1    2    3
+      //    +----+----+----+----+
+      //    | 26 | 49 | 67 |    |
+      //    +----+----+----+----+
+      custom::vector<int> v;
+      v.data = new int[4];
+      v.data[0] = 26;
+      v.data[1] = 49;
+      v.data[2] = 67;
+      v.numElements = 3;
+      v.numCapacity = 4;
+      // exercise
+      custom::vector<int>::iterator it = v.emplace(custom::vector<int>::iterator(1, v), 99);
+      // verify
+      //      0    1    2    3
+      //    +----+----+----+----+
+      //    | 26 | 99 | 49 | 67 |
+      //    +----+----+----+----+
+      assertUnit(it.p == v.data + 1);
+      assertUnit(v.numCapacity == 4);
+      assertUnit(v.numElements == 4);
+      if (v.data && v.numElements == 4)
+      {
+         assertUnit(v.data[0] == 26);
+         assertUnit(v.data[1] == 99);
+         assertUnit(v.data[2] == 49);
+         assertUnit(v.data[3] == 67);
+      }
+   }  // teardown
+
+   // build an element at end() the same as emplace_back
+   void test_emplace_end()
+   {  // setup
+      custom::vector<Spy> v;
+      v.reserve(2);
+      v.emplace_back(26);
+      Spy::reset();
+      // exercise
+      v.emplace(v.end(), 49);
+      // verify
+      assertUnit(Spy::numNondefault() == 1);
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numCopyMove() == 0);
+      assertUnit(Spy::numAssignMove() == 0);
+      assertUnit(v.numElements == 2);
+      if (v.data && v.numElements == 2)
+      {
+         assertUnit(v.data[0].get() == 26);
+         assertUnit(v.data[1].get() == 49);
+      }
+   }  // teardown
+
+   // build an element at the front when there is not room
+   void test_emplace_requireReallocate()
+   {  // setup
+      //      0    1    2    3
+      //    +----+----+----+----+
+      //    | 26 | 49 | 67 | 89 |
+      //    +----+----+----+----+
+      custom::vector<int> v;
+      setupStandardFixture(v);
+      // exercise
+      v.emplace(v.begin(), v.data[3]);
+      // verify
+      //      0    1    2    3    4    5    6    7
+      //    +----+----+----+----+----+----+----+----+
+      //    | 89 | 26 | 49 | 67 | 89 |    |    |    |
+      //    +----+----+----+----+----+----+----+----+
+      assertUnit(v.numCapacity == 8);
+      assertUnit(v.numElements == 5);
+      if (v.data && v.numElements == 5)
+      {
+         assertUnit(v.data[0] == 89);
+         assertUnit(v.data[1] == 26);
+         assertUnit(v.data[4] == 89);
+      }
+   }  // teardown
+
+   // building the new item throws when there is not room
+   void test_emplace_throwOnCopyItem()
+   {  // setup
+      ThrowOnCopy::live() = 0;
+      {
+         custom::vector<ThrowOnCopy> v;
+         setupThrowOnCopyFixture(v);
+         ThrowOnCopy * pData = v.data;
+         ThrowOnCopy item(99);
+         ThrowOnCopy::copiesLeft() = 1;
+         bool thrown = false;
+         // exercise
+         try
+         {
+            v.emplace(custom::vector<ThrowOnCopy>::iterator(2, v), item);
+         }
+         catch (...)
+         {
+            thrown = true;
+         }
+         // verify
+         assertUnit(thrown);
+         assertUnit(v.data == pData);
+         assertUnit(v.numCapacity == 4);
+         assertUnit(ThrowOnCopy::live() == 5);
+         assertStandardFixture(v);
+         ThrowOnCopy::copiesLeft() = -1;
+      }
+      assertUnit(ThrowOnCopy::live() == 0);
+   }  // teardown
+
+   // moving the items around the new one throws when there is not room
+   void test_emplace_throwOnCopyRelocate()
+   {  // setup
+      ThrowOnCopy::live() = 0;
+      {
+         custom::vector<ThrowOnCopy> v;
+         setupThrowOnCopyFixture(v);
+         ThrowOnCopy * pData = v.data;
+         ThrowOnCopy item(99);
+         ThrowOnCopy::copiesLeft() = 5;
+         bool thrown = false;
+         // exercise
+         try
+         {
+            v.emplace(custom::vector<ThrowOnCopy>::iterator(2, v), item);
+         }
+         catch (...)
+         {
+            thrown = true;
+         }
+         // verify
+         assertUnit(thrown);
+         assertUnit(v.data == pData);
+         assertUnit(v.numCapacity == 4);
+         assertUnit(ThrowOnCopy::live() == 5);
+         assertStandardFixture(v);
+         ThrowOnCopy::copiesLeft() = -1;
+      }
+      assertUnit(ThrowOnCopy::live() == 0);
+   }  // teardown
    
    
    /***************************************
@@ -2092,6 +2406,59 @@ public:
       }
    }
    
+   /**************************************************************
+    * THROW ON COPY
+    * An int whose copy constructor throws when copiesLeft runs
+    * down to zero. With no move constructor, every relocation is
+    * a copy. live counts the ones in existence, so a leak shows
+    *************************************************************/
+   struct ThrowOnCopy
+   {
+      ThrowOnCopy(int value = 0) : value(value) { live()++; }
+      ThrowOnCopy(const ThrowOnCopy& rhs) : value(rhs.value)
+      {
+         if (--copiesLeft() == 0)
+            throw "ERROR: unable to copy";
+         live()++;
+      }
+      ThrowOnCopy& operator = (const ThrowOnCopy& rhs) = default;
+      ~ThrowOnCopy() { live()--; }
+
+      static int& live()       { static int num = 0;  return num; }
+      static int& copiesLeft() { static int num = -1; return num; }
+      int value;
+   };
+
+   /*************************************************************
+    * SETUP THROW ON COPY FIXTURE
+    *    +----+----+----+----+
+    *    | 26 | 49 | 67 | 89 |
+    *    +----+----+----+----+
+    *************************************************************/
+   void setupThrowOnCopyFixture(custom::vector<ThrowOnCopy>& v)
+   {
+      v.reserve(4);
+      v.emplace_back(26);
+      v.emplace_back(49);
+      v.emplace_back(67);
+      v.emplace_back(89);
+   }
+
+   /*************************************************************
+    * VERIFY THROW ON COPY FIXTURE PARAMETERS
+    *************************************************************/
+   void assertStandardFixtureParameters(const custom::vector<ThrowOnCopy>& v, int line, const char* function)
+   {
+      assertIndirect(v.numElements == 4);
+      if (v.data != nullptr && v.numElements == 4)
+      {
+         assertIndirect(v.data[0].value == 26);
+         assertIndirect(v.data[1].value == 49);
+         assertIndirect(v.data[2].value == 67);
+         assertIndirect(v.data[3].value == 89);
+      }
+   }
+
    /*************************************************************
     * VERIFY EMPTY FIXTURE PARAMETERS
     *************************************************************/
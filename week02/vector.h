@@ -15,15 +15,20 @@
  *    This will contain the class definition of:
  *        vector                 : A class that represents a Vector
  *        vector::iterator       : An interator through Vector
+ *        growth_double          : Grow the buffer by 2x
+ *        growth_half            : Grow the buffer by 1.5x
  * Author
  *    Noah Li, Josh Hamilton & Steven Sellers
  ************************************************************************/
 
 #pragma once
 
-#include <cassert>  // because I am paranoid. lol
-#include <new>      // std::bad_alloc
-#include <memory>   // for std::allocator
+#include <cassert>      // because I am paranoid. lol
+#include <cstring>      // for std::memcpy
+#include <new>          // std::bad_alloc and placement new
+#include <memory>       // for std::allocator
+#include <type_traits>  // for std::is_trivially_copyable
+#include <utility>      // for std::move and std::move_if_noexcept
 
 class TestVector; // forward declaration for unit tests
 class TestStack;
@@ -33,11 +38,44 @@ class TestHash;
 namespace custom
 {
 
+/*****************************************
+ * GROWTH POLICIES
+ * How big the buffer becomes when push_back runs out of room.
+ * Doubling copies each item about once. Growing by half copies
+ * a little more, but the old blocks add up to enough room for
+ * a later buffer, so the allocator can reuse them.
+ ****************************************/
+struct growth_double
+{
+   static size_t grow(size_t numCapacity)
+   {
+      return numCapacity == 0 ? 1 : numCapacity * 2;
+   }
+};
+
+struct growth_half
+{
+   static size_t grow(size_t numCapacity)
+   {
+      return numCapacity < 2 ? numCapacity + 1 : numCapacity + numCapacity / 2;
+   }
+};
+
+/*****************************************
+ * IS TRIVIALLY RELOCATABLE
+ * Can an item be moved to a new buffer with memcpy, leaving the
+ * old bytes behind without calling the destructor? True for
+ * trivially copyable types. Specialize it for a type that owns a
+ * pointer but does not point back into itself.
+ ****************************************/
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
 /*****************************************
  * VECTOR
  * Just like the std :: vector <T> class
  ****************************************/
-template <typename T>
+template <typename T, class Growth = growth_double>
 class vector
 {
    friend class ::TestVector; // give unit tests access to the privates
@@ -45,8 +83,8 @@ class vector
    friend class ::TestPQueue;
    friend class ::TestHash;
 public:
-   
-   // 
+
+   //
    // Construct
    //
 
@@ -68,12 +106,12 @@ public:
       T* tempData = this->data;
       size_t tempNumCapacity = this->numCapacity;
       size_t tempNumElements = this->numElements;
-      
+
       // Set this values to rhs
       this->data = rhs.data;
       this->numCapacity = rhs.numCapacity;
       this->numElements = rhs.numElements;
-      
+
       // Set rhs values to temp
       rhs.data = tempData;
       rhs.numCapacity = tempNumCapacity;
@@ -107,6 +145,10 @@ public:
 
    void push_back(const T& t);
    void push_back(T&& t);
+   template <class ... Args>
+   T& emplace_back(Args&& ... args);
+   template <class ... Args>
+   iterator emplace(iterator it, Args&& ... args);
    void reserve(size_t newCapacity);
    void resize(size_t newElements);
    void resize(size_t newElements, const T& t);
@@ -126,13 +168,19 @@ public:
    size_t  size()          const { return numElements;}
    size_t  capacity()      const { return numCapacity;}
    bool empty()            const { return numElements == 0;}
-   
-   // adjust the size of the buffer
-   
-   // vector-specific interfaces
-   
+
 private:
-   
+
+   // raw storage: nothing is constructed in the unused capacity
+   static T * allocate(size_t num);
+   static void deallocate(T * p) { ::operator delete[](p); }
+   static void relocate(T * pSrc, size_t num, T * pDest);
+   static void endLives(T * p, size_t num);
+   void destroy(size_t indexBegin, size_t indexEnd);
+   void reallocate(size_t newCapacity);
+   template <class ... Args>
+   void emplaceGrow(size_t index, Args&& ... args);
+
    T *  data;                 // user data, a dynamically-allocated array
    size_t  numCapacity;       // the capacity of the array
    size_t  numElements;       // the number of items currently used
@@ -149,22 +197,23 @@ private:
  * This particular iterator is a bi-directional meaning
  * that ++ and -- both work.  Not all iterators are that way.
  *************************************************/
-template <typename T>
-class vector <T> ::iterator
+template <typename T, class Growth>
+class vector <T, Growth> ::iterator
 {
    friend class ::TestVector; // give unit tests access to the privates
    friend class ::TestStack;
    friend class ::TestPQueue;
    friend class ::TestHash;
+   friend class vector;       // emplace needs the position
 public:
    // constructors, destructors, and assignment operator
    iterator()                           { this->p = nullptr; }
    iterator(T* p)                       { this->p = p; }
    iterator(const iterator& rhs)        { this->p = rhs.p; }
-   iterator(size_t index, vector<T>& v) { this->p = &v[index]; }
+   iterator(size_t index, vector& v)    { this->p = &v[index]; }
    iterator& operator = (const iterator& rhs)
    {
-      this->p = new T;
+      this->p = rhs.p;
       return *this;
    }
 
@@ -217,12 +266,10 @@ private:
  * Default constructor: set the number of elements,
  * construct each element, and copy the values over
  ****************************************/
-template <typename T>
-vector <T> :: vector()
+template <typename T, class Growth>
+vector <T, Growth> :: vector()
+   : data(nullptr), numCapacity(0), numElements(0)
 {
-   data = nullptr;
-   numCapacity = 0;
-   numElements = 0;
 }
 
 /*****************************************
@@ -230,21 +277,13 @@ vector <T> :: vector()
  * non-default constructor: set the number of elements,
  * construct each element, and copy the values over
  ****************************************/
-template <typename T>
-vector <T> :: vector(size_t num, const T & t) 
+template <typename T, class Growth>
+vector <T, Growth> :: vector(size_t num, const T & t)
+   : data(nullptr), numCapacity(0), numElements(0)
 {
-   if (num == 0)
-   {
-      data = nullptr;
-   }
-   else
-   {
-      data = new T[num];
-      for (int i = 0; i < num; i++)
-      {
-         data[i] = t;
-      }
-   }
+   data = allocate(num);
+   for (size_t i = 0; i < num; i++)
+      new (data + i) T(t);
    numCapacity = num;
    numElements = num;
 }
@@ -253,22 +292,14 @@ vector <T> :: vector(size_t num, const T & t)
  * VECTOR :: INITIALIZATION LIST constructors
  * Create a vector with an initialization list.
  ****************************************/
-template <typename T>
-vector <T> :: vector(const std::initializer_list<T> & l) 
+template <typename T, class Growth>
+vector <T, Growth> :: vector(const std::initializer_list<T> & l)
+   : data(nullptr), numCapacity(0), numElements(0)
 {
-   if (l.size() == 0)
-   {
-      data = nullptr;
-   }
-   else
-   {
-      data = new T[l.size()];
-      int i = 0;
-      for (T it : l)
-      {
-         data[i++] = it;
-      }
-   }
+   data = allocate(l.size());
+   size_t i = 0;
+   for (const T & it : l)
+      new (data + i++) T(it);
    numElements = l.size();
    numCapacity = l.size();
 }
@@ -278,21 +309,13 @@ vector <T> :: vector(const std::initializer_list<T> & l)
  * non-default constructor: set the number of elements,
  * construct each element, and copy the values over
  ****************************************/
-template <typename T>
-vector <T> :: vector(size_t num) 
+template <typename T, class Growth>
+vector <T, Growth> :: vector(size_t num)
+   : data(nullptr), numCapacity(0), numElements(0)
 {
-   if (num == 0)
-   {
-      data = nullptr;
-   }
-   else
-   {
-      data = new T[num];
-      for (int i = 0; i < num; i++)
-      {
-         data[i] = 0;
-      }
-   }
+   data = allocate(num);
+   for (size_t i = 0; i < num; i++)
+      new (data + i) T();
    numCapacity = num;
    numElements = num;
 }
@@ -302,21 +325,13 @@ vector <T> :: vector(size_t num)
  * Allocate the space for numElements and
  * call the copy constructor on each element
  ****************************************/
-template <typename T>
-vector <T> :: vector (const vector & rhs) 
+template <typename T, class Growth>
+vector <T, Growth> :: vector (const vector & rhs)
+   : data(nullptr), numCapacity(0), numElements(0)
 {
-   if (rhs.numElements == 0)
-   {
-      data = nullptr;
-   }
-   else
-   {
-      data = new T[rhs.numElements];
-      for (int i = 0; i < rhs.numElements; i++)
-      {
-         data[i] = rhs.data[i];
-      }
-   }
+   data = allocate(rhs.numElements);
+   for (size_t i = 0; i < rhs.numElements; i++)
+      new (data + i) T(rhs.data[i]);
    numCapacity = rhs.numElements;
    numElements = rhs.numElements;
 }
@@ -325,17 +340,10 @@ vector <T> :: vector (const vector & rhs)
  * VECTOR :: MOVE CONSTRUCTOR
  * Steal the values from the RHS and set it to zero.
  ****************************************/
-template <typename T>
-vector <T> :: vector (vector && rhs)
+template <typename T, class Growth>
+vector <T, Growth> :: vector (vector && rhs)
 {
-   if (rhs.numCapacity == 0)
-   {
-      data = nullptr;
-   }
-   else
-   {
-      data = rhs.data;
-   }
+   data = rhs.data;
    numCapacity = rhs.numCapacity;
    numElements = rhs.numElements;
 
@@ -349,10 +357,11 @@ vector <T> :: vector (vector && rhs)
  * Call the destructor for each element from 0..numElements
  * and then free the memory
  ****************************************/
-template <typename T>
-vector <T> :: ~vector()
+template <typename T, class Growth>
+vector <T, Growth> :: ~vector()
 {
-   
+   destroy(0, numElements);
+   deallocate(data);
 }
 
 /***************************************
@@ -362,46 +371,34 @@ vector <T> :: ~vector()
  *     INPUT  : newCapacity the size of the new buffer
  *     OUTPUT :
  **************************************/
-template <typename T>
-void vector <T> :: resize(size_t newElements)
+template <typename T, class Growth>
+void vector <T, Growth> :: resize(size_t newElements)
 {
-   if (newElements == 0)
-   {
-      numElements = 0;
-   }
+   if (newElements < numElements)
+      destroy(newElements, numElements);
    else
    {
-      numCapacity = newElements;
-      T* newData = new T[numCapacity];
-      for (int i = 0; i < numCapacity; i++)
-      {
-         if (i < numElements)
-            newData[i] = data[i];
-         else
-            newData[i] = 0;
-      }
-      
-      data = newData;
+      if (newElements > numCapacity)
+         reallocate(newElements);
+      for (size_t i = numElements; i < newElements; i++)
+         new (data + i) T();
    }
+   numElements = newElements;
 }
 
-template <typename T>
-void vector <T> :: resize(size_t newElements, const T & t)
+template <typename T, class Growth>
+void vector <T, Growth> :: resize(size_t newElements, const T & t)
 {
-   if (newElements > 0)
+   if (newElements < numElements)
+      destroy(newElements, numElements);
+   else
    {
-      numCapacity = newElements;
-      T* newData = new T[numCapacity];
-      for (int i = 0; i < numCapacity; i++)
-      {
-         if (i < numElements)
-            newData[i] = data[i];
-         else
-            newData[i] = t;
-      }
-      numElements = newElements;
-      data = newData;
+      if (newElements > numCapacity)
+         reallocate(newElements);
+      for (size_t i = numElements; i < newElements; i++)
+         new (data + i) T(t);
    }
+   numElements = newElements;
 }
 
 /***************************************
@@ -412,13 +409,11 @@ void vector <T> :: resize(size_t newElements, const T & t)
  *     INPUT  : newCapacity the size of the new buffer
  *     OUTPUT :
  **************************************/
-template <typename T>
-void vector <T> :: reserve(size_t newCapacity)
+template <typename T, class Growth>
+void vector <T, Growth> :: reserve(size_t newCapacity)
 {
    if (newCapacity > numCapacity)
-   {
-      numCapacity = newCapacity;
-   }
+      reallocate(newCapacity);
 }
 
 /***************************************
@@ -427,26 +422,17 @@ void vector <T> :: reserve(size_t newCapacity)
  *     INPUT  :
  *     OUTPUT :
  **************************************/
-template <typename T>
-void vector <T> :: shrink_to_fit()
+template <typename T, class Growth>
+void vector <T, Growth> :: shrink_to_fit()
 {
    if (numElements == 0)
    {
-      delete[] data;
+      deallocate(data);
       data = nullptr;
       numCapacity = 0;
    }
-   else if (numCapacity > numElements) 
-   {
-      T* newData = new T[numElements];
-      for (size_t i = 0; i < numElements; i++) 
-      {
-         newData[i] = data[i];
-      }
-      delete[] data;
-      data = newData;
-      numCapacity = numElements; // Update capacity
-   }
+   else if (numCapacity > numElements)
+      reallocate(numElements);
 }
 
 /***************************************
@@ -455,18 +441,13 @@ void vector <T> :: shrink_to_fit()
  *     INPUT  :
  *     OUTPUT :
  **************************************/
-template <typename T>
-void vector <T> :: pop_back()
+template <typename T, class Growth>
+void vector <T, Growth> :: pop_back()
 {
    if (numElements > 0)
    {
+      destroy(numElements - 1, numElements);
       --numElements;
-      if (numElements == 0)
-      {
-         delete[] data;
-         data = nullptr;
-         numCapacity = 0;
-      }
    }
 }
 
@@ -476,20 +457,19 @@ void vector <T> :: pop_back()
  *     INPUT  :
  *     OUTPUT :
  **************************************/
-template <typename T>
-void vector <T> :: clear()
+template <typename T, class Growth>
+void vector <T, Growth> :: clear()
 {
-      numElements = 0;
+   destroy(0, numElements);
+   numElements = 0;
 }
 
-
-
 /*****************************************
  * VECTOR :: SUBSCRIPT
  * Read-Write access
  ****************************************/
-template <typename T>
-T & vector <T> :: operator [] (size_t index)
+template <typename T, class Growth>
+T & vector <T, Growth> :: operator [] (size_t index)
 {
    return data[index];
 }
@@ -498,8 +478,8 @@ T & vector <T> :: operator [] (size_t index)
  * VECTOR :: SUBSCRIPT
  * Read-Write access
  *****************************************/
-template <typename T>
-const T & vector <T> :: operator [] (size_t index) const
+template <typename T, class Growth>
+const T & vector <T, Growth> :: operator [] (size_t index) const
 {
    return data[index];
 }
@@ -508,8 +488,8 @@ const T & vector <T> :: operator [] (size_t index) const
  * VECTOR :: FRONT
  * Read-Write access
  ****************************************/
-template <typename T>
-T & vector <T> :: front ()
+template <typename T, class Growth>
+T & vector <T, Growth> :: front ()
 {
    return data[0];
 }
@@ -518,8 +498,8 @@ T & vector <T> :: front ()
  * VECTOR :: FRONT
  * Read access
  *****************************************/
-template <typename T>
-const T & vector <T> :: front () const
+template <typename T, class Growth>
+const T & vector <T, Growth> :: front () const
 {
    return data[0];
 }
@@ -528,8 +508,8 @@ const T & vector <T> :: front () const
  * VECTOR :: BACK
  * Read-Write access
  ****************************************/
-template <typename T>
-T & vector <T> :: back()
+template <typename T, class Growth>
+T & vector <T, Growth> :: back()
 {
    return data[numElements - 1];
 }
@@ -538,8 +518,8 @@ T & vector <T> :: back()
  * VECTOR :: BACK
  * Read access
  *****************************************/
-template <typename T>
-const T & vector <T> :: back() const
+template <typename T, class Growth>
+const T & vector <T, Growth> :: back() const
 {
    return data[numElements - 1];
 }
@@ -552,44 +532,67 @@ const T & vector <T> :: back() const
  *     INPUT  : 't' the new element to be added
  *     OUTPUT : *this
  **************************************/
-template <typename T>
-void vector <T> :: push_back (const T & t)
+template <typename T, class Growth>
+void vector <T, Growth> :: push_back (const T & t)
 {
-   if (data == nullptr)
-   {
-      data = new T[1];
-      data[0] = t;
-      numCapacity = 1;
-      numElements = 1;
-   }
+   emplace_back(t);
+}
+
+template <typename T, class Growth>
+void vector <T, Growth> ::push_back(T && t)
+{
+   emplace_back(std::move(t));
+}
+
+/***************************************
+ * VECTOR :: EMPLACE BACK
+ * Build a new element at the end of the buffer
+ * straight from the constructor arguments
+ *     INPUT  : args for the constructor of T
+ *     OUTPUT : the new element
+ **************************************/
+template <typename T, class Growth>
+template <class ... Args>
+T & vector <T, Growth> :: emplace_back(Args&& ... args)
+{
+   if (numElements == numCapacity)
+      emplaceGrow(numElements, std::forward<Args>(args)...);
    else
-   {
-      if (numCapacity == numElements)
-      {
-         resize(numCapacity * 2);
-      }
-      data[numElements++] = t;
-   }
+      new (data + numElements++) T(std::forward<Args>(args)...);
+   return data[numElements - 1];
 }
 
-template <typename T>
-void vector <T> ::push_back(T && t)
+/***************************************
+ * VECTOR :: EMPLACE
+ * Build a new element in front of 'it', sliding
+ * the later elements back one slot
+ *     INPUT  : it where the new element goes
+ *              args for the constructor of T
+ *     OUTPUT : an iterator to the new element
+ **************************************/
+template <typename T, class Growth>
+template <class ... Args>
+typename vector <T, Growth> :: iterator
+vector <T, Growth> :: emplace(iterator it, Args&& ... args)
 {
-   if (data == nullptr)
-   {
-      data = new T[1];
-      data[0] = t;
-      numCapacity = 1;
-      numElements = 1;
-   }
+   size_t index = (it.p == nullptr) ? 0 : size_t(it.p - data);
+   assert(index <= numElements);
+
+   if (numElements == numCapacity)
+      emplaceGrow(index, std::forward<Args>(args)...);
+   else if (index == numElements)
+      new (data + numElements++) T(std::forward<Args>(args)...);
    else
    {
-      if (numCapacity == numElements)
-      {
-         resize(numCapacity * 2);
-      }
-      data[numElements++] = t;
+      // the arguments may refer to an element that is about to move
+      T t(std::forward<Args>(args)...);
+      new (data + numElements) T(std::move(data[numElements - 1]));
+      for (size_t i = numElements - 1; i > index; i--)
+         data[i] = std::move(data[i - 1]);
+      data[index] = std::move(t);
+      numElements++;
    }
+   return iterator(data + index);
 }
 
 /***************************************
@@ -599,45 +602,42 @@ void vector <T> ::push_back(T && t)
  *     INPUT  : rhs the vector to copy from
  *     OUTPUT : *this
  **************************************/
-template <typename T>
-vector <T> & vector <T> :: operator = (const vector & rhs)
+template <typename T, class Growth>
+vector <T, Growth> & vector <T, Growth> :: operator = (const vector & rhs)
 {
-   if (rhs.numElements == 0)
-   {
-      this->data = nullptr;
-   }
-   else
-   {
-      this->data = new T[rhs.numElements];
-      for (int i = 0; i < rhs.numElements; i++)
-      {
-         this->data[i] = rhs.data[i];
-      }
-   }
-   if (this->numCapacity < rhs.numCapacity)
+   if (this == &rhs)
+      return *this;
+
+   // only reallocate when the rhs does not fit
+   if (rhs.numElements > numCapacity)
    {
-      this->numCapacity = rhs.numCapacity;
+      clear();
+      deallocate(data);
+      data = allocate(rhs.numElements);
+      numCapacity = rhs.numElements;
    }
-   this->numElements = rhs.numElements;
+
+   // assign over the items we have, copy-construct the rest
+   size_t numAssign = numElements < rhs.numElements ? numElements : rhs.numElements;
+   for (size_t i = 0; i < numAssign; i++)
+      data[i] = rhs.data[i];
+   for (size_t i = numAssign; i < rhs.numElements; i++)
+      new (data + i) T(rhs.data[i]);
+   destroy(rhs.numElements, numElements);
+   numElements = rhs.numElements;
    return *this;
 }
-template <typename T>
-vector <T>& vector <T> :: operator = (vector&& rhs)
+template <typename T, class Growth>
+vector <T, Growth>& vector <T, Growth> :: operator = (vector&& rhs)
 {
-   if (rhs.numElements == 0)
-   {
-      this->data = nullptr;
-   }
-   else
-   {
-      this->data = new T[rhs.numElements];
-      for (int i = 0; i < rhs.numElements; i++)
-      {
-         this->data[i] = rhs.data[i];
-      }
-   }
-   this->numCapacity = rhs.numCapacity;
-   this->numElements = rhs.numElements;
+   if (this == &rhs)
+      return *this;
+
+   clear();
+   deallocate(data);
+   data = rhs.data;
+   numCapacity = rhs.numCapacity;
+   numElements = rhs.numElements;
 
    rhs.data = nullptr;
    rhs.numElements = 0;
@@ -646,8 +646,141 @@ vector <T>& vector <T> :: operator = (vector&& rhs)
    return *this;
 }
 
+/***************************************
+ * VECTOR :: ALLOCATE
+ * Get raw room for num items without constructing any
+ **************************************/
+template <typename T, class Growth>
+T * vector <T, Growth> :: allocate(size_t num)
+{
+   if (num == 0)
+      return nullptr;
+   return static_cast<T *>(::operator new[](num * sizeof(T)));
+}
 
+/***************************************
+ * VECTOR :: RELOCATE
+ * Move num items into uninitialized room. Items that can
+ * be relocated trivially are copied as one block. The rest
+ * are moved, or copied if a move might throw, and the
+ * originals stay alive until endLives(). If one throws, the
+ * ones already built are destroyed and the originals are
+ * untouched, so the caller can still back out.
+ **************************************/
+template <typename T, class Growth>
+void vector <T, Growth> :: relocate(T * pSrc, size_t num, T * pDest)
+{
+   if (num == 0)
+      return;
 
+   if (is_trivially_relocatable<T>::value)
+   {
+      std::memcpy(static_cast<void *>(pDest), static_cast<const void *>(pSrc), num * sizeof(T));
+      return;
+   }
 
-} // namespace custom
+   size_t i = 0;
+   try
+   {
+      for (; i < num; i++)
+         new (pDest + i) T(std::move_if_noexcept(pSrc[i]));
+   }
+   catch (...)
+   {
+      endLives(pDest, i);
+      throw;
+   }
+}
+
+/***************************************
+ * VECTOR :: END LIVES
+ * Destroy num items on either side of a relocate(). Items
+ * relocated trivially need nothing: their bytes moved.
+ **************************************/
+template <typename T, class Growth>
+void vector <T, Growth> :: endLives(T * p, size_t num)
+{
+   if (!is_trivially_relocatable<T>::value && !std::is_trivially_destructible<T>::value)
+      for (size_t i = 0; i < num; i++)
+         p[i].~T();
+}
+
+/***************************************
+ * VECTOR :: DESTROY
+ * Call the destructor on [indexBegin, indexEnd)
+ **************************************/
+template <typename T, class Growth>
+void vector <T, Growth> :: destroy(size_t indexBegin, size_t indexEnd)
+{
+   if (!std::is_trivially_destructible<T>::value)
+      for (size_t i = indexBegin; i < indexEnd; i++)
+         data[i].~T();
+}
 
+/***************************************
+ * VECTOR :: REALLOCATE
+ * Move the items into a buffer of newCapacity,
+ * which must be able to hold them all
+ **************************************/
+template <typename T, class Growth>
+void vector <T, Growth> :: reallocate(size_t newCapacity)
+{
+   assert(newCapacity >= numElements);
+   T * newData = allocate(newCapacity);
+   try
+   {
+      relocate(data, numElements, newData);
+   }
+   catch (...)
+   {
+      deallocate(newData);
+      throw;
+   }
+   endLives(data, numElements);
+   deallocate(data);
+   data = newData;
+   numCapacity = newCapacity;
+}
+
+/***************************************
+ * VECTOR :: EMPLACE GROW
+ * Emplace when the buffer is full. The new item is built
+ * before the old buffer goes away because the arguments
+ * may live in it. The items on either side of 'index'
+ * then move over around it. If anything throws, the new
+ * buffer is torn down and the old one is as it was.
+ **************************************/
+template <typename T, class Growth>
+template <class ... Args>
+void vector <T, Growth> :: emplaceGrow(size_t index, Args&& ... args)
+{
+   size_t newCapacity = Growth::grow(numCapacity);
+   assert(newCapacity > numElements);
+   T * newData = allocate(newCapacity);
+   bool isBuilt = false;       // is the new item in newData?
+   bool isFrontMoved = false;  // are the items before index?
+   try
+   {
+      new (newData + index) T(std::forward<Args>(args)...);
+      isBuilt = true;
+      relocate(data, index, newData);
+      isFrontMoved = true;
+      relocate(data + index, numElements - index, newData + index + 1);
+   }
+   catch (...)
+   {
+      if (isFrontMoved)
+         endLives(newData, index);
+      if (isBuilt)
+         newData[index].~T();
+      deallocate(newData);
+      throw;
+   }
+   endLives(data, numElements);
+   deallocate(data);
+   data = newData;
+   numCapacity = newCapacity;
+   numElements++;
+}
+
+} // namespace custom
@@ -0,0 +1,117 @@
+/***********************************************************************
+ * Source:
+ *    Bench Stack
+ * Summary:
+ *    Time a stack shared by several threads: a stack behind a mutex
+ *    against the lock-free concurrent_stack. Every thread pushes an
+ *    item and pops one, over and over. The report is wall-clock
+ *    nanoseconds per push/pop pair, across all the threads, so a
+ *    stack that scales gets cheaper as threads are added. Build the
+ *    BenchStack project in Release, or:
+ *       g++ -O2 -std=c++14 -pthread benchStack.cpp
+ * Author
+ *    Noah Li, Steven Sellers, Josh Hamilton.
+ ************************************************************************/
+
+#include "stack.h"              // for stack
+#include "concurrent_stack.h"   // for concurrent_stack
+
+#include <chrono>               // for steady_clock
+#include <cstddef>              // for size_t
+#include <iomanip>              // for setw and setprecision
+#include <iostream>             // for cout
+#include <mutex>                // for mutex and lock_guard
+#include <thread>               // for thread and hardware_concurrency
+#include <vector>               // for the threads
+
+const size_t NUM_PAIRS = 2000000;   // push/pop pairs, split among the threads
+
+/**********************************************************************
+ * LOCKED STACK
+ * A stack with a mutex around it: the way the workers share one now
+ ***********************************************************************/
+class LockedStack
+{
+public:
+   void push(int value)
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      s.push(value);
+   }
+   bool try_pop(int & value)
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (s.empty())
+         return false;
+      value = s.top();
+      s.pop();
+      return true;
+   }
+private:
+   std::mutex mutex;
+   custom::stack<int> s;
+};
+
+/**********************************************************************
+ * TIME PAIRS
+ * Split NUM_PAIRS push/pop pairs among numThreads threads working on
+ * one stack. The sum of what was popped is printed so the pops
+ * cannot be optimized away
+ ***********************************************************************/
+template <class Stack>
+void timePairs(const char * name, unsigned int numThreads)
+{
+   Stack s;
+   std::vector<long long> sums(numThreads, 0);
+   std::vector<std::thread> threads;
+   size_t pairsEach = NUM_PAIRS / numThreads;
+
+   auto start = std::chrono::steady_clock::now();
+   for (unsigned int t = 0; t < numThreads; t++)
+      threads.push_back(std::thread([&s, &sums, t, pairsEach]()
+      {
+         long long sum = 0;
+         for (size_t i = 0; i < pairsEach; i++)
+         {
+            int value;
+            s.push(int(i));
+            if (s.try_pop(value))
+               sum += value;
+         }
+         sums[t] = sum;
+      }));
+   for (std::thread & thread : threads)
+      thread.join();
+   auto finish = std::chrono::steady_clock::now();
+
+   long long sum = 0;
+   for (long long each : sums)
+      sum += each;
+   double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+   std::cout << std::left  << std::setw(20) << name
+             << std::right << std::setw(3)  << numThreads << " threads"
+             << std::setw(10) << std::fixed << std::setprecision(2)
+             << ns / double(pairsEach * numThreads) << " ns/pair"
+             << "   (sum " << sum << ")\n";
+}
+
+/**********************************************************************
+ * MAIN
+ * Time both stacks from one thread up to every hardware thread,
+ * and at least up to eight
+ ***********************************************************************/
+int main()
+{
+   unsigned int maxThreads = std::thread::hardware_concurrency();
+   if (maxThreads < 8)
+      maxThreads = 8;
+
+   std::cout << NUM_PAIRS << " push/pop pairs\n";
+   for (unsigned int numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+   {
+      timePairs<LockedStack>("stack + mutex", numThreads);
+      timePairs<custom::concurrent_stack<int>>("concurrent_stack", numThreads);
+   }
+
+   return 0;
+}
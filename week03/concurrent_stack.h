@@ -0,0 +1,291 @@
+/***********************************************************************
+ * Module:
+ *    Concurrent Stack
+ * Summary:
+ *    A lock-free stack that many threads can push and pop at once
+ *
+ *      __       ____       ____         __
+ *     /  |    .'    '.   .'    '.   _  / /
+ *     `| |   |  .--.  | |  .--.  | (_)/ /
+ *      | |   | |    | | | |    | |   / / _
+ *     _| |_  |  `--'  | |  `--'  |  / / (_)
+ *    |_____|  '.____.'   '.____.'  /_/
+ *
+ *
+ *    This will contain the class definition of:
+ *       concurrent_stack  : a Treiber stack with tagged heads
+ * Author
+ *    Noah Li, Josh Hamilton & Steven Sellers
+ ************************************************************************/
+
+#pragma once
+
+#include <atomic>   // for std::atomic
+#include <cassert>  // because I am paranoid
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t and uint64_t
+#include <new>      // for placement new
+#include <utility>  // for std::move and std::forward
+
+class TestConcurrentStack; // forward declaration for unit tests
+
+namespace custom
+{
+
+/**************************************************
+ * CONCURRENT STACK
+ * First-in-Last-out, safe to share between threads without
+ * a lock. Each node holds the data and a link to the next
+ * node, like the week04 Node, but the link is a node number
+ * rather than a pointer.
+ *
+ * A head is a 64 bit word: a 32 bit tag over a 32 bit node
+ * number, where 0 means no node. Every change bumps the tag,
+ * so a compare-and-swap against a head that was popped and
+ * pushed back in the meantime (the ABA problem) fails.
+ *
+ * Popped nodes go onto a free list, which is another tagged
+ * stack, and are handed out again by later pushes. Node memory
+ * is only freed by the destructor, so a thread that reads the
+ * link of a node another thread just popped still reads valid
+ * memory. The nodes live in slabs that double in size; a slab
+ * is never moved once made.
+ *************************************************/
+template<class T>
+class concurrent_stack
+{
+   friend class ::TestConcurrentStack; // give unit tests access to the privates
+public:
+
+   //
+   // Construct
+   //
+
+   concurrent_stack();
+   concurrent_stack(const concurrent_stack &) = delete;
+   concurrent_stack & operator = (const concurrent_stack &) = delete;
+   ~concurrent_stack();
+
+   //
+   // Insert
+   //
+
+   void push(const T&  t) { emplace(t);            }
+   void push(      T&& t) { emplace(std::move(t)); }
+   template <class ... Args>
+   void emplace(Args&& ... args);
+
+   //
+   // Remove
+   //
+
+   // take the top into t. FALSE if the stack was empty
+   bool try_pop(T & t);
+
+   //
+   // Status
+   //
+
+   // only a snapshot: another thread may change it right after
+   bool empty() const { return number(head.load(std::memory_order_acquire)) == 0; }
+
+private:
+
+   struct Node
+   {
+      alignas(T) unsigned char data[sizeof(T)]; // user data, built on push
+      std::atomic<uint32_t> next;               // number of the next node, 0 for none
+
+      T & value() { return *reinterpret_cast<T *>(data); }
+   };
+
+   static const size_t SLAB_BASE = 64;      // nodes in the first slab
+   static const size_t NUM_SLABS = 26;      // enough slabs for 2^32 nodes
+
+   // the parts of a head word
+   static uint32_t number(uint64_t word) { return uint32_t(word);       }
+   static uint32_t tag(uint64_t word)    { return uint32_t(word >> 32); }
+   static uint64_t makeHead(uint32_t tag, uint32_t number)
+   {
+      return (uint64_t(tag) << 32) | number;
+   }
+
+   Node & node(uint32_t number);
+   void   link(std::atomic<uint64_t> & top, uint32_t number);
+   uint32_t unlink(std::atomic<uint64_t> & top);
+   uint32_t acquireNode();
+
+   std::atomic<uint64_t> head;              // the top of the stack
+   std::atomic<uint64_t> headFree;          // the top of the free list
+   std::atomic<uint32_t> numCarved;         // nodes ever handed out of the slabs
+   std::atomic<Node *>   slabs[NUM_SLABS];  // slab k holds SLAB_BASE * 2^k nodes
+};
+
+/**************************************************
+ * CONCURRENT STACK :: CONSTRUCTOR
+ * No slab is made until the first push
+ *************************************************/
+template <class T>
+concurrent_stack <T> :: concurrent_stack() : head(0), headFree(0), numCarved(0)
+{
+   for (size_t k = 0; k < NUM_SLABS; k++)
+      slabs[k].store(nullptr, std::memory_order_relaxed);
+}
+
+/**************************************************
+ * CONCURRENT STACK :: DESTRUCTOR
+ * No other thread may be using the stack now, so the
+ * remaining items can be destroyed and the slabs freed
+ *************************************************/
+template <class T>
+concurrent_stack <T> :: ~concurrent_stack()
+{
+   for (uint32_t n = number(head.load()); n != 0; n = node(n).next.load())
+      node(n).value().~T();
+   for (size_t k = 0; k < NUM_SLABS; k++)
+      delete [] slabs[k].load();
+}
+
+/**************************************************
+ * CONCURRENT STACK :: EMPLACE
+ * Build the item in a free node, then link it on top
+ *************************************************/
+template <class T>
+template <class ... Args>
+void concurrent_stack <T> :: emplace(Args&& ... args)
+{
+   uint32_t n = acquireNode();
+   try
+   {
+      new (node(n).data) T(std::forward<Args>(args)...);
+   }
+   catch (...)
+   {
+      link(headFree, n);
+      throw;
+   }
+   link(head, n);
+}
+
+/**************************************************
+ * CONCURRENT STACK :: TRY POP
+ * Unlink the top node, move its item out and
+ * give the node to the free list
+ *************************************************/
+template <class T>
+bool concurrent_stack <T> :: try_pop(T & t)
+{
+   uint32_t n = unlink(head);
+   if (n == 0)
+      return false;
+
+   T & value = node(n).value();
+   t = std::move(value);
+   value.~T();
+   link(headFree, n);
+   return true;
+}
+
+/**************************************************
+ * CONCURRENT STACK :: NODE
+ * Find node n, counting from 1. Slab k starts after
+ * the SLAB_BASE * (2^k - 1) nodes of the slabs before it
+ *************************************************/
+template <class T>
+typename concurrent_stack <T> :: Node & concurrent_stack <T> :: node(uint32_t number)
+{
+   assert(number != 0);
+   size_t index = number - 1;
+   size_t k = 0;
+   while (index >= (SLAB_BASE << k))
+   {
+      index -= SLAB_BASE << k;
+      k++;
+   }
+   Node * pSlab = slabs[k].load(std::memory_order_acquire);
+   assert(pSlab != nullptr);
+   return pSlab[index];
+}
+
+/**************************************************
+ * CONCURRENT STACK :: LINK
+ * Push node n onto a tagged stack. The release makes
+ * the item and link visible to whoever pops it.
+ *************************************************/
+template <class T>
+void concurrent_stack <T> :: link(std::atomic<uint64_t> & top, uint32_t n)
+{
+   Node & pushed = node(n);
+   uint64_t old = top.load(std::memory_order_relaxed);
+   uint64_t desired;
+   do
+   {
+      pushed.next.store(number(old), std::memory_order_relaxed);
+      desired = makeHead(tag(old) + 1, n);
+   }
+   while (!top.compare_exchange_weak(old, desired,
+                                     std::memory_order_release,
+                                     std::memory_order_relaxed));
+}
+
+/**************************************************
+ * CONCURRENT STACK :: UNLINK
+ * Pop the top node number off a tagged stack, 0 if it
+ * is empty. The link may be stale if another thread won
+ * the race, but then the tag has moved on and the
+ * compare-and-swap fails.
+ *************************************************/
+template <class T>
+uint32_t concurrent_stack <T> :: unlink(std::atomic<uint64_t> & top)
+{
+   uint64_t old = top.load(std::memory_order_acquire);
+   uint64_t desired;
+   do
+   {
+      if (number(old) == 0)
+         return 0;
+      uint32_t next = node(number(old)).next.load(std::memory_order_relaxed);
+      desired = makeHead(tag(old) + 1, next);
+   }
+   while (!top.compare_exchange_weak(old, desired,
+                                     std::memory_order_acquire,
+                                     std::memory_order_acquire));
+   return number(old);
+}
+
+/**************************************************
+ * CONCURRENT STACK :: ACQUIRE NODE
+ * Reuse a freed node, else carve a new one. The first
+ * thread to need a slab makes it; any other thread that
+ * raced to make the same slab throws its copy away.
+ *************************************************/
+template <class T>
+uint32_t concurrent_stack <T> :: acquireNode()
+{
+   uint32_t n = unlink(headFree);
+   if (n != 0)
+      return n;
+
+   n = numCarved.fetch_add(1, std::memory_order_relaxed) + 1;
+   assert(n != 0);
+
+   size_t index = n - 1;
+   size_t k = 0;
+   while (index >= (SLAB_BASE << k))
+   {
+      index -= SLAB_BASE << k;
+      k++;
+   }
+   if (slabs[k].load(std::memory_order_acquire) == nullptr)
+   {
+      Node * pSlab = new Node[SLAB_BASE << k];
+      Node * pExpected = nullptr;
+      if (!slabs[k].compare_exchange_strong(pExpected, pSlab,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_acquire))
+         delete [] pSlab;
+   }
+   return n;
+}
+
+} // custom namespace
@@ -21,8 +21,9 @@
 #pragma once
 
 #include <cassert>  // because I am paranoid
-//#include "vector.h"
-#include <vector>
+#include <cstddef>  // for size_t
+#include <utility>  // for std::move and std::forward
+#include "vector.h"
 
 class TestStack; // forward declaration for unit tests
 
@@ -31,24 +32,25 @@ namespace custom
 
 /**************************************************
  * STACK
- * First-in-Last-out data structure
+ * First-in-Last-out data structure. The top is the
+ * back of the vector, so push and pop are amortized O(1)
  *************************************************/
 template<class T>
 class stack
 {
-   friend class ::TestStack; // give unit tests access to the privates
+   friend class ::TestStack; // give the unit test class access to the privates
 public:
   
    // 
    // Construct
    // 
 
-   stack()                            { container.resize(0); }
-   stack(const stack <T> &  rhs)      { this->container = rhs.container; }
-   stack(      stack <T> && rhs)      { this->container = rhs.container; }
-   stack(const std::vector<T> &  rhs) { *this = rhs; }
-   stack(std::vector<T>&& rhs)        { *this = std::move(rhs); }
-   ~stack()                           {                      }
+   stack()                                                                     { }
+   stack(const stack <T> &  rhs)         : container(rhs.container)            { }
+   stack(      stack <T> && rhs)         : container(std::move(rhs.container)) { }
+   stack(const custom::vector<T> &  rhs) : container(rhs)                      { }
+   stack(      custom::vector<T> && rhs) : container(std::move(rhs))           { }
+   ~stack()                                                                    { }
 
    //
    // Assign
@@ -56,30 +58,40 @@ public:
 
    stack <T> & operator = (const stack <T> & rhs)
    {
+      container = rhs.container;
       return *this;
    }
    stack <T>& operator = (stack <T> && rhs)
    {
+      container = std::move(rhs.container);
       return *this;
    }
    void swap(stack <T>& rhs)
    {
-
+      container.swap(rhs.container);
    }
 
    // 
    // Access
    //
 
-         T& top()       { return *(new T); }
-   const T& top() const { return *(new T); }
+         T& top()       { return container.back(); }
+   const T& top() const { return container.back(); }
 
    // 
    // Insert
    // 
 
-   void push(const T&  t) {  }
-   void push(      T&& t) {  }
+   void push(const T&  t) { container.push_back(t);            }
+   void push(      T&& t) { container.push_back(std::move(t)); }
+   template <class ... Args>
+   void emplace(Args&& ... args)
+   {
+      container.emplace_back(std::forward<Args>(args)...);
+   }
+
+   // make room for numElements so pushes up to that depth never reallocate
+   void reserve(size_t numElements) { container.reserve(numElements); }
 
    //
    // Remove
@@ -87,22 +99,18 @@ public:
 
    void pop() 
    { 
-      
+      container.pop_back();
    }
 
    //
    // Status
    //
-   size_t  size () const { return 99;  }
-   bool empty   () const { return true; }
+   size_t  size () const { return container.size();  }
+   bool empty   () const { return container.empty(); }
    
 private:
    
-  std::vector<T> container;  // underlying container
+  custom::vector<T> container;  // underlying container
 };
 
-
-
 } // custom namespace
-
-
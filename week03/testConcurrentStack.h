@@ -0,0 +1,266 @@
+/***********************************************************************
+ * Header:
+ *    TEST CONCURRENT STACK
+ * Summary:
+ *    Unit tests for concurrent_stack
+ * Author
+ *    Noah Li, Josh Hamilton & Steven Sellers
+ ************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG
+
+#include "concurrent_stack.h"
+#include "unitTest.h"
+#include "spy.h"
+
+#include <cassert>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class TestConcurrentStack : public UnitTest
+{
+
+public:
+   void run()
+   {
+      reset();
+
+      // Construct
+      test_construct_default();
+      test_destructor_spy();
+
+      // Insert
+      test_push_one();
+      test_push_order();
+      test_pushMove_spyNoCopy();
+      test_push_secondSlab();
+
+      // Remove
+      test_pop_empty();
+      test_pop_reuseNode();
+
+      // Threads
+      test_threads_pushThenPop();
+      test_threads_pushAndPop();
+
+      report("ConcurrentStack");
+   }
+
+   /***************************************
+    * CONSTRUCTOR DESTRUCTOR
+    ***************************************/
+
+   // a new stack is empty and has no slabs yet
+   void test_construct_default()
+   {  // setup
+      // exercise
+      custom::concurrent_stack<int> s;
+      // verify
+      assertUnit(s.empty());
+      assertUnit(s.head.load() == 0);
+      assertUnit(s.headFree.load() == 0);
+      assertUnit(s.numCarved.load() == 0);
+      assertUnit(s.slabs[0].load() == nullptr);
+   }  // teardown
+
+   // the destructor destroys the items still on the stack
+   void test_destructor_spy()
+   {  // setup
+      {
+         custom::concurrent_stack<Spy> s;
+         s.emplace(26);
+         s.emplace(49);
+         Spy::reset();
+         // exercise
+      }
+      // verify
+      assertUnit(Spy::numDestructor() == 2);
+   }  // teardown
+
+   /***************************************
+    * PUSH
+    ***************************************/
+
+   // the first push carves node 1 and puts it on top
+   void test_push_one()
+   {  // setup
+      custom::concurrent_stack<int> s;
+      // exercise
+      s.push(26);
+      // verify
+      assertUnit(!s.empty());
+      assertUnit(s.number(s.head.load()) == 1);
+      assertUnit(s.tag(s.head.load()) == 1);
+      assertUnit(s.node(1).value() == 26);
+      assertUnit(s.node(1).next.load() == 0);
+      assertUnit(s.numCarved.load() == 1);
+   }  // teardown
+
+   // last in, first out
+   void test_push_order()
+   {  // setup
+      custom::concurrent_stack<int> s;
+      int value = 0;
+      // exercise
+      s.push(26);
+      s.push(49);
+      s.push(67);
+      // verify
+      assertUnit(s.try_pop(value) && value == 67);
+      assertUnit(s.try_pop(value) && value == 49);
+      assertUnit(s.try_pop(value) && value == 26);
+      assertUnit(s.empty());
+   }  // teardown
+
+   // moving in and popping out never copies
+   void test_pushMove_spyNoCopy()
+   {  // setup
+      custom::concurrent_stack<Spy> s;
+      Spy spy(26);
+      Spy result;
+      Spy::reset();
+      // exercise
+      s.push(std::move(spy));
+      bool popped = s.try_pop(result);
+      // verify
+      assertUnit(popped);
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numCopyMove() == 1);
+      assertUnit(Spy::numAssignMove() == 1);
+      assertUnit(result.get() == 26);
+   }  // teardown
+
+   // more nodes than the first slab holds start a second slab
+   void test_push_secondSlab()
+   {  // setup
+      custom::concurrent_stack<int> s;
+      size_t num = s.SLAB_BASE + 1;
+      // exercise
+      for (size_t i = 0; i < num; i++)
+         s.push(int(i));
+      // verify
+      assertUnit(s.slabs[0].load() != nullptr);
+      assertUnit(s.slabs[1].load() != nullptr);
+      assertUnit(s.slabs[2].load() == nullptr);
+      assertUnit(&s.node(uint32_t(num)) == s.slabs[1].load());
+      int value = -1;
+      assertUnit(s.try_pop(value) && value == int(num - 1));
+   }  // teardown
+
+   /***************************************
+    * POP
+    ***************************************/
+
+   // nothing to pop leaves the target alone
+   void test_pop_empty()
+   {  // setup
+      custom::concurrent_stack<int> s;
+      int value = 99;
+      // exercise
+      bool popped = s.try_pop(value);
+      // verify
+      assertUnit(!popped);
+      assertUnit(value == 99);
+   }  // teardown
+
+   // a popped node goes to the free list and the next push reuses it
+   void test_pop_reuseNode()
+   {  // setup
+      custom::concurrent_stack<int> s;
+      int value = 0;
+      s.push(26);
+      s.push(49);
+      // exercise
+      s.try_pop(value);
+      uint32_t freed = s.number(s.headFree.load());
+      s.push(67);
+      // verify
+      assertUnit(freed == 2);
+      assertUnit(s.number(s.head.load()) == 2);
+      assertUnit(s.number(s.headFree.load()) == 0);
+      assertUnit(s.numCarved.load() == 2);
+      assertUnit(s.node(2).value() == 67);
+   }  // teardown
+
+   /***************************************
+    * THREADS
+    ***************************************/
+
+   // every thread pushes its own numbers, then one thread pops them all
+   void test_threads_pushThenPop()
+   {  // setup
+      custom::concurrent_stack<int> s;
+      std::vector<std::thread> threads;
+      // exercise
+      for (int t = 0; t < NUM_THREADS; t++)
+         threads.push_back(std::thread([&s, t]()
+         {
+            for (int i = 0; i < NUM_PER_THREAD; i++)
+               s.push(t * NUM_PER_THREAD + i);
+         }));
+      for (std::thread & thread : threads)
+         thread.join();
+      // verify
+      std::vector<int> seen(NUM_THREADS * NUM_PER_THREAD, 0);
+      int value;
+      while (s.try_pop(value))
+         seen[value]++;
+      assertUnit(allOnce(seen));
+      assertUnit(s.numCarved.load() == uint32_t(NUM_THREADS * NUM_PER_THREAD));
+   }  // teardown
+
+   // every thread pushes and pops at once. Nodes are reused
+   // all the time, which is where ABA would bite
+   void test_threads_pushAndPop()
+   {  // setup
+      custom::concurrent_stack<int> s;
+      std::vector<std::vector<int>> popped(NUM_THREADS);
+      std::vector<std::thread> threads;
+      // exercise
+      for (int t = 0; t < NUM_THREADS; t++)
+         threads.push_back(std::thread([&s, &popped, t]()
+         {
+            int value;
+            for (int i = 0; i < NUM_PER_THREAD; i++)
+            {
+               s.push(t * NUM_PER_THREAD + i);
+               if (s.try_pop(value))
+                  popped[t].push_back(value);
+            }
+         }));
+      for (std::thread & thread : threads)
+         thread.join();
+      // verify
+      std::vector<int> seen(NUM_THREADS * NUM_PER_THREAD, 0);
+      for (const std::vector<int> & values : popped)
+         for (int value : values)
+            seen[value]++;
+      int value;
+      while (s.try_pop(value))
+         seen[value]++;
+      assertUnit(allOnce(seen));
+      assertUnit(s.numCarved.load() <= uint32_t(NUM_THREADS * NUM_PER_THREAD));
+   }  // teardown
+
+   /***************************************************
+    * SETUP FIXTURE
+    * Each thread pushes the numbers
+    * t * NUM_PER_THREAD up to (t + 1) * NUM_PER_THREAD - 1
+    ***************************************************/
+   enum { NUM_THREADS = 4, NUM_PER_THREAD = 20000 };
+
+   // was every number popped exactly once?
+   static bool allOnce(const std::vector<int> & seen)
+   {
+      for (int count : seen)
+         if (count != 1)
+            return false;
+      return true;
+   }
+};
+
+#endif // DEBUG
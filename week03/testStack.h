@@ -66,10 +66,12 @@ public:
       test_pushCopy_standard();
       test_pushMove_empty();
       test_pushMove_standard();
+      test_emplace_standard();
+      test_reserve_noReallocate();
 
       // Delete
-
-      /* place your pop unit tests here */;
+      test_pop_empty();
+      test_pop_standard();
 
       // Status
       test_size_empty();
@@ -1135,10 +1137,105 @@ public:
 
 
 
+   // build an element in place on top. Nothing is copied or moved
+   void test_emplace_standard()
+   {  // setup
+      //    +----+----+----+----+----+----+
+      //    | 26 | 49 | 67 | 89 |    |    |
+      //    +----+----+----+----+----+----+
+      custom::stack<Spy> s;
+      setupStandardFixture(s);
+      s.container.reserve(6);
+      Spy::reset();
+      // exercise
+      s.emplace(99);
+      // verify
+      assertUnit(Spy::numNondefault() == 1);  // Spy(99) built on top
+      assertUnit(Spy::numAlloc() == 1);
+      assertUnit(Spy::numCopyMove() == 0);
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numAssignMove() == 0);
+      assertUnit(Spy::numDefault() == 0);
+      assertUnit(Spy::numDestructor() == 0);
+      //    +----+----+----+----+----+----+
+      //    | 26 | 49 | 67 | 89 | 99 |    |
+      //    +----+----+----+----+----+----+
+      assertUnit(s.container.size() == 5);
+      assertUnit(s.container.capacity() == 6);
+      if (s.container.size() >= 5)
+         assertUnit(s.container[4] == Spy(99));
+      // teardown
+      teardownStandardFixture(s);
+   }
+
+   // pushes up to the reserved depth never move the elements
+   void test_reserve_noReallocate()
+   {  // setup
+      custom::stack<Spy> s;
+      // exercise
+      s.reserve(8);
+      Spy::reset();
+      for (int i = 0; i < 8; i++)
+         s.emplace(i);
+      // verify
+      assertUnit(Spy::numCopyMove() == 0);
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numDestructor() == 0);
+      assertUnit(s.container.capacity() == 8);
+      assertUnit(s.container.size() == 8);
+      // teardown
+      teardownStandardFixture(s);
+   }
+
    /***************************************
     * POP
     ***************************************/
 
+   // pop of an empty stack does nothing
+   void test_pop_empty()
+   {  // setup
+      custom::stack<Spy> s;
+      Spy::reset();
+      // exercise
+      s.pop();
+      // verify
+      assertUnit(Spy::numDestructor() == 0);
+      assertEmptyFixture(s);
+   }  // teardown
+
+   // pop the top. Only that element is destroyed and the capacity stays
+   void test_pop_standard()
+   {  // setup
+      //    +----+----+----+----+
+      //    | 26 | 49 | 67 | 89 |
+      //    +----+----+----+----+
+      custom::stack<Spy> s;
+      setupStandardFixture(s);
+      Spy::reset();
+      // exercise
+      s.pop();
+      // verify
+      assertUnit(Spy::numDestructor() == 1);  // destroy [89]
+      assertUnit(Spy::numDelete() == 1);
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numCopyMove() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numAssignMove() == 0);
+      //    +----+----+----+----+
+      //    | 26 | 49 | 67 |    |
+      //    +----+----+----+----+
+      assertUnit(s.container.size() == 3);
+      assertUnit(s.container.capacity() == 4);
+      if (s.container.size() >= 3)
+      {
+         assertUnit(s.container[0] == Spy(26));
+         assertUnit(s.container[2] == Spy(67));
+      }
+      // teardown
+      teardownStandardFixture(s);
+   }
+
 
    
    /*************************************************************
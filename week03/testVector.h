@@ -13,6 +13,7 @@
 
 #include <vector>
 #include "vector.h"
+#include "spy.h"
 #include "unitTest.h"
 
 
@@ -78,6 +79,7 @@ public:
       test_front_write();
       test_back_read();
       test_back_write();
+      test_back_partiallyfilled();
 
       // Insert
       test_pushback_empty();
@@ -86,6 +88,13 @@ public:
       test_pushback_moveEmpty();
       test_pushback_moveExcessCapacity();
       test_pushback_moveRequireReallocate();
+      test_pushback_growthHalf();
+      test_pushback_selfReallocate();
+      test_emplaceback_spyNoCopy();
+      test_emplaceback_requireReallocate();
+      test_emplace_middle();
+      test_emplace_end();
+      test_emplace_requireReallocate();
       test_resize_emptyZero();
       test_resize_emptyFourDefault();
       test_resize_emptyFourValue();
@@ -99,6 +108,7 @@ public:
       test_reserve_fourTen();
       test_reserve_standardZero();
       test_reserve_standardTen();
+      test_reserve_spyRelocate();
 
       // Remove
       test_popback_empty();
@@ -734,6 +744,31 @@ public:
       // teardown
       teardownStandardFixture(v);
    }
+
+   // reserve moves the items over and builds nothing in the spare room
+   void test_reserve_spyRelocate()
+   {  // setup
+      custom::vector<Spy> v;
+      v.push_back(Spy(26));
+      v.push_back(Spy(49));
+      Spy::reset();
+      // exercise
+      v.reserve(10);
+      // verify
+      assertUnit(Spy::numDefault() == 0);
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numCopyMove() == 2);
+      assertUnit(Spy::numDestructor() == 2);
+      assertUnit(Spy::numAlloc() == 0);
+      assertUnit(v.numCapacity == 10);
+      assertUnit(v.numElements == 2);
+      if (v.data && v.numElements == 2)
+      {
+         assertUnit(v.data[0] == Spy(26));
+         assertUnit(v.data[1] == Spy(49));
+      }
+   }  // teardown
    
    // shrink an empty fixture
    void test_shrink_empty()
@@ -1078,9 +1113,7 @@ public:
       // exercise
       vDest = std::move(vSrc);
       // verify
-      assertUnit(vDest.data != vSrc.data);
-      assertUnit(vSrc.numCapacity == 4);
-      assertUnit(vSrc.numElements == 0);
+      assertEmptyFixture(vSrc);
       //      0    1    2    3
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
@@ -1113,9 +1146,7 @@ public:
       // exercise
       vDest = std::move(vSrc);
       // verify
-      assertUnit(vDest.data != vSrc.data);
-      assertUnit(vSrc.numCapacity == 4);
-      assertUnit(vSrc.numElements == 0);
+      assertEmptyFixture(vSrc);
       //      0    1    2    3
       //    +----+----+----+----+
       //    | 26 | 49 | 67 | 89 |
@@ -1153,7 +1184,7 @@ public:
       //    +----+----+
       //    | 99 | 99 |
       //    +----+----+
-      assertUnit(vDest.numCapacity == 4);
+      assertUnit(vDest.numCapacity == 2);
       assertUnit(vDest.numElements == 2);
       assertUnit(vDest.data != nullptr);
       if (vDest.data)
@@ -1161,8 +1192,7 @@ public:
          assertUnit(vDest.data[0] == 99);
          assertUnit(vDest.data[1] == 99);
       }
-      assertUnit(vSrc.numCapacity == 2);
-      assertUnit(vSrc.numElements == 0);
+      assertEmptyFixture(vSrc);
       // teardown
       teardownStandardFixture(vSrc);
       teardownStandardFixture(vDest);
@@ -1447,7 +1477,9 @@ public:
       
       // verify
       assertUnit(value == int(89));
-//      assertStandardFixture(v);
+      assertUnit(v.data != nullptr);
+      if (v.data != nullptr)
+         assertStandardFixture(v);
       // teardown
       teardownStandardFixture(vSrc);
    }
@@ -1474,6 +1506,37 @@ public:
       teardownStandardFixture(v);
    }
    
+   // verify we can look at the back of a filled vector
+   void test_back_partiallyfilled()
+   {
+      // setup
+      //    +----+----+----+----+
+      //    | 11 | 22 |    |    |
+      //    +----+----+----+----+
+      custom::vector<int> v;
+      v.data = new int[4];
+      v.data[0] = 11;
+      v.data[1] = 22;
+      v.numElements = 2;
+      v.numCapacity = 4;
+      int value = 99;
+      // exercise
+      value = v.back();
+      // verify
+      assertUnit(value == 22);
+      assertUnit(v.numCapacity == 4);
+      assertUnit(v.numElements == 2);
+      assertUnit(v.data != nullptr);
+      if (v.data)
+      {
+         assertUnit(v.data[0] == 11);
+         assertUnit(v.data[1] == 22);
+      }
+      // teardown
+      teardownStandardFixture(v);
+   }
+
+
    /***************************************
     * POP BACK
     ***************************************/
@@ -1815,6 +1878,191 @@ public:
       // teardown
       teardownStandardFixture(v);
    }
+
+   // add an element to a full vector that grows by half
+   void test_pushback_growthHalf()
+   {  // setup
+      //      0    1    2    3
+      //    +----+----+----+----+
+      //    | 26 | 49 | 67 | 89 |
+      //    +----+----+----+----+
+      custom::vector<int, custom::growth_half> v;
+      v.data = new int[4];
+      v.data[0] = 26;
+      v.data[1] = 49;
+      v.data[2] = 67;
+      v.data[3] = 89;
+      v.numElements = 4;
+      v.numCapacity = 4;
+      // exercise
+      v.push_back(99);
+      // verify
+      //      0    1    2    3    4    5
+      //    +----+----+----+----+----+----+
+      //    | 26 | 49 | 67 | 89 | 99 |    |
+      //    +----+----+----+----+----+----+
+      assertUnit(v.numCapacity == 6);
+      assertUnit(v.numElements == 5);
+      if (v.data && v.numElements == 5)
+      {
+         assertUnit(v.data[0] == 26);
+         assertUnit(v.data[3] == 89);
+         assertUnit(v.data[4] == 99);
+      }
+   }  // teardown
+
+   // add an element of the vector itself when there is not room
+   void test_pushback_selfReallocate()
+   {  // setup
+      //      0    1    2    3
+      //    +----+----+----+----+
+      //    | 26 | 49 | 67 | 89 |
+      //    +----+----+----+----+
+      custom::vector<int> v;
+      setupStandardFixture(v);
+      // exercise
+      v.push_back(v.data[0]);
+      // verify
+      //      0    1    2    3    4    5    6    7
+      //    +----+----+----+----+----+----+----+----+
+      //    | 26 | 49 | 67 | 89 | 26 |    |    |    |
+      //    +----+----+----+----+----+----+----+----+
+      assertUnit(v.numCapacity == 8);
+      assertUnit(v.numElements == 5);
+      if (v.data && v.numElements == 5)
+         assertUnit(v.data[4] == 26);
+      v.numCapacity = 4;
+      v.numElements = 4;
+      assertStandardFixture(v);
+   }  // teardown
+
+   // build an element in place at the back when there is room
+   void test_emplaceback_spyNoCopy()
+   {  // setup
+      custom::vector<Spy> v;
+      v.reserve(4);
+      Spy::reset();
+      // exercise
+      Spy & s = v.emplace_back(99);
+      // verify
+      assertUnit(Spy::numNondefault() == 1);
+      assertUnit(Spy::numDefault() == 0);
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numCopyMove() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numAssignMove() == 0);
+      assertUnit(&s == v.data);
+      assertUnit(v.numCapacity == 4);
+      assertUnit(v.numElements == 1);
+      if (v.data && v.numElements == 1)
+         assertUnit(v.data[0].get() == 99);
+   }  // teardown
+
+   // build an element at the back when there is not room. Capacity should double
+   void test_emplaceback_requireReallocate()
+   {  // setup
+      //      0    1    2    3
+      //    +----+----+----+----+
+      //    | 26 | 49 | 67 | 89 |
+      //    +----+----+----+----+
+      custom::vector<int> v;
+      setupStandardFixture(v);
+      // exercise
+      v.emplace_back(99);
+      // verify
+      //      0    1    2    3    4    5    6    7
+      //    +----+----+----+----+----+----+----+----+
+      //    | 26 | 49 | 67 | 89 | 99 |    |    |    |
+      //    +----+----+----+----+----+----+----+----+
+      assertUnit(v.numCapacity == 8);
+      assertUnit(v.numElements == 5);
+      if (v.data && v.numElements == 5)
+         assertUnit(v.data[4] == 99);
+      v.numCapacity = 4;
+      v.numElements = 4;
+      assertStandardFixture(v);
+   }  // teardown
+
+   // build an element in the middle when there is room
+   void test_emplace_middle()
+   {  // setup
+      //      0    1    2    3
+      //    +----+----+----+----+
+      //    | 26 | 49 | 67 |    |
+      //    +----+----+----+----+
+      custom::vector<int> v;
+      v.data = new int[4];
+      v.data[0] = 26;
+      v.data[1] = 49;
+      v.data[2] = 67;
+      v.numElements = 3;
+      v.numCapacity = 4;
+      // exercise
+      custom::vector<int>::iterator it = v.emplace(custom::vector<int>::iterator(1, v), 99);
+      // verify
+      //      0    1    2    3
+      //    +----+----+----+----+
+      //    | 26 | 99 | 49 | 67 |
+      //    +----+----+----+----+
+      assertUnit(it.p == v.data + 1);
+      assertUnit(v.numCapacity == 4);
+      assertUnit(v.numElements == 4);
+      if (v.data && v.numElements == 4)
+      {
+         assertUnit(v.data[0] == 26);
+         assertUnit(v.data[1] == 99);
+         assertUnit(v.data[2] == 49);
+         assertUnit(v.data[3] == 67);
+      }
+   }  // teardown
+
+   // build an element at end() the same as emplace_back
+   void test_emplace_end()
+   {  // setup
+      custom::vector<Spy> v;
+      v.reserve(2);
+      v.emplace_back(26);
+      Spy::reset();
+      // exercise
+      v.emplace(v.end(), 49);
+      // verify
+      assertUnit(Spy::numNondefault() == 1);
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numCopyMove() == 0);
+      assertUnit(Spy::numAssignMove() == 0);
+      assertUnit(v.numElements == 2);
+      if (v.data && v.numElements == 2)
+      {
+         assertUnit(v.data[0].get() == 26);
+         assertUnit(v.data[1].get() == 49);
+      }
+   }  // teardown
+
+   // build an element at the front when there is not room
+   void test_emplace_requireReallocate()
+   {  // setup
+      //      0    1    2    3
+      //    +----+----+----+----+
+      //    | 26 | 49 | 67 | 89 |
+      //    +----+----+----+----+
+      custom::vector<int> v;
+      setupStandardFixture(v);
+      // exercise
+      v.emplace(v.begin(), v.data[3]);
+      // verify
+      //      0    1    2    3    4    5    6    7
+      //    +----+----+----+----+----+----+----+----+
+      //    | 89 | 26 | 49 | 67 | 89 |    |    |    |
+      //    +----+----+----+----+----+----+----+----+
+      assertUnit(v.numCapacity == 8);
+      assertUnit(v.numElements == 5);
+      if (v.data && v.numElements == 5)
+      {
+         assertUnit(v.data[0] == 89);
+         assertUnit(v.data[1] == 26);
+         assertUnit(v.data[4] == 89);
+      }
+   }  // teardown
    
    
    /***************************************
@@ -2081,14 +2329,12 @@ public:
       if (v.data != nullptr && false)
       {
          for (size_t i = 0; i < v.numElements; i++)
-         delete (&v.data[i]);
-         //v.alloc.deallocate(v.data, v.numCapacity);
-         
+            delete (&v.data[i]);
       }
       v.data = nullptr;
       v.numElements = v.numCapacity = 0;
    }
-   
+ 
    
    
 };
@@ -0,0 +1,238 @@
+/***********************************************************************
+ * Source:
+ *    Bench List
+ * Summary:
+ *    Time a walk through list, unrolled_list, and intrusive_list.
+ *    Every container holds the same ints, and each is walked
+ *    front to back several times. The report is nanoseconds per
+ *    element visited. list and unrolled_list are also timed
+ *    inserting into the middle, and walked again after. Then time
+ *    node churn: a list of a steady size that gains a node at the
+ *    back and loses one at the front over and over, with nodes
+ *    from new and from a pool. Last, sort
+ *    a list of NUM_SORT nodes in place, and again by copying it to
+ *    a vector, sorting that, and copying it back. Build the
+ *    BenchList project in Release, or:
+ *       g++ -O2 -std=c++14 benchList.cpp
+ * Author
+ *    Noah Li, Steven Sellers, Josh Hamilton.
+ ************************************************************************/
+
+#include "list.h"            // for list
+#include "unrolled_list.h"   // for unrolled_list
+#include "intrusive_list.h"  // for intrusive_list and list_hook
+
+#include <algorithm>         // for std::sort
+#include <chrono>            // for steady_clock
+#include <cstddef>           // for size_t
+#include <iomanip>           // for setw and setprecision
+#include <iostream>          // for cout
+#include <vector>            // for the intrusive_list elements and the sort copy
+
+/**********************************************************************
+ * ITEM
+ * An int that can sit in an intrusive_list
+ ***********************************************************************/
+struct Item : public custom::list_hook<>
+{
+   Item(int value) : value(value) {}
+   int value;
+};
+
+const size_t NUM_ELEMENTS = 1000000;   // elements in every container
+const int    NUM_PASSES   = 20;        // walks through each container
+const size_t NUM_CHURN    = 10000000;  // nodes added and removed in the churn
+const size_t CHURN_DEPTH  = 1000;      // nodes in the list while it churns
+const size_t NUM_SORT     = 10000000;  // nodes in the list being sorted
+const size_t NUM_INSERTS  = 1000000;   // inserts into the middle of a list
+
+/**********************************************************************
+ * VALUE AT
+ * The i'th value. A fixed scramble of 0 .. NUM_ELEMENTS-1, so sorting
+ * a list by value leaves its nodes in no order in memory
+ ***********************************************************************/
+int valueAt(size_t i)
+{
+   return int((i * 7919) % NUM_ELEMENTS);
+}
+
+/**********************************************************************
+ * TIME WALK
+ * Walk [begin, end) NUM_PASSES times and report the cost per element,
+ * of which there are num. The sum is printed so the walk cannot be
+ * optimized away
+ ***********************************************************************/
+template <class Iterator, class Value>
+void timeWalk(const char * name, Iterator begin, Iterator end, Value value,
+              size_t num = NUM_ELEMENTS)
+{
+   long long sum = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (int pass = 0; pass < NUM_PASSES; pass++)
+      for (Iterator it = begin; it != end; ++it)
+         sum += value(*it);
+   auto finish = std::chrono::steady_clock::now();
+
+   double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+   std::cout << std::left  << std::setw(28) << name
+             << std::right << std::setw(8)  << std::fixed << std::setprecision(2)
+             << ns / (double(num) * NUM_PASSES) << " ns/element"
+             << "   (sum " << sum << ")\n";
+}
+
+/**********************************************************************
+ * TIME MIDDLE INSERT
+ * Walk to the middle of l, then insert NUM_INSERTS values there,
+ * each in front of the last. Only the inserts are timed
+ ***********************************************************************/
+template <class List>
+void timeMiddleInsert(const char * name, List & l)
+{
+   auto it = l.begin();
+   for (size_t i = 0; i < l.size() / 2; i++)
+      ++it;
+
+   auto start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < NUM_INSERTS; i++)
+      it = l.insert(it, valueAt(i));
+   auto finish = std::chrono::steady_clock::now();
+
+   double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+   std::cout << std::left  << std::setw(28) << name
+             << std::right << std::setw(8)  << std::fixed << std::setprecision(2)
+             << ns / double(NUM_INSERTS) << " ns/insert"
+             << "   (size " << l.size() << ")\n";
+}
+
+/**********************************************************************
+ * TIME CHURN
+ * Keep CHURN_DEPTH nodes in a list while NUM_CHURN of them come and
+ * go, and report the cost of each push_back/pop_front pair. Every
+ * pair frees one node and allocates another
+ ***********************************************************************/
+template <class List>
+void timeChurn(const char * name)
+{
+   List l;
+   for (size_t i = 0; i < CHURN_DEPTH; i++)
+      l.push_back(valueAt(i));
+
+   long long sum = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < NUM_CHURN; i++)
+   {
+      sum += l.front();
+      l.pop_front();
+      l.push_back(int(i));
+   }
+   auto finish = std::chrono::steady_clock::now();
+
+   double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+   std::cout << std::left  << std::setw(28) << name
+             << std::right << std::setw(8)  << std::fixed << std::setprecision(2)
+             << ns / double(NUM_CHURN) << " ns/pair"
+             << "   (sum " << sum << ")\n";
+}
+
+/**********************************************************************
+ * TIME SORT
+ * Fill a list with NUM_SORT scrambled values, sort it with sort, and
+ * report the cost per element. The list is checked afterwards, so
+ * a sort that skips the work shows
+ ***********************************************************************/
+template <class Sort>
+void timeSort(const char * name, Sort sort)
+{
+   custom::list<int> l;
+   for (size_t i = 0; i < NUM_SORT; i++)
+      l.push_back(int((i * 7919) % NUM_SORT));
+
+   auto start = std::chrono::steady_clock::now();
+   sort(l);
+   auto finish = std::chrono::steady_clock::now();
+
+   int expect = 0;
+   bool isSorted = true;
+   for (auto it = l.cbegin(); it != l.cend(); ++it, ++expect)
+      isSorted = isSorted && *it == expect;
+
+   double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+   std::cout << std::left  << std::setw(28) << name
+             << std::right << std::setw(8)  << std::fixed << std::setprecision(2)
+             << ns / double(NUM_SORT) << " ns/element"
+             << (isSorted ? "   (sorted)\n" : "   (NOT SORTED)\n");
+}
+
+/**********************************************************************
+ * MAIN
+ * Fill each container with the same values, then walk them
+ ***********************************************************************/
+int main()
+{
+   auto asInt = [](const int & value) { return value; };
+   auto asItem = [](const Item & item) { return item.value; };
+
+   std::cout << NUM_ELEMENTS << " elements, " << NUM_PASSES << " passes\n";
+
+   // a list filled in order, with nodes allocated one after another
+   custom::list<int> l;
+   for (size_t i = 0; i < NUM_ELEMENTS; i++)
+      l.push_back(valueAt(i));
+   timeWalk("list", l.cbegin(), l.cend(), asInt);
+
+   // the same list after sort() relinks the nodes out of memory order
+   l.sort();
+   timeWalk("list (sorted, scattered)", l.cbegin(), l.cend(), asInt);
+
+   // the same list drawing its nodes from a pool
+   custom::list<int, custom::pool_allocator<int>> lPool;
+   for (size_t i = 0; i < NUM_ELEMENTS; i++)
+      lPool.push_back(valueAt(i));
+   timeWalk("list (pool)", lPool.cbegin(), lPool.cend(), asInt);
+
+   // B elements side by side in every node
+   custom::unrolled_list<int> lUnrolled;
+   for (size_t i = 0; i < NUM_ELEMENTS; i++)
+      lUnrolled.push_back(valueAt(i));
+   timeWalk("unrolled_list", lUnrolled.begin(), lUnrolled.end(), asInt);
+
+   // the elements live in a vector and the list only links them.
+   // items outlives lIntrusive, which unlinks them all on the way out
+   std::vector<Item> items;
+   items.reserve(NUM_ELEMENTS);
+   for (size_t i = 0; i < NUM_ELEMENTS; i++)
+      items.push_back(Item(valueAt(i)));
+   custom::intrusive_list<Item> lIntrusive;
+   for (Item & item : items)
+      lIntrusive.push_back(item);
+   timeWalk("intrusive_list", lIntrusive.begin(), lIntrusive.end(), asItem);
+
+   // a node per insert, against a node split every B inserts
+   std::cout << NUM_INSERTS << " inserts into the middle\n";
+   timeMiddleInsert("list", l);
+   timeMiddleInsert("unrolled_list", lUnrolled);
+
+   // and the walks again, now that the middle has grown
+   timeWalk("list (inserted)", l.cbegin(), l.cend(), asInt, l.size());
+   timeWalk("unrolled_list (inserted)", lUnrolled.begin(), lUnrolled.end(), asInt,
+            lUnrolled.size());
+
+   // a node freed and another allocated for every pair
+   std::cout << NUM_CHURN << " push_back/pop_front pairs, " << CHURN_DEPTH << " deep\n";
+   timeChurn<custom::list<int>>("list (new and delete)");
+   timeChurn<custom::list<int, custom::pool_allocator<int>>>("list (pool)");
+
+   // relink the nodes where they are, or take a copy of every value
+   std::cout << NUM_SORT << " elements sorted\n";
+   timeSort("list::sort", [](custom::list<int> & l) { l.sort(); });
+   timeSort("copy to vector and back", [](custom::list<int> & l)
+   {
+      std::vector<int> values(l.cbegin(), l.cend());
+      std::sort(values.begin(), values.end());
+      auto itValue = values.begin();
+      for (auto it = l.begin(); it != l.end(); ++it, ++itValue)
+         *it = *itValue;
+   });
+
+   return 0;
+}
@@ -0,0 +1,413 @@
+/***********************************************************************
+ * Header:
+ *    INTRUSIVE LIST
+ * Summary:
+ *    A list threaded through hooks inside the elements themselves
+ *      __       ____       ____         __
+ *     /  |    .'    '.   .'    '.   _  / /
+ *     `| |   |  .--.  | |  .--.  | (_)/ /
+ *      | |   | |    | | | |    | |   / / _
+ *     _| |_  |  `--'  | |  `--'  |  / / (_)
+ *    |_____|  '.____.'   '.____.'  /_/
+ *
+ *
+ *    This will contain the class definition of:
+ *        list_hook                : The links an element carries
+ *        intrusive_list           : A list of elements it does not own
+ *        intrusive_list::iterator : An iterator through intrusive_list
+ * Author
+ *    Noah Li, Steven Sellers, Josh Hamilton.
+ ************************************************************************/
+
+#pragma once
+#include <cassert>     // for ASSERT
+#include <cstddef>     // for size_t
+#include <stdexcept>   // for std::out_of_range
+#include <utility>     // for std::swap
+
+class TestIntrusiveList;   // forward declaration for unit tests
+
+namespace custom
+{
+
+// the tag of a hook when an element is only in one kind of list
+struct default_list_tag {};
+
+/**************************************************
+ * LIST HOOK
+ * pNext and pPrev, embedded in the element by inheriting from
+ * this. An element in several lists at once inherits one hook
+ * per list, each with its own Tag. An unlinked hook points at
+ * itself. Copying an element does not copy its place in a list
+ **************************************************/
+template <class Tag = default_list_tag>
+class list_hook
+{
+   template <class T, class TT>
+   friend class intrusive_list;
+   friend class ::TestIntrusiveList; // give unit tests access to the privates
+public:
+   list_hook() noexcept : pNext(this), pPrev(this) {}
+   list_hook(const list_hook&) noexcept : pNext(this), pPrev(this) {}
+   list_hook& operator = (const list_hook&) noexcept { return *this; }
+
+   // an element must leave its lists before it is destroyed
+  ~list_hook()
+   {
+      assert(!is_linked());
+   }
+
+   bool is_linked() const noexcept { return pNext != this; }
+
+private:
+   list_hook * pNext;   // next hook in the list, or nullptr at the tail
+   list_hook * pPrev;   // previous hook in the list, or nullptr at the head
+};
+
+/**************************************************
+ * INTRUSIVE LIST
+ * A list of elements that live somewhere else. T inherits
+ * list_hook<Tag>, and the list only relinks those hooks:
+ * inserting and removing never allocate or copy. The list
+ * neither owns nor destroys its elements. Clearing or
+ * destroying it unlinks them all.
+ **************************************************/
+template <class T, class Tag = default_list_tag>
+class intrusive_list
+{
+   friend class ::TestIntrusiveList; // give unit tests access to the privates
+   using Hook = list_hook<Tag>;
+public:
+   //
+   // Construct
+   //
+
+   intrusive_list() : numElements(0), pHead(nullptr), pTail(nullptr) {}
+   intrusive_list(const intrusive_list& rhs) = delete;
+   intrusive_list(intrusive_list&& rhs) : numElements(rhs.numElements), pHead(rhs.pHead), pTail(rhs.pTail)
+   {
+      rhs.pHead = rhs.pTail = nullptr;
+      rhs.numElements = 0;
+   }
+  ~intrusive_list()
+   {
+      clear();
+   }
+
+   //
+   // Assign
+   //
+
+   intrusive_list& operator = (const intrusive_list& rhs) = delete;
+   intrusive_list& operator = (intrusive_list&& rhs);
+   void swap(intrusive_list& rhs);
+
+   //
+   // Iterator
+   //
+
+   class iterator;
+   iterator begin() { return iterator(this, pHead);   }
+   iterator end()   { return iterator(this, nullptr); }
+   iterator iterator_to(T& t);
+
+   //
+   // Access
+   //
+
+   T& front();
+   T& back();
+
+   //
+   // Insert
+   //
+
+   void push_front(T& t) { linkBefore(pHead, hookOf(t)); }
+   void push_back (T& t) { linkBefore(nullptr, hookOf(t)); }
+   iterator insert(iterator it, T& t);
+
+   //
+   // Remove
+   //
+
+   void pop_back();
+   void pop_front();
+   void clear();
+   iterator erase(const iterator& it);
+   void remove(T& t) { unlink(hookOf(t)); }
+
+   //
+   // Status
+   //
+
+   bool empty()  const { return size() == 0; }
+   size_t size() const { return numElements; }
+
+private:
+   // a hook and the element around it
+   static Hook * hookOf(T& t) { return static_cast<Hook*>(&t); }
+   static T & valueOf(Hook * pHook) { return static_cast<T&>(*pHook); }
+
+   void linkBefore(Hook * pPos, Hook * pHook);
+   void unlink(Hook * pHook);
+
+   // member variables
+   size_t numElements; // though we could count, it is faster to keep a variable
+   Hook * pHead;       // hook of the first element
+   Hook * pTail;       // hook of the last element
+};
+
+/*************************************************
+ * INTRUSIVE LIST ITERATOR
+ * Iterate through an intrusive list. Just like a list
+ * iterator, but it walks the hooks
+ ************************************************/
+template <class T, class Tag>
+class intrusive_list <T, Tag> :: iterator
+{
+   friend class ::TestIntrusiveList; // give unit tests access to the privates
+   template <class TT, class TTag>
+   friend class custom::intrusive_list;
+public:
+   // constructors, destructors, and assignment operator
+   iterator() : pList(nullptr), p(nullptr) {}
+   iterator(Hook * p) : pList(nullptr), p(p) {}
+   iterator(intrusive_list * pList, Hook * p) : pList(pList), p(p) {}
+   iterator(const iterator& rhs) = default;
+   iterator & operator = (const iterator & rhs) = default;
+
+   // equals, not equals operator
+   bool operator == (const iterator & rhs) const { return p == rhs.p; }
+   bool operator != (const iterator & rhs) const { return p != rhs.p; }
+
+   // dereference operator, fetch the element
+   T & operator * () const
+   {
+      if (p)
+         return valueOf(p);
+      throw std::out_of_range("Dereferencing end iterator");
+   }
+   T * operator -> () const
+   {
+      return &**this;
+   }
+
+   // prefix increment
+   iterator & operator ++ ()
+   {
+      if (p)
+         p = p->pNext;
+      return *this;
+   }
+
+   // postfix increment
+   iterator operator ++ (int postfix)
+   {
+      iterator pre = *this;
+      ++*this;
+      return pre;
+   }
+
+   // prefix decrement. end() steps back onto the tail
+   iterator & operator -- ()
+   {
+      if (p)
+         p = p->pPrev;
+      else if (pList)
+         p = pList->pTail;
+      return *this;
+   }
+
+   // postfix decrement
+   iterator operator -- (int postfix)
+   {
+      iterator pre = *this;
+      --*this;
+      return pre;
+   }
+
+private:
+   intrusive_list * pList;   // the list we walk, for --end()
+   Hook * p;
+};
+
+/**********************************************
+ * INTRUSIVE LIST :: assignment operator - MOVE
+ * Unlink our elements and take over the RHS's
+ *     COST   : O(n) with respect to the size of the LHS
+ *********************************************/
+template <class T, class Tag>
+intrusive_list <T, Tag> & intrusive_list <T, Tag> :: operator = (intrusive_list&& rhs)
+{
+   if (this != &rhs)
+   {
+      clear();
+      swap(rhs);
+   }
+   return *this;
+}
+
+/**********************************************
+ * INTRUSIVE LIST :: SWAP
+ *     COST   : O(1)
+ *********************************************/
+template <class T, class Tag>
+void intrusive_list <T, Tag> ::swap(intrusive_list& rhs)
+{
+   std::swap(pHead, rhs.pHead);
+   std::swap(pTail, rhs.pTail);
+   std::swap(numElements, rhs.numElements);
+}
+
+template <class T, class Tag>
+void swap(intrusive_list <T, Tag> & lhs, intrusive_list <T, Tag> & rhs)
+{
+   lhs.swap(rhs);
+}
+
+/**********************************************
+ * INTRUSIVE LIST :: ITERATOR TO
+ * An iterator to an element already in this list
+ *     COST   : O(1)
+ *********************************************/
+template <class T, class Tag>
+typename intrusive_list <T, Tag> ::iterator intrusive_list <T, Tag> ::iterator_to(T& t)
+{
+   assert(hookOf(t)->is_linked());
+   return iterator(this, hookOf(t));
+}
+
+/*********************************************
+ * INTRUSIVE LIST :: FRONT and BACK
+ *     COST   : O(1)
+ *********************************************/
+template <class T, class Tag>
+T & intrusive_list <T, Tag> ::front()
+{
+   if (pHead == nullptr)
+      throw std::out_of_range("front() of an empty intrusive_list");
+   return valueOf(pHead);
+}
+
+template <class T, class Tag>
+T & intrusive_list <T, Tag> ::back()
+{
+   if (pTail == nullptr)
+      throw std::out_of_range("back() of an empty intrusive_list");
+   return valueOf(pTail);
+}
+
+/******************************************
+ * INTRUSIVE LIST :: INSERT
+ * link t in front of it
+ *     INPUT  : where t goes, and an unlinked element
+ *     OUTPUT : iterator to t
+ *     COST   : O(1)
+ ******************************************/
+template <class T, class Tag>
+typename intrusive_list <T, Tag> ::iterator intrusive_list <T, Tag> ::insert(iterator it, T& t)
+{
+   linkBefore(it.p, hookOf(t));
+   return iterator(this, hookOf(t));
+}
+
+/*********************************************
+ * INTRUSIVE LIST :: POP BACK and POP FRONT
+ * unlink the element at one end. It is not destroyed
+ *     COST   : O(1)
+ *********************************************/
+template <class T, class Tag>
+void intrusive_list <T, Tag> ::pop_back()
+{
+   if (pTail)
+      unlink(pTail);
+}
+
+template <class T, class Tag>
+void intrusive_list <T, Tag> ::pop_front()
+{
+   if (pHead)
+      unlink(pHead);
+}
+
+/**********************************************
+ * INTRUSIVE LIST :: CLEAR
+ * Unlink every element so each may join another list
+ *     COST   : O(n)
+ *********************************************/
+template <class T, class Tag>
+void intrusive_list <T, Tag> ::clear()
+{
+   while (pHead != nullptr)
+   {
+      Hook * pHook = pHead;
+      pHead = pHead->pNext;
+      pHook->pNext = pHook->pPrev = pHook;
+   }
+   pTail = nullptr;
+   numElements = 0;
+}
+
+/******************************************
+ * INTRUSIVE LIST :: ERASE
+ * unlink the element at it. It is not destroyed
+ *     INPUT  : an iterator to the element being removed
+ *     OUTPUT : iterator to the element after it
+ *     COST   : O(1)
+ ******************************************/
+template <class T, class Tag>
+typename intrusive_list <T, Tag> ::iterator intrusive_list <T, Tag> ::erase(const iterator& it)
+{
+   if (it.p == nullptr)
+      return end();
+
+   Hook * pNext = it.p->pNext;
+   unlink(it.p);
+   return iterator(this, pNext);
+}
+
+/**************************************************
+ * INTRUSIVE LIST :: LINK BEFORE
+ * Hang an unlinked hook in front of pPos, or off the
+ * tail when pPos is nullptr
+ *************************************************/
+template <class T, class Tag>
+void intrusive_list <T, Tag> ::linkBefore(Hook * pPos, Hook * pHook)
+{
+   assert(!pHook->is_linked());
+   Hook * pPrev = (pPos ? pPos->pPrev : pTail);
+   pHook->pPrev = pPrev;
+   pHook->pNext = pPos;
+   if (pPrev)
+      pPrev->pNext = pHook;
+   else
+      pHead = pHook;
+   if (pPos)
+      pPos->pPrev = pHook;
+   else
+      pTail = pHook;
+   numElements++;
+}
+
+/**************************************************
+ * INTRUSIVE LIST :: UNLINK
+ * Take a hook out of this list and mark it unlinked.
+ * The hook must be in this list, not another of the same Tag
+ *************************************************/
+template <class T, class Tag>
+void intrusive_list <T, Tag> ::unlink(Hook * pHook)
+{
+   assert(pHook->is_linked());
+   if (pHook->pPrev)
+      pHook->pPrev->pNext = pHook->pNext;
+   else
+      pHead = pHook->pNext;
+   if (pHook->pNext)
+      pHook->pNext->pPrev = pHook->pPrev;
+   else
+      pTail = pHook->pPrev;
+   pHook->pNext = pHook->pPrev = pHook;
+   numElements--;
+}
+
+}; // namespace custom
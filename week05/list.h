@@ -12,17 +12,24 @@
  *
  *
  *    This will contain the class definition of:
- *        List         : A class that represents a List
- *        ListIterator : An iterator through List
+ *        List                  : A class that represents a List
+ *        ListIterator          : An iterator through List
+ *        ListConstIterator     : An iterator that cannot change the List
+ *        ListReverseIterator   : An iterator from the back of the List
  * Author
  *    Noah Li, Steven Sellers, Josh Hamilton.
  ************************************************************************/
 
 #pragma once
 #include <cassert>     // for ASSERT
+#include <functional>  // for std::less
 #include <iostream>    // for nullptr
+#include <iterator>    // for std::bidirectional_iterator_tag
+#include <stdexcept>   // for std::out_of_range
 #include <new>         // std::bad_alloc
 #include <memory>      // for std::allocator
+#include <type_traits> // for std::is_trivially_destructible
+#include "pool.h"      // for releaseAll
  
 class TestList;        // forward declaration for unit tests
 class TestHash;        // to be used later
@@ -32,22 +39,27 @@ namespace custom
 
 /**************************************************
  * LIST
- * Just like std::list
+ * Just like std::list. Every node comes from A, rebound to
+ * the node type. With pool_allocator the nodes sit together in
+ * slabs and a freed node is reused by the next insert. Lists
+ * whose allocators compare equal share one pool, so a node from
+ * one may be relinked into the other. splice, merge and sort only
+ * relink nodes: nothing is allocated, copied or moved.
  **************************************************/
-template <typename T>
+template <typename T, typename A = std::allocator<T>>
 class list
 {
    friend class ::TestList; // give unit tests access to the privates
    friend class ::TestHash;
-   friend void swap(list& lhs, list& rhs);
 public:  
    // 
    // Construct
    //
 
    list();
-   list(list <T> & rhs);
-   list(list <T>&& rhs);
+   explicit list(const A& a);
+   list(const list <T, A> & rhs);
+   list(list <T, A>&& rhs);
    list(size_t num, const T & t);
    list(size_t num);
    list(const std::initializer_list<T>& il);
@@ -55,25 +67,34 @@ public:
    list(Iterator first, Iterator last);
   ~list() 
    {
+      clear();
    }
 
    // 
    // Assign
    //
 
-   list <T> & operator = (list &  rhs);
-   list <T> & operator = (list && rhs);
-   list <T> & operator = (const std::initializer_list<T>& il);
-   void swap(list <T>& rhs);
+   list <T, A> & operator = (list &  rhs);
+   list <T, A> & operator = (list && rhs);
+   list <T, A> & operator = (const std::initializer_list<T>& il);
+   void swap(list <T, A>& rhs);
+   A get_allocator() const { return A(alloc); }
 
    //
    // Iterator
    //
 
    class  iterator;
-   iterator begin()  { return iterator(); }
-   iterator rbegin() { return iterator(); }
-   iterator end()    { return iterator(); }
+   class  const_iterator;
+   class  reverse_iterator;
+   iterator         begin()        { return iterator(this, pHead);           }
+   iterator         end()          { return iterator(this, nullptr);         }
+   const_iterator   begin()  const { return const_iterator(this, pHead);     }
+   const_iterator   end()    const { return const_iterator(this, nullptr);   }
+   const_iterator   cbegin() const { return const_iterator(this, pHead);     }
+   const_iterator   cend()   const { return const_iterator(this, nullptr);   }
+   reverse_iterator rbegin()       { return reverse_iterator(this, pTail);   }
+   reverse_iterator rend()         { return reverse_iterator(this, nullptr); }
 
    //
    // Access
@@ -81,6 +102,8 @@ public:
 
    T& front();
    T& back();
+   const T& front() const { return const_cast<list*>(this)->front(); }
+   const T& back()  const { return const_cast<list*>(this)->back();  }
 
    //
    // Insert
@@ -102,6 +125,20 @@ public:
    void clear();
    iterator erase(const iterator& it);
 
+   //
+   // Relink
+   //
+
+   void splice(iterator pos, list <T, A> & rhs);
+   void splice(iterator pos, list <T, A> & rhs, iterator it);
+   void splice(iterator pos, list <T, A> & rhs, iterator first, iterator last);
+   void merge(list <T, A> & rhs) { merge(rhs, std::less<T>()); }
+   template <class Compare>
+   void merge(list <T, A> & rhs, Compare comp);
+   void sort() { sort(std::less<T>()); }
+   template <class Compare>
+   void sort(Compare comp);
+
    // 
    // Status
    //
@@ -114,10 +151,27 @@ private:
    // nested linked list class
    class Node;
 
+   using NodeAlloc  = typename std::allocator_traits<A>::template rebind_alloc<Node>;
+   using NodeTraits = std::allocator_traits<NodeAlloc>;
+
+   // every node is created and destroyed through the allocator
+   template <class ... Args>
+   Node * createNode(Args&& ... args);
+   void destroyNode(Node * pNode) noexcept;
+   void linkBack(Node * pNode);
+
+   // splice, merge and sort work on chains of nodes
+   void unlinkRange(Node * pFirst, Node * pLast) noexcept;
+   void linkRange(Node * pPos, Node * pFirst, Node * pLast) noexcept;
+   void restorePrev() noexcept;
+   template <class Compare>
+   static Node * mergeChains(Node * pLeft, Node * pRight, Compare & comp);
+
    // member variables
    size_t numElements; // though we could count, it is faster to keep a variable
    Node * pHead;    // pointer to the beginning of the list
    Node * pTail;    // pointer to the ending of the list
+   NodeAlloc alloc; // where the nodes come from
 };
 
 /*************************************************
@@ -127,8 +181,8 @@ private:
  * private.  This is the case because only the
  * List class can make validation decisions
  *************************************************/
-template <typename T>
-class list <T> :: Node
+template <typename T, typename A>
+class list <T, A> :: Node
 {
 public:
    //
@@ -152,41 +206,37 @@ public:
 
 /*************************************************
  * LIST ITERATOR
- * Iterate through a List, non-constant version
+ * Iterate through a List, non-constant version.
+ * end() is a null node. Nothing is allocated. The
+ * iterator knows its list so --end() finds pTail
  ************************************************/
-template <typename T>
-class list <T> :: iterator
+template <typename T, typename A>
+class list <T, A> :: iterator
 {
    friend class ::TestList; // give unit tests access to the privates
    friend class ::TestHash;
-   template <typename TT>
+   template <typename TT, typename AA>
    friend class custom::list;
 public:
+   using iterator_category = std::bidirectional_iterator_tag;
+   using value_type        = T;
+   using difference_type   = std::ptrdiff_t;
+   using pointer           = T*;
+   using reference         = T&;
+
    // constructors, destructors, and assignment operator
-   iterator() 
-   {
-      p = new typename list <T> ::Node;
-   }
-   iterator(Node * p) 
-   {
-      this->p = p;
-   }
-   iterator(const iterator  & rhs) 
-   {
-      this->p = rhs.p;
-   }
-   iterator & operator = (const iterator & rhs)
-   {
-      this->p = p;
-      return *this;
-   }
+   iterator() : pList(nullptr), p(nullptr) {}
+   iterator(Node * p) : pList(nullptr), p(p) {}
+   iterator(list * pList, Node * p) : pList(pList), p(p) {}
+   iterator(const iterator & rhs) = default;
+   iterator & operator = (const iterator & rhs) = default;
    
    // equals, not equals operator
    bool operator == (const iterator & rhs) const { return this->p == rhs.p; }
    bool operator != (const iterator & rhs) const { return this->p != rhs.p; }
 
    // dereference operator, fetch a node
-   T & operator * ()
+   T & operator * () const
    {
       if (p)
       {
@@ -194,15 +244,16 @@ public:
       }
       throw std::out_of_range("Dereferencing end iterator");
    }
+   T * operator -> () const
+   {
+      return &**this;
+   }
 
    // postfix increment
    iterator operator ++ (int postfix)
    {
       iterator pre = *this;
-      if (p)
-      {
-         p = p->pNext;
-      }
+      ++*this;
       return pre;
    }
 
@@ -220,58 +271,211 @@ public:
    iterator operator -- (int postfix)
    {
       iterator pre = *this;
-      if (p)
-      {
-         p = p->pPrev;
-      }
+      --*this;
       return pre;
    }
 
-   // prefix decrement
+   // prefix decrement. end() steps back onto the tail
    iterator & operator -- ()
    {
       if (p)
       {
          p = p->pPrev;
       }
+      else if (pList)
+      {
+         p = pList->pTail;
+      }
       return *this;
    } 
 
    // two friends who need to access p directly
-   friend iterator list <T> :: insert(iterator it, const T &  data);
-   friend iterator list <T> :: insert(iterator it,       T && data);
-   friend iterator list <T> :: erase(const iterator & it);
+   friend iterator list <T, A> :: insert(iterator it, const T &  data);
+   friend iterator list <T, A> :: insert(iterator it,       T && data);
+   friend iterator list <T, A> :: erase(const iterator & it);
+
+private:
+
+   list <T, A> * pList;             // the list we walk, for --end()
+   typename list <T, A> :: Node * p;
+};
+
+/*************************************************
+ * LIST CONST ITERATOR
+ * Iterate through a List without changing it. Any
+ * iterator converts to one of these
+ ************************************************/
+template <typename T, typename A>
+class list <T, A> :: const_iterator
+{
+   friend class ::TestList; // give unit tests access to the privates
+public:
+   using iterator_category = std::bidirectional_iterator_tag;
+   using value_type        = T;
+   using difference_type   = std::ptrdiff_t;
+   using pointer           = const T*;
+   using reference         = const T&;
+
+   // constructors, destructors, and assignment operator
+   const_iterator() : pList(nullptr), p(nullptr) {}
+   const_iterator(const Node * p) : pList(nullptr), p(p) {}
+   const_iterator(const list * pList, const Node * p) : pList(pList), p(p) {}
+   const_iterator(const iterator & rhs) : pList(rhs.pList), p(rhs.p) {}
+   const_iterator(const const_iterator & rhs) = default;
+   const_iterator & operator = (const const_iterator & rhs) = default;
+
+   // equals, not equals operator
+   bool operator == (const const_iterator & rhs) const { return p == rhs.p; }
+   bool operator != (const const_iterator & rhs) const { return p != rhs.p; }
+
+   // dereference operator, fetch a node
+   const T & operator * () const
+   {
+      if (p)
+         return p->data;
+      throw std::out_of_range("Dereferencing end iterator");
+   }
+   const T * operator -> () const
+   {
+      return &**this;
+   }
+
+   // prefix and postfix increment
+   const_iterator & operator ++ ()
+   {
+      if (p)
+         p = p->pNext;
+      return *this;
+   }
+   const_iterator operator ++ (int postfix)
+   {
+      const_iterator pre = *this;
+      ++*this;
+      return pre;
+   }
+
+   // prefix and postfix decrement. end() steps back onto the tail
+   const_iterator & operator -- ()
+   {
+      if (p)
+         p = p->pPrev;
+      else if (pList)
+         p = pList->pTail;
+      return *this;
+   }
+   const_iterator operator -- (int postfix)
+   {
+      const_iterator pre = *this;
+      --*this;
+      return pre;
+   }
 
 private:
+   const list * pList;   // the list we walk, for --end()
+   const Node * p;
+};
+
+/*************************************************
+ * LIST REVERSE ITERATOR
+ * Iterate through a List from pTail to pHead. ++ follows
+ * pPrev, and rend() is a null node, just as end() is.
+ * As with std::reverse_iterator, base() is one element
+ * further along walking forward
+ ************************************************/
+template <typename T, typename A>
+class list <T, A> :: reverse_iterator
+{
+   friend class ::TestList; // give unit tests access to the privates
+public:
+   using iterator_category = std::bidirectional_iterator_tag;
+   using value_type        = T;
+   using difference_type   = std::ptrdiff_t;
+   using pointer           = T*;
+   using reference         = T&;
+
+   // constructors, destructors, and assignment operator
+   reverse_iterator() : pList(nullptr), p(nullptr) {}
+   reverse_iterator(list * pList, Node * p) : pList(pList), p(p) {}
+   reverse_iterator(const reverse_iterator & rhs) = default;
+   reverse_iterator & operator = (const reverse_iterator & rhs) = default;
+
+   // the element after this one walking forward, so rbegin().base()
+   // is end() and rend().base() is begin()
+   iterator base() const
+   {
+      if (p)
+         return iterator(pList, p->pNext);
+      return iterator(pList, pList ? pList->pHead : nullptr);
+   }
+
+   // equals, not equals operator
+   bool operator == (const reverse_iterator & rhs) const { return p == rhs.p; }
+   bool operator != (const reverse_iterator & rhs) const { return p != rhs.p; }
+
+   // dereference operator, fetch a node
+   T & operator * () const
+   {
+      if (p)
+         return p->data;
+      throw std::out_of_range("Dereferencing end iterator");
+   }
+   T * operator -> () const
+   {
+      return &**this;
+   }
+
+   // prefix and postfix increment, toward the head
+   reverse_iterator & operator ++ ()
+   {
+      if (p)
+         p = p->pPrev;
+      return *this;
+   }
+   reverse_iterator operator ++ (int postfix)
+   {
+      reverse_iterator pre = *this;
+      ++*this;
+      return pre;
+   }
+
+   // prefix and postfix decrement, toward the tail. rend() steps
+   // back onto the head
+   reverse_iterator & operator -- ()
+   {
+      if (p)
+         p = p->pNext;
+      else if (pList)
+         p = pList->pHead;
+      return *this;
+   }
+   reverse_iterator operator -- (int postfix)
+   {
+      reverse_iterator pre = *this;
+      --*this;
+      return pre;
+   }
 
-   typename list <T> :: Node * p;
+private:
+   list * pList;   // the list we walk, for --rend()
+   Node * p;
 };
 
 /*****************************************
  * LIST :: NON-DEFAULT constructors
  * Create a list initialized to a value
  ****************************************/
-template <typename T>
-list <T> ::list(size_t num, const T & t) 
+template <typename T, typename A>
+list <T, A> ::list(size_t num, const T & t) : list()
 {
-   numElements = num;
-   if (num == 0)
+   try
    {
-      pHead = pTail = nullptr;
+      for (size_t i = 0; i < num; i++)
+         linkBack(createNode(t));
    }
-   else
+   catch (...)
    {
-      Node* currentNode = new Node(t);
-      pHead = currentNode;
-      Node* nextNode;
-      for (int i = 1; i < num; i++)
-      {
-         nextNode = new Node(t);
-         currentNode->pNext = nextNode;
-         nextNode->pPrev = currentNode;
-         currentNode = nextNode;
-      }
-      pTail = currentNode;
+      clear();
+      throw;
    }
 }
 
@@ -279,93 +483,98 @@ list <T> ::list(size_t num, const T & t)
  * LIST :: ITERATOR constructors
  * Create a list initialized to a set of values
  ****************************************/
-template <typename T>
+template <typename T, typename A>
 template <class Iterator>
-list <T> ::list(Iterator first, Iterator last)
+list <T, A> ::list(Iterator first, Iterator last) : list()
 {
-   numElements = 99;
-   pHead = pTail = new list <T> ::Node();
+   try
+   {
+      for (Iterator it = first; it != last; ++it)
+         linkBack(createNode(*it));
+   }
+   catch (...)
+   {
+      clear();
+      throw;
+   }
 }
 
 /*****************************************
  * LIST :: INITIALIZER constructors
  * Create a list initialized to a set of values
  ****************************************/
-template <typename T>
-list <T> ::list(const std::initializer_list<T>& il)
+template <typename T, typename A>
+list <T, A> ::list(const std::initializer_list<T>& il) : list(il.begin(), il.end())
 {
-   if (il.size() == 0) return;
-
-   auto it = il.begin();
-   pHead = new Node(*it);
-   Node* current = pHead;
-   for (++it; it != il.end(); ++it)
-   {
-      current->pNext = new Node(*it);
-      current->pNext->pPrev = current;
-      current = current->pNext;
-   }
-   pTail = current;
-   numElements = il.size(); 
 }
 
 /*****************************************
  * LIST :: NON-DEFAULT constructors
- * Create a list initialized to a value
+ * Create a list of default values
  ****************************************/
-template <typename T>
-list <T> ::list(size_t num)
+template <typename T, typename A>
+list <T, A> ::list(size_t num) : list()
 {
-   numElements = num;
-   if (num == 0)
+   try
    {
-      pHead = pTail = nullptr;
+      for (size_t i = 0; i < num; i++)
+         linkBack(createNode());
    }
-   else
+   catch (...)
    {
-      Node * currentNode = new Node(0);
-      pHead = currentNode;
-      Node * nextNode;
-      for (int i = 1; i < num; i++)
-      {
-         nextNode = new Node(0);
-         currentNode->pNext = nextNode;
-         nextNode->pPrev = currentNode;
-         currentNode = nextNode;
-      }
-      pTail = currentNode;
+      clear();
+      throw;
    }
 }
 
 /*****************************************
  * LIST :: DEFAULT constructors
  ****************************************/
-template <typename T>
-list <T> ::list() 
+template <typename T, typename A>
+list <T, A> ::list() : numElements(0), pHead(nullptr), pTail(nullptr), alloc()
+{
+}
+
+/*****************************************
+ * LIST :: ALLOCATOR constructor
+ * An empty list taking its nodes from a. Lists built from
+ * copies of one pool_allocator share its pool
+ ****************************************/
+template <typename T, typename A>
+list <T, A> ::list(const A& a) : numElements(0), pHead(nullptr), pTail(nullptr), alloc(a)
 {
-   numElements = 0;
-   pHead = pTail = nullptr;
 }
 
 /*****************************************
  * LIST :: COPY constructors
+ * The allocator decides whether the copy shares its pool
  ****************************************/
-template <typename T>
-list <T> ::list(list& rhs) 
+template <typename T, typename A>
+list <T, A> ::list(const list& rhs) : numElements(0), pHead(nullptr), pTail(nullptr),
+   alloc(NodeTraits::select_on_container_copy_construction(rhs.alloc))
 {
-   numElements = 99;
-   pHead = pTail = new list <T> ::Node();
+   try
+   {
+      for (Node * p = rhs.pHead; p; p = p->pNext)
+         linkBack(createNode(p->data));
+   }
+   catch (...)
+   {
+      clear();
+      throw;
+   }
 }
 
 /*****************************************
  * LIST :: MOVE constructors
  * Steal the values from the RHS
  ****************************************/
-template <typename T>
-list <T> ::list(list <T>&& rhs)
+template <typename T, typename A>
+list <T, A> ::list(list <T, A>&& rhs) : numElements(rhs.numElements), pHead(rhs.pHead),
+   pTail(rhs.pTail), alloc(rhs.alloc)
 {
-   numElements = 99;
-   pHead = pTail = new list <T> ::Node();
+   rhs.pHead = rhs.pTail = nullptr;
+   rhs.numElements = 0;
 }
 
 /**********************************************
@@ -375,13 +584,24 @@ list <T> ::list(list <T>&& rhs)
  *     OUTPUT :
  *     COST   : O(n) with respect to the size of the LHS 
  *********************************************/
-template <typename T>
-list <T>& list <T> :: operator = (list <T> && rhs)
+template <typename T, typename A>
+list <T, A>& list <T, A> :: operator = (list <T, A> && rhs)
 {
    if (this != &rhs)
    {
       clear();
 
+      // nodes from an allocator we cannot take must be moved one by one
+      if (!NodeTraits::propagate_on_container_move_assignment::value && !(alloc == rhs.alloc))
+      {
+         for (Node * p = rhs.pHead; p; p = p->pNext)
+            linkBack(createNode(std::move(p->data)));
+         rhs.clear();
+         return *this;
+      }
+
+      if (NodeTraits::propagate_on_container_move_assignment::value)
+         alloc = rhs.alloc;
       this->pHead = rhs.pHead;
       this->pTail = rhs.pTail;
       this->numElements = rhs.numElements;
@@ -389,9 +609,8 @@ list <T>& list <T> :: operator = (list <T> && rhs)
       rhs.pHead = nullptr;
       rhs.pTail = nullptr;
       rhs.numElements = 0;
-      return *this;
    }
-
+   return *this;
 }
 
 /**********************************************
@@ -401,27 +620,14 @@ list <T>& list <T> :: operator = (list <T> && rhs)
  *     OUTPUT :
  *     COST   : O(n) with respect to the number of nodes
  *********************************************/
-template <typename T>
-list <T> & list <T> :: operator = (list <T> & rhs)
+template <typename T, typename A>
+list <T, A> & list <T, A> :: operator = (list <T, A> & rhs)
 {
    if (this != &rhs)
    {
       clear();
-      if (rhs.pHead)
-      {
-         pHead = new Node(rhs.pHead->data);
-         Node* src = rhs.pHead->pNext;
-         Node* dst = pHead;
-         while (src != nullptr)
-         {
-            dst->pNext = new Node(src->data);
-            dst->pNext->pPrev = dst;
-            dst = dst->pNext;
-            src = src->pNext;
-         }
-         pTail = dst;
-         numElements = rhs.numElements;
-      }
+      for (Node * p = rhs.pHead; p; p = p->pNext)
+         linkBack(createNode(p->data));
    }
    return *this;
 }
@@ -433,26 +639,12 @@ list <T> & list <T> :: operator = (list <T> & rhs)
  *     OUTPUT :
  *     COST   : O(n) with respect to the number of nodes
  *********************************************/
-template <typename T>
-list <T>& list <T> :: operator = (const std::initializer_list<T>& rhs)
+template <typename T, typename A>
+list <T, A>& list <T, A> :: operator = (const std::initializer_list<T>& rhs)
 {
    clear();
-
-   if (rhs.size() > 0) 
-   {
-      auto it = rhs.begin();
-      pHead = new Node(*it);
-      Node* current = pHead;
-      ++it;
-      for (; it != rhs.end(); ++it) 
-      {
-         current->pNext = new Node(*it);
-         current->pNext->pPrev = current;
-         current = current->pNext;
-      }
-      pTail = current;
-      numElements = rhs.size();
-   }
+   for (const T & t : rhs)
+      linkBack(createNode(t));
    return *this;
 }
 
@@ -461,16 +653,21 @@ list <T>& list <T> :: operator = (const std::initializer_list<T>& rhs)
  * Remove all the items currently in the linked list
  *     INPUT  :
  *     OUTPUT :
- *     COST   : O(n) with respect to the number of nodes
+ *     COST   : O(n) with respect to the number of nodes,
+ *              O(slabs) for a pool of nodes with nothing to destroy
  *********************************************/
-template <typename T>
-void list <T> :: clear()
+template <typename T, typename A>
+void list <T, A> :: clear()
 {
+   // nodes with nothing to destroy can go back to a private pool all at once
+   if (pHead && std::is_trivially_destructible<Node>::value && releaseAll(alloc))
+      pHead = nullptr;
+
    while (pHead != nullptr)
    {
       Node* temp = pHead;
       pHead = pHead->pNext;
-      delete temp;
+      destroyNode(temp);
    }
    pTail = nullptr;
    numElements = 0;
@@ -483,40 +680,16 @@ void list <T> :: clear()
  *    OUTPUT :
  *    COST   : O(1)
  *********************************************/
-template <typename T>
-void list <T> :: push_back(const T & data)
+template <typename T, typename A>
+void list <T, A> :: push_back(const T & data)
 {
-   Node* newNode = new Node(data);
-
-   if (numElements == 0)
-   {
-      pHead = pTail = newNode;
-   }
-   else
-   {
-      pTail->pNext = newNode;
-      newNode->pPrev = pTail;
-      pTail = newNode;
-   }
-   numElements++;
+   linkBack(createNode(data));
 }
 
-template <typename T>
-void list <T> ::push_back(T && data)
+template <typename T, typename A>
+void list <T, A> ::push_back(T && data)
 {
-   Node* newNode = new Node(std::move(data));
-
-   if (numElements == 0)
-   {
-      pHead = pTail = newNode;
-   }
-   else
-   {
-      pTail->pNext = newNode;
-      newNode->pPrev = pTail;
-      pTail = newNode;
-   }
-   numElements++;
+   linkBack(createNode(std::move(data)));
 }
 
 /*********************************************
@@ -526,10 +699,10 @@ void list <T> ::push_back(T && data)
  *     OUTPUT :
  *     COST   : O(1)
  *********************************************/
-template <typename T>
-void list <T> :: push_front(const T & data)
+template <typename T, typename A>
+void list <T, A> :: push_front(const T & data)
 {
-   Node* newNode = new Node(data);
+   Node* newNode = createNode(data);
 
    if (numElements == 0)
    {
@@ -544,10 +717,10 @@ void list <T> :: push_front(const T & data)
    numElements++;
 }
 
-template <typename T>
-void list <T> ::push_front(T && data)
+template <typename T, typename A>
+void list <T, A> ::push_front(T && data)
 {
-   Node* newNode = new Node(std::move(data));
+   Node* newNode = createNode(std::move(data));
 
    if (numElements == 0)
    {
@@ -570,25 +743,20 @@ void list <T> ::push_front(T && data)
  *    OUTPUT :
  *    COST   : O(1)
  *********************************************/
-template <typename T>
-void list <T> ::pop_back()
+template <typename T, typename A>
+void list <T, A> ::pop_back()
 {
    if (pTail)
    {
-      if (numElements == 1)
-      {
-         clear();
-      }
+      Node* temp = pTail;
+      pTail = pTail->pPrev;
+      if (pTail)
+         pTail->pNext = nullptr;
       else
-      {
-         Node* newTail = pTail->pPrev;
-         newTail->pNext = nullptr;
-         Node* temp = pTail;
-         pTail = newTail;
-         delete temp;
+         pHead = nullptr;
+      destroyNode(temp);
 
-         numElements--;
-      }
+      numElements--;
    }
 }
 
@@ -599,25 +767,20 @@ void list <T> ::pop_back()
  *    OUTPUT :
  *    COST   : O(1)
  *********************************************/
-template <typename T>
-void list <T> ::pop_front()
+template <typename T, typename A>
+void list <T, A> ::pop_front()
 {
    if (pHead)
    {
-      if (numElements == 1)
-      {
-         clear();
-      }
+      Node* temp = pHead;
+      pHead = pHead->pNext;
+      if (pHead)
+         pHead->pPrev = nullptr;
       else
-      {
-         Node* newHead = pHead->pNext;
-         newHead->pPrev = nullptr;
-         Node* temp = pHead;
-         pHead = newHead;
-         delete temp;
+         pTail = nullptr;
+      destroyNode(temp);
 
-         numElements--;
-      }
+      numElements--;
    }
 }
 
@@ -628,10 +791,12 @@ void list <T> ::pop_front()
  *     OUTPUT : data to be displayed
  *     COST   : O(1)
  *********************************************/
-template <typename T>
-T & list <T> :: front()
+template <typename T, typename A>
+T & list <T, A> :: front()
 {
-   return *(new T);
+   if (pHead == nullptr)
+      throw "ERROR: unable to access data from an empty list";
+   return pHead->data;
 }
 
 /*********************************************
@@ -641,10 +806,12 @@ T & list <T> :: front()
  *     OUTPUT : data to be displayed
  *     COST   : O(1)
  *********************************************/
-template <typename T>
-T & list <T> :: back()
+template <typename T, typename A>
+T & list <T, A> :: back()
 {
-   return *(new T);
+   if (pTail == nullptr)
+      throw "ERROR: unable to access data from an empty list";
+   return pTail->data;
 }
 
 /******************************************
@@ -654,10 +821,26 @@ T & list <T> :: back()
  *     OUTPUT : iterator to the new location 
  *     COST   : O(1)
  ******************************************/
-template <typename T>
-typename list <T> :: iterator  list <T> :: erase(const list <T> :: iterator & it)
+template <typename T, typename A>
+typename list <T, A> :: iterator  list <T, A> :: erase(const list <T, A> :: iterator & it)
 {
-   return end();
+   Node * pErase = it.p;
+   if (pErase == nullptr)
+      return end();
+
+   Node * pNext = pErase->pNext;
+   if (pErase->pPrev)
+      pErase->pPrev->pNext = pNext;
+   else
+      pHead = pNext;
+   if (pNext)
+      pNext->pPrev = pErase->pPrev;
+   else
+      pTail = pErase->pPrev;
+
+   destroyNode(pErase);
+   numElements--;
+   return iterator(this, pNext);
 }
 
 /******************************************
@@ -668,11 +851,11 @@ typename list <T> :: iterator  list <T> :: erase(const list <T> :: iterator & it
  *     OUTPUT : iterator to the new item
  *     COST   : O(1)
  ******************************************/
-template <typename T>
-typename list <T> :: iterator list <T> :: insert(list <T> :: iterator it,
-                                                 const T & data) 
+template <typename T, typename A>
+typename list <T, A> :: iterator list <T, A> :: insert(list <T, A> :: iterator it,
+                                                       const T & data) 
 {
-   Node* newNode = new Node(data);
+   Node* newNode = createNode(data);
 
    // If "it" is pointing to nullptr, then we are inserting at the end
    if (it.p == nullptr)
@@ -703,14 +886,14 @@ typename list <T> :: iterator list <T> :: insert(list <T> :: iterator it,
       it.p->pPrev = newNode;
    }
    numElements++;
-   return iterator(newNode);
+   return iterator(this, newNode);
 }
 
-template <typename T>
-typename list <T> :: iterator list <T> :: insert(list <T> :: iterator it,
+template <typename T, typename A>
+typename list <T, A> :: iterator list <T, A> :: insert(list <T, A> :: iterator it,
    T && data)
 {
-   Node* newNode = new Node(std::move(data));
+   Node* newNode = createNode(std::move(data));
 
    // If "it" is pointing to nullptr, then we are inserting at the end
    if (it.p == nullptr)
@@ -741,25 +924,323 @@ typename list <T> :: iterator list <T> :: insert(list <T> :: iterator it,
       it.p->pPrev = newNode;
    }
    numElements++;
-   return iterator(newNode);
+   return iterator(this, newNode);
 }
 
 /**********************************************
- * LIST :: assignment operator - MOVE
- * Copy one list onto another
- *     INPUT  : a list to be moved
+ * LIST :: SPLICE
+ * Move every node of rhs in front of pos. The nodes are
+ * relinked, not copied, so rhs must share our allocator
+ *     INPUT  : where the nodes go, the list they come from
  *     OUTPUT :
- *     COST   : O(n) with respect to the size of the LHS
+ *     COST   : O(1)
  *********************************************/
-template <typename T>
-void swap(list <T> & lhs, list <T> & rhs)
+template <typename T, typename A>
+void list <T, A> ::splice(iterator pos, list <T, A> & rhs)
 {
+   assert(alloc == rhs.alloc);
+   if (this == &rhs || rhs.pHead == nullptr)
+      return;
+
+   Node * pFirst = rhs.pHead;
+   Node * pLast = rhs.pTail;
+   size_t num = rhs.numElements;
+   rhs.unlinkRange(pFirst, pLast);
+   rhs.numElements = 0;
+   linkRange(pos.p, pFirst, pLast);
+   numElements += num;
+}
 
+/**********************************************
+ * LIST :: SPLICE
+ * Move the one node at it from rhs in front of pos
+ *     INPUT  : where the node goes, the list it comes from,
+ *              and the node
+ *     OUTPUT :
+ *     COST   : O(1)
+ *********************************************/
+template <typename T, typename A>
+void list <T, A> ::splice(iterator pos, list <T, A> & rhs, iterator it)
+{
+   assert(alloc == rhs.alloc);
+   Node * pNode = it.p;
+   if (pNode == nullptr)
+      return;
+   if (this == &rhs && (pNode == pos.p || pNode->pNext == pos.p))
+      return;   // already in place
+
+   rhs.unlinkRange(pNode, pNode);
+   rhs.numElements--;
+   linkRange(pos.p, pNode, pNode);
+   numElements++;
 }
 
-template <typename T>
-void list<T>::swap(list <T>& rhs)
+/**********************************************
+ * LIST :: SPLICE
+ * Move the nodes [first, last) from rhs in front of pos.
+ * pos must not be inside the range
+ *     INPUT  : where the nodes go, the list they come from,
+ *              and the range of nodes
+ *     OUTPUT :
+ *     COST   : O(1) within one list, otherwise O(n) with respect
+ *              to the range to keep the sizes right
+ *********************************************/
+template <typename T, typename A>
+void list <T, A> ::splice(iterator pos, list <T, A> & rhs, iterator first, iterator last)
 {
+   assert(alloc == rhs.alloc);
+   if (first == last || first.p == nullptr)
+      return;
+
+   Node * pFirst = first.p;
+   Node * pLast = (last.p ? last.p->pPrev : rhs.pTail);
+   if (this == &rhs && pLast->pNext == pos.p)
+      return;   // already in place
+
+   // only a move between lists changes the sizes
+   size_t num = 0;
+   if (this != &rhs)
+      for (Node * p = pFirst; p != pLast->pNext; p = p->pNext)
+         num++;
+
+   rhs.unlinkRange(pFirst, pLast);
+   rhs.numElements -= num;
+   linkRange(pos.p, pFirst, pLast);
+   numElements += num;
+}
+
+/**********************************************
+ * LIST :: MERGE
+ * Move the nodes of rhs into this list. Both must already be
+ * sorted by comp. Equal elements keep their order, ours first
+ *     INPUT  : a sorted list sharing our allocator
+ *     OUTPUT :
+ *     COST   : O(n + m)
+ *********************************************/
+template <typename T, typename A>
+template <class Compare>
+void list <T, A> ::merge(list <T, A> & rhs, Compare comp)
+{
+   assert(alloc == rhs.alloc);
+   if (this == &rhs || rhs.pHead == nullptr)
+      return;
+
+   pHead = mergeChains(pHead, rhs.pHead, comp);
+   numElements += rhs.numElements;
+   restorePrev();
+
+   rhs.pHead = rhs.pTail = nullptr;
+   rhs.numElements = 0;
+}
+
+/**********************************************
+ * LIST :: SORT
+ * A stable bottom-up merge sort. runs[i] holds a sorted run of
+ * 2^i nodes chained through pNext alone. Each node merges up
+ * through the runs like a carry through a binary counter, so the
+ * sort needs neither recursion nor extra memory
+ *     INPUT  : how to order the elements
+ *     OUTPUT :
+ *     COST   : O(n log n)
+ *********************************************/
+template <typename T, typename A>
+template <class Compare>
+void list <T, A> ::sort(Compare comp)
+{
+   if (numElements < 2)
+      return;
+
+   Node * runs[64] = {};   // enough for 2^64 nodes
+   size_t numRuns = 0;
+   Node * pNext = pHead;
+   while (pNext)
+   {
+      // take the next node off as a run of one
+      Node * pCarry = pNext;
+      pNext = pNext->pNext;
+      pCarry->pNext = nullptr;
+
+      // earlier runs hold earlier nodes, so they go on the left
+      size_t i = 0;
+      for (; i < numRuns && runs[i]; i++)
+      {
+         pCarry = mergeChains(runs[i], pCarry, comp);
+         runs[i] = nullptr;
+      }
+      runs[i] = pCarry;
+      if (i == numRuns)
+         numRuns++;
+   }
+
+   // fold the leftover runs together, oldest on the left
+   Node * pSorted = nullptr;
+   for (size_t i = 0; i < numRuns; i++)
+      if (runs[i])
+         pSorted = mergeChains(runs[i], pSorted, comp);
+
+   pHead = pSorted;
+   restorePrev();
+}
+
+/**********************************************
+ * LIST :: SWAP
+ * Swap the nodes, and the allocators with them
+ *     INPUT  : the list to swap with
+ *     OUTPUT :
+ *     COST   : O(1)
+ *********************************************/
+template <typename T, typename A>
+void swap(list <T, A> & lhs, list <T, A> & rhs)
+{
+   lhs.swap(rhs);
+}
+
+template <typename T, typename A>
+void list<T, A>::swap(list <T, A>& rhs)
+{
+   std::swap(pHead, rhs.pHead);
+   std::swap(pTail, rhs.pTail);
+   std::swap(numElements, rhs.numElements);
+   std::swap(alloc, rhs.alloc);
+}
+
+/**************************************************
+ * LIST :: CREATE NODE
+ * Allocate a node and build it from args
+ *************************************************/
+template <typename T, typename A>
+template <class ... Args>
+typename list <T, A> ::Node * list <T, A> ::createNode(Args&& ... args)
+{
+   Node * pNode = NodeTraits::allocate(alloc, 1);
+   try
+   {
+      ::new (static_cast<void*>(pNode)) Node(std::forward<Args>(args)...);
+   }
+   catch (...)
+   {
+      NodeTraits::deallocate(alloc, pNode, 1);
+      throw;
+   }
+   return pNode;
+}
+
+/**************************************************
+ * LIST :: DESTROY NODE
+ * Destroy a node and give its memory back
+ *************************************************/
+template <typename T, typename A>
+void list <T, A> ::destroyNode(Node * pNode) noexcept
+{
+   pNode->~Node();
+   NodeTraits::deallocate(alloc, pNode, 1);
+}
+
+/**************************************************
+ * LIST :: LINK BACK
+ * Hang a new node off the tail
+ *************************************************/
+template <typename T, typename A>
+void list <T, A> ::linkBack(Node * pNode)
+{
+   if (pTail == nullptr)
+   {
+      pHead = pTail = pNode;
+   }
+   else
+   {
+      pTail->pNext = pNode;
+      pNode->pPrev = pTail;
+      pTail = pNode;
+   }
+   numElements++;
+}
+
+/**************************************************
+ * LIST :: UNLINK RANGE
+ * Take the nodes [pFirst, pLast] out of the list. The caller
+ * fixes numElements
+ *************************************************/
+template <typename T, typename A>
+void list <T, A> ::unlinkRange(Node * pFirst, Node * pLast) noexcept
+{
+   if (pFirst->pPrev)
+      pFirst->pPrev->pNext = pLast->pNext;
+   else
+      pHead = pLast->pNext;
+   if (pLast->pNext)
+      pLast->pNext->pPrev = pFirst->pPrev;
+   else
+      pTail = pFirst->pPrev;
+   pFirst->pPrev = nullptr;
+   pLast->pNext = nullptr;
+}
+
+/**************************************************
+ * LIST :: LINK RANGE
+ * Hang the chain [pFirst, pLast] in front of pPos, or off the
+ * tail when pPos is nullptr. The caller fixes numElements
+ *************************************************/
+template <typename T, typename A>
+void list <T, A> ::linkRange(Node * pPos, Node * pFirst, Node * pLast) noexcept
+{
+   Node * pPrev = (pPos ? pPos->pPrev : pTail);
+   pFirst->pPrev = pPrev;
+   pLast->pNext = pPos;
+   if (pPrev)
+      pPrev->pNext = pFirst;
+   else
+      pHead = pFirst;
+   if (pPos)
+      pPos->pPrev = pLast;
+   else
+      pTail = pLast;
+}
+
+/**************************************************
+ * LIST :: RESTORE PREV
+ * After merging through pNext alone, walk from the head to
+ * put back every pPrev and find the tail
+ *************************************************/
+template <typename T, typename A>
+void list <T, A> ::restorePrev() noexcept
+{
+   Node * pPrev = nullptr;
+   for (Node * p = pHead; p; p = p->pNext)
+   {
+      p->pPrev = pPrev;
+      pPrev = p;
+   }
+   pTail = pPrev;
+}
+
+/**************************************************
+ * LIST :: MERGE CHAINS
+ * Merge two sorted chains linked through pNext. On a tie the
+ * left node goes first, which keeps the merge stable
+ *************************************************/
+template <typename T, typename A>
+template <class Compare>
+typename list <T, A> ::Node * list <T, A> ::mergeChains(Node * pLeft, Node * pRight, Compare & comp)
+{
+   Node * pResult = nullptr;
+   Node ** ppTail = &pResult;
+   while (pLeft && pRight)
+   {
+      if (comp(pRight->data, pLeft->data))
+      {
+         *ppTail = pRight;
+         pRight = pRight->pNext;
+      }
+      else
+      {
+         *ppTail = pLeft;
+         pLeft = pLeft->pNext;
+      }
+      ppTail = &(*ppTail)->pNext;
+   }
+   *ppTail = (pLeft ? pLeft : pRight);
+   return pResult;
 }
 
 //#endif
@@ -0,0 +1,431 @@
+/***********************************************************************
+ * Header:
+ *    TEST INTRUSIVE LIST
+ * Summary:
+ *    Unit tests for intrusive_list
+ * Author
+ *    Steven Sellers
+ ************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG
+
+#include "intrusive_list.h"   // class under test
+#include "unitTest.h"         // unit test baseclass
+
+#include <vector>
+
+/***********************************************
+ * TEST INTRUSIVE LIST
+ * Unit tests for intrusive_list. A Connection sits in up to
+ * three lists at once, one hook for each
+ ***********************************************/
+class TestIntrusiveList : public UnitTest
+{
+   struct Idle {};
+   struct Active {};
+   struct Timeout {};
+   struct Connection : public custom::list_hook<Idle>,
+                       public custom::list_hook<Active>,
+                       public custom::list_hook<Timeout>
+   {
+      Connection(int id) : id(id) {}
+      int id;
+   };
+   using IdleList    = custom::intrusive_list<Connection, Idle>;
+   using ActiveList  = custom::intrusive_list<Connection, Active>;
+   using TimeoutList = custom::intrusive_list<Connection, Timeout>;
+
+public:
+   void run()
+   {
+      reset();
+
+      // Construct
+      test_construct_default();
+      test_construct_move();
+      test_assign_move();
+      test_swap();
+      test_hook_copy();
+
+      // Iterator
+      test_iterator_forward();
+      test_iterator_backward();
+      test_iterator_decrementEnd();
+      test_iterator_to();
+
+      // Insert
+      test_pushback_inPlace();
+      test_pushfront_standard();
+      test_insert_middle();
+      test_insert_severalLists();
+
+      // Remove
+      test_popback_standard();
+      test_popfront_standard();
+      test_erase_middle();
+      test_erase_last();
+      test_remove_otherListsStay();
+      test_remove_moveBetweenLists();
+      test_clear_unlinks();
+
+      report("IntrusiveList");
+   }
+
+   /***************************************
+    * CONSTRUCT
+    ***************************************/
+
+   // a new list is empty
+   void test_construct_default()
+   {  // setup
+      // exercise
+      IdleList l;
+      // verify
+      assertUnit(l.empty());
+      assertUnit(l.pHead == nullptr);
+      assertUnit(l.pTail == nullptr);
+   }  // teardown
+
+   // a move takes the elements
+   void test_construct_move()
+   {  // setup
+      Connection c1(1), c2(2);
+      IdleList lSrc;
+      lSrc.push_back(c1);
+      lSrc.push_back(c2);
+      // exercise
+      IdleList lDes(std::move(lSrc));
+      // verify
+      assertUnit(lSrc.empty());
+      assertUnit(sameIds(lDes, { 1, 2 }));
+   }  // teardown
+
+   // move assignment lets go of the old elements
+   void test_assign_move()
+   {  // setup
+      Connection c1(1), c2(2), c3(3);
+      IdleList lSrc;
+      IdleList lDes;
+      lSrc.push_back(c1);
+      lDes.push_back(c2);
+      lDes.push_back(c3);
+      // exercise
+      lDes = std::move(lSrc);
+      // verify
+      assertUnit(lSrc.empty());
+      assertUnit(sameIds(lDes, { 1 }));
+      assertUnit(!isLinked<Idle>(c2));
+      assertUnit(!isLinked<Idle>(c3));
+   }  // teardown
+
+   // swap trades the elements
+   void test_swap()
+   {  // setup
+      Connection c1(1), c2(2);
+      IdleList l1;
+      IdleList l2;
+      l1.push_back(c1);
+      l1.push_back(c2);
+      // exercise
+      swap(l1, l2);
+      // verify
+      assertUnit(l1.empty());
+      assertUnit(sameIds(l2, { 1, 2 }));
+   }  // teardown
+
+   // a copy of an element is in no list
+   void test_hook_copy()
+   {  // setup
+      Connection c1(1);
+      IdleList l;
+      l.push_back(c1);
+      // exercise
+      Connection c2(c1);
+      // verify
+      assertUnit(isLinked<Idle>(c1));
+      assertUnit(!isLinked<Idle>(c2));
+      assertUnit(sameIds(l, { 1 }));
+      // teardown
+      l.clear();
+   }
+
+   /***************************************
+    * ITERATOR
+    ***************************************/
+
+   // walk from the front
+   void test_iterator_forward()
+   {  // setup
+      Connection c1(1), c2(2), c3(3);
+      IdleList l;
+      l.push_back(c1);
+      l.push_back(c2);
+      l.push_back(c3);
+      std::vector<int> ids;
+      // exercise
+      for (IdleList::iterator it = l.begin(); it != l.end(); it++)
+         ids.push_back(it->id);
+      // verify
+      assertUnit(ids == std::vector<int>({ 1, 2, 3 }));
+   }  // teardown
+
+   // walk from the back, falling off the front onto end()
+   void test_iterator_backward()
+   {  // setup
+      Connection c1(1), c2(2), c3(3);
+      IdleList l;
+      l.push_back(c1);
+      l.push_back(c2);
+      l.push_back(c3);
+      std::vector<int> ids;
+      // exercise
+      for (IdleList::iterator it = l.iterator_to(l.back()); it != l.end(); --it)
+         ids.push_back((*it).id);
+      // verify
+      assertUnit(ids == std::vector<int>({ 3, 2, 1 }));
+   }  // teardown
+
+   // step back from end() onto the last element
+   void test_iterator_decrementEnd()
+   {  // setup
+      Connection c1(1), c2(2), c3(3);
+      IdleList l;
+      l.push_back(c1);
+      l.push_back(c2);
+      l.push_back(c3);
+      IdleList::iterator it = l.end();
+      // exercise
+      --it;
+      // verify
+      assertUnit(it != l.end());
+      assertUnit(&*it == &c3);
+      assertUnit(&*--it == &c2);
+   }  // teardown
+
+   // find an element's place from the element itself
+   void test_iterator_to()
+   {  // setup
+      Connection c1(1), c2(2), c3(3);
+      IdleList l;
+      l.push_back(c1);
+      l.push_back(c2);
+      l.push_back(c3);
+      // exercise
+      IdleList::iterator it = l.iterator_to(c2);
+      // verify
+      assertUnit(&*it == &c2);
+      assertUnit(&*++it == &c3);
+   }  // teardown
+
+   /***************************************
+    * INSERT
+    ***************************************/
+
+   // the list holds the element itself, not a copy
+   void test_pushback_inPlace()
+   {  // setup
+      Connection c1(1);
+      IdleList l;
+      // exercise
+      l.push_back(c1);
+      // verify
+      assertUnit(&l.front() == &c1);
+      assertUnit(&l.back() == &c1);
+      assertUnit(isLinked<Idle>(c1));
+      assertUnit(!isLinked<Active>(c1));
+      assertUnit(sameIds(l, { 1 }));
+   }  // teardown
+
+   // push onto the front
+   void test_pushfront_standard()
+   {  // setup
+      Connection c1(1), c2(2);
+      IdleList l;
+      l.push_back(c1);
+      // exercise
+      l.push_front(c2);
+      // verify
+      assertUnit(sameIds(l, { 2, 1 }));
+   }  // teardown
+
+   // insert in front of the middle element
+   void test_insert_middle()
+   {  // setup
+      Connection c1(1), c2(2), c3(3), c4(4);
+      IdleList l;
+      l.push_back(c1);
+      l.push_back(c2);
+      l.push_back(c3);
+      // exercise
+      IdleList::iterator it = l.insert(l.iterator_to(c2), c4);
+      // verify
+      assertUnit(sameIds(l, { 1, 4, 2, 3 }));
+      assertUnit(&*it == &c4);
+   }  // teardown
+
+   // one element, three lists, three different orders
+   void test_insert_severalLists()
+   {  // setup
+      Connection c1(1), c2(2), c3(3);
+      IdleList idle;
+      ActiveList active;
+      TimeoutList timeout;
+      // exercise
+      idle.push_back(c1);
+      idle.push_back(c2);
+      idle.push_back(c3);
+      active.push_back(c3);
+      active.push_back(c1);
+      timeout.push_front(c2);
+      timeout.push_front(c3);
+      // verify
+      assertUnit(sameIds(idle, { 1, 2, 3 }));
+      assertUnit(sameIds(active, { 3, 1 }));
+      assertUnit(sameIds(timeout, { 3, 2 }));
+   }  // teardown
+
+   /***************************************
+    * REMOVE
+    ***************************************/
+
+   // pop the back, and the element is free to go elsewhere
+   void test_popback_standard()
+   {  // setup
+      Connection c1(1), c2(2);
+      IdleList l;
+      l.push_back(c1);
+      l.push_back(c2);
+      // exercise
+      l.pop_back();
+      // verify
+      assertUnit(sameIds(l, { 1 }));
+      assertUnit(!isLinked<Idle>(c2));
+   }  // teardown
+
+   // pop the front
+   void test_popfront_standard()
+   {  // setup
+      Connection c1(1), c2(2);
+      IdleList l;
+      l.push_back(c1);
+      l.push_back(c2);
+      // exercise
+      l.pop_front();
+      // verify
+      assertUnit(sameIds(l, { 2 }));
+      assertUnit(!isLinked<Idle>(c1));
+   }  // teardown
+
+   // erase from the middle returns the next element
+   void test_erase_middle()
+   {  // setup
+      Connection c1(1), c2(2), c3(3);
+      IdleList l;
+      l.push_back(c1);
+      l.push_back(c2);
+      l.push_back(c3);
+      // exercise
+      IdleList::iterator it = l.erase(l.iterator_to(c2));
+      // verify
+      assertUnit(sameIds(l, { 1, 3 }));
+      assertUnit(&*it == &c3);
+      assertUnit(!isLinked<Idle>(c2));
+   }  // teardown
+
+   // erasing the last element returns end()
+   void test_erase_last()
+   {  // setup
+      Connection c1(1), c2(2);
+      IdleList l;
+      l.push_back(c1);
+      l.push_back(c2);
+      // exercise
+      IdleList::iterator it = l.erase(l.iterator_to(c2));
+      // verify
+      assertUnit(sameIds(l, { 1 }));
+      assertUnit(it == l.end());
+   }  // teardown
+
+   // leaving one list does not disturb the others
+   void test_remove_otherListsStay()
+   {  // setup
+      Connection c1(1), c2(2);
+      IdleList idle;
+      ActiveList active;
+      idle.push_back(c1);
+      idle.push_back(c2);
+      active.push_back(c2);
+      active.push_back(c1);
+      // exercise
+      idle.remove(c2);
+      // verify
+      assertUnit(sameIds(idle, { 1 }));
+      assertUnit(sameIds(active, { 2, 1 }));
+      assertUnit(!isLinked<Idle>(c2));
+      assertUnit(isLinked<Active>(c2));
+   }  // teardown
+
+   // move a connection from idle to active
+   void test_remove_moveBetweenLists()
+   {  // setup
+      Connection c1(1), c2(2), c3(3);
+      IdleList idle;
+      IdleList active;
+      idle.push_back(c1);
+      idle.push_back(c2);
+      active.push_back(c3);
+      // exercise
+      idle.remove(c1);
+      active.push_back(c1);
+      // verify
+      assertUnit(sameIds(idle, { 2 }));
+      assertUnit(sameIds(active, { 3, 1 }));
+   }  // teardown
+
+   // clear lets go of every element
+   void test_clear_unlinks()
+   {  // setup
+      Connection c1(1), c2(2);
+      IdleList l;
+      l.push_back(c1);
+      l.push_back(c2);
+      // exercise
+      l.clear();
+      // verify
+      assertUnit(l.empty());
+      assertUnit(l.pHead == nullptr);
+      assertUnit(l.pTail == nullptr);
+      assertUnit(!isLinked<Idle>(c1));
+      assertUnit(!isLinked<Idle>(c2));
+   }  // teardown
+
+   /****************************************************************
+    * IS LINKED
+    * Is the element in a list through its Tag hook?
+    ****************************************************************/
+   template <class Tag>
+   bool isLinked(const Connection& c)
+   {
+      return static_cast<const custom::list_hook<Tag>&>(c).is_linked();
+   }
+
+   /****************************************************************
+    * SAME IDS
+    * Does the list hold connections with exactly these ids, with
+    * every pPrev, pTail and numElements agreeing with pNext?
+    ****************************************************************/
+   template <class Tag>
+   bool sameIds(const custom::intrusive_list<Connection, Tag>& l, const std::vector<int>& ids)
+   {
+      custom::list_hook<Tag>* pPrev = nullptr;
+      custom::list_hook<Tag>* p = l.pHead;
+      for (size_t i = 0; i < ids.size(); i++, pPrev = p, p = p->pNext)
+         if (p == nullptr || p->pPrev != pPrev || static_cast<Connection*>(p)->id != ids[i])
+            return false;
+      return p == nullptr && l.pTail == pPrev && l.numElements == ids.size();
+   }
+};
+
+#endif // DEBUG
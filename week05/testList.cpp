@@ -13,6 +13,9 @@
  //#undef DEBUG  // Remove this comment to disable unit tests
 
 #include "testList.h"       // for the spy unit tests
+#include "testPool.h"       // for the pool unit tests
+#include "testUnrolledList.h" // for the unrolled list unit tests
+#include "testIntrusiveList.h" // for the intrusive list unit tests
 
 
 /**********************************************************************
@@ -24,6 +27,9 @@ int main()
 #ifdef DEBUG
    // unit tests
    TestList().run();
+   TestPool().run();
+   TestUnrolledList().run();
+   TestIntrusiveList().run();
 #endif // DEBUG
    
    return 0;
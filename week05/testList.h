@@ -16,6 +16,7 @@
 #include "unitTest.h"
 
 #include <vector>
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <iostream>
@@ -71,9 +72,17 @@ public:
       test_iterator_incrementPost_standardMiddle();
       test_iterator_decrement_standardMiddle();
       test_iterator_decrement_standardBegin();
+      test_iterator_decrement_standardEnd();
+      test_iterator_decrement_emptyEnd();
       test_iterator_decrementPost_standardMiddle();
       test_iterator_dereference_read();
       test_iterator_dereference_update();
+      test_iterator_traverse_standard();
+      test_constIterator_traverse_standard();
+      test_constIterator_traverseBackward_standard();
+      test_reverseIterator_traverse_standard();
+      test_reverseIterator_base_standard();
+      test_iterator_algorithm_standard();
 
       // Access
       test_front_empty();
@@ -120,6 +129,29 @@ public:
       test_empty_empty();
       test_empty_three();
 
+      // Allocator
+      test_pool_pushErase();
+      test_pool_clear();
+      test_pool_popLast();
+      test_pool_clearShared();
+      test_pool_copy();
+      test_pool_move();
+
+      // Relink
+      test_splice_listMiddle();
+      test_splice_listEnd();
+      test_splice_nodeEnd();
+      test_splice_nodeSelf();
+      test_splice_range();
+      test_splice_rangeSelf();
+      test_merge_standard();
+      test_merge_empty();
+      test_merge_stable();
+      test_sort_empty();
+      test_sort_standard();
+      test_sort_descending();
+      test_sort_stable();
+
       report("List");
    }
 
@@ -2286,6 +2318,49 @@ public:
    }
 
 
+   // decrement end() onto the tail of the standard fixture
+   void test_iterator_decrement_standardEnd()
+   {  // setup
+      //        pHead             pTail
+      //       +----+   +----+   +----+
+      //       | 11 | - | 26 | - | 31 |
+      //       +----+   +----+   +----+
+      //                                  it
+      custom::list<int> l;
+      setupStandardFixture(l);
+      custom::list<int>::iterator it = l.end();
+      // exercise
+      custom::list<int>::iterator itReturn = --it;
+      custom::list<int>::iterator itPost = l.end();
+      custom::list<int>::iterator itPre = itPost--;
+      // verify
+      //        pHead             pTail
+      //       +----+   +----+   +----+
+      //       | 11 | - | 26 | - | 31 |
+      //       +----+   +----+   +----+
+      //                         it
+      assertUnit(it.p == l.pTail);
+      assertUnit(itReturn.p == l.pTail);
+      assertUnit(itPost.p == l.pTail);
+      assertUnit(itPre == l.end());
+      assertStandardFixture(l);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   // decrement end() of an empty list, and it stays at end()
+   void test_iterator_decrement_emptyEnd()
+   {  // setup
+      custom::list<int> l;
+      custom::list<int>::iterator it = l.end();
+      // exercise
+      --it;
+      // verify
+      assertUnit(it.p == nullptr);
+      assertUnit(it == l.end());
+      assertEmptyFixture(l);
+   }  // teardown
+
    // the the iterator's dereference operator to access an item from the list
    void test_iterator_dereference_read()
    {  // setup
@@ -2348,6 +2423,465 @@ public:
       teardownStandardFixture(l);
    }
 
+   // walk the standard list with no allocation and no leaks
+   void test_iterator_traverse_standard()
+   {  // setup
+      //        pHead             pTail
+      //       +----+   +----+   +----+
+      //       | 11 | - | 26 | - | 31 |
+      //       +----+   +----+   +----+
+      custom::list<int> l;
+      setupStandardFixture(l);
+      std::vector<int> values;
+      // exercise
+      for (custom::list<int>::iterator it = l.begin(); it != l.end(); ++it)
+         values.push_back(*it);
+      // verify
+      assertUnit(values == std::vector<int>({ 11, 26, 31 }));
+      assertStandardFixture(l);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   // a const list hands out const iterators
+   void test_constIterator_traverse_standard()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      const custom::list<int>& lConst = l;
+      std::vector<int> values;
+      // exercise
+      for (custom::list<int>::const_iterator it = lConst.begin(); it != lConst.end(); it++)
+         values.push_back(*it);
+      // verify
+      assertUnit(values == std::vector<int>({ 11, 26, 31 }));
+      assertUnit(lConst.front() == 11);
+      assertUnit(lConst.back() == 31);
+      assertUnit(lConst.cbegin() == custom::list<int>::const_iterator(l.begin()));
+      assertStandardFixture(l);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   // a const iterator walks back from cend() to the front
+   void test_constIterator_traverseBackward_standard()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      const custom::list<int>& lConst = l;
+      std::vector<int> values;
+      // exercise
+      for (custom::list<int>::const_iterator it = lConst.cend(); it != lConst.cbegin(); )
+         values.push_back(*--it);
+      // verify
+      assertUnit(values == std::vector<int>({ 31, 26, 11 }));
+      assertStandardFixture(l);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   // a reverse iterator starts at pTail and ends past pHead
+   void test_reverseIterator_traverse_standard()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      std::vector<int> values;
+      // exercise
+      for (custom::list<int>::reverse_iterator it = l.rbegin(); it != l.rend(); ++it)
+         values.push_back(*it);
+      // verify
+      assertUnit(values == std::vector<int>({ 31, 26, 11 }));
+      assertUnit(l.rbegin().p == l.pTail);
+      assertUnit(l.rend().p == nullptr);
+      assertUnit(l.rbegin().base() == l.end());
+      assertStandardFixture(l);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   // base() is one further along walking forward, as std::reverse_iterator
+   void test_reverseIterator_base_standard()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      custom::list<int>::reverse_iterator it = l.rbegin();
+      ++it;
+      // exercise
+      custom::list<int>::iterator itBase = it.base();
+      // verify
+      assertUnit(*it == 26);
+      assertUnit(itBase.p == l.pTail);
+      assertUnit(l.rbegin().base() == l.end());
+      assertUnit(l.rend().base() == l.begin());
+      assertUnit(*std::reverse_iterator<custom::list<int>::iterator>(itBase) == 26);
+      assertStandardFixture(l);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   // the iterators work with the standard algorithms
+   void test_iterator_algorithm_standard()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      // exercise
+      custom::list<int>::iterator it = std::find(l.begin(), l.end(), 26);
+      // verify
+      assertUnit(it.p == l.pHead->pNext);
+      assertUnit(std::distance(l.begin(), l.end()) == 3);
+      assertStandardFixture(l);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   /***************************************
+    * ALLOCATOR
+    *    list <T, pool_allocator<T>>
+    ***************************************/
+
+   // erased nodes go back to the pool and come out again
+   void test_pool_pushErase()
+   {  // setup
+      custom::list <int, custom::pool_allocator<int>> l;
+      for (int i = 0; i < 100; i++)
+         l.push_back(i);
+      custom::list <int, custom::pool_allocator<int>>::Node* pFirst = l.pHead;
+      // exercise
+      l.pop_front();
+      // verify
+      assertUnit(l.size() == 99);
+      assertUnit(l.alloc.pPool->pFree != nullptr);   // the node waits for reuse
+      l.push_front(-1);
+      assertUnit(l.pHead == pFirst);
+      assertUnit(l.pHead->data == -1);
+      assertUnit(l.alloc.pPool->pFree == nullptr);
+      assertUnit(l.size() == 100);
+   }  // teardown
+
+   // clearing a pooled list of ints drops the slabs in one step
+   void test_pool_clear()
+   {  // setup
+      custom::list <int, custom::pool_allocator<int>> l;
+      for (int i = 0; i < 1000; i++)
+         l.push_back(i);
+      // exercise
+      l.clear();
+      // verify
+      assertUnit(l.pHead == nullptr);
+      assertUnit(l.pTail == nullptr);
+      assertUnit(l.numElements == 0);
+      assertUnit(l.alloc.pPool->pSlabs == nullptr);
+      l.push_back(50);
+      assertUnit(l.size() == 1);
+   }  // teardown
+
+   // popping the last node hands it back without dropping the slab
+   void test_pool_popLast()
+   {  // setup
+      custom::list <int, custom::pool_allocator<int>> l;
+      l.push_back(1);
+      custom::list <int, custom::pool_allocator<int>>::Node* pFirst = l.pHead;
+      // exercise
+      l.pop_front();
+      l.push_back(2);
+      l.pop_back();
+      l.push_back(3);
+      // verify
+      assertUnit(l.size() == 1);
+      assertUnit(l.pHead == pFirst);
+      assertUnit(l.pTail == pFirst);
+      assertUnit(l.pHead->data == 3);
+      assertUnit(l.alloc.pPool->pSlabs != nullptr);
+      assertUnit(l.alloc.pPool->pSlabs->pNext == nullptr);
+   }  // teardown
+
+   // a list sharing its pool frees its nodes one at a time
+   void test_pool_clearShared()
+   {  // setup
+      custom::pool_allocator<int> a;
+      custom::list <int, custom::pool_allocator<int>> l1(a);
+      custom::list <int, custom::pool_allocator<int>> l2(a);
+      for (int i = 0; i < 10; i++)
+      {
+         l1.push_back(i);
+         l2.push_back(i);
+      }
+      // exercise
+      l1.clear();
+      // verify
+      assertUnit(l1.get_allocator() == l2.get_allocator());
+      assertUnit(l1.empty());
+      assertUnit(l1.alloc.pPool->pSlabs != nullptr);
+      assertUnit(l1.alloc.pPool->pFree != nullptr);
+      assertUnit(l2.size() == 10);
+      assertUnit(l2.pHead->data == 0);
+      assertUnit(l2.pTail->data == 9);
+   }  // teardown
+
+   // a copy of a pooled list gets a pool of its own
+   void test_pool_copy()
+   {  // setup
+      custom::list <int, custom::pool_allocator<int>> l;
+      for (int i = 0; i < 100; i++)
+         l.push_back(i);
+      // exercise
+      custom::list <int, custom::pool_allocator<int>> lCopy(l);
+      // verify
+      assertUnit(lCopy.alloc != l.alloc);
+      assertUnit(lCopy.size() == 100);
+      l.clear();
+      assertUnit(lCopy.size() == 100);
+      assertUnit(lCopy.pHead->data == 0);
+      assertUnit(lCopy.pTail->data == 99);
+   }  // teardown
+
+   // moving a pooled list takes the pool with the nodes
+   void test_pool_move()
+   {  // setup
+      custom::list <int, custom::pool_allocator<int>> lSrc;
+      custom::list <int, custom::pool_allocator<int>> lDes;
+      for (int i = 0; i < 10; i++)
+         lSrc.push_back(i);
+      lDes.push_back(99);
+      custom::list <int, custom::pool_allocator<int>>::Node* pHead = lSrc.pHead;
+      // exercise
+      lDes = std::move(lSrc);
+      // verify
+      assertUnit(lSrc.empty());
+      assertUnit(lDes.size() == 10);
+      assertUnit(lDes.pHead == pHead);
+      assertUnit(lDes.get_allocator() == lSrc.get_allocator());
+   }  // teardown
+
+   /***************************************
+    * SPLICE
+    ***************************************/
+
+   // splice a whole list into the middle of another
+   void test_splice_listMiddle()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      custom::list<int> lSrc{ 1, 2 };
+      custom::list<int>::Node* pOne = lSrc.pHead;
+      custom::list<int>::iterator it(l.pHead->pNext);
+      // exercise
+      l.splice(it, lSrc);
+      // verify
+      assertUnit(sameValues(l, { 11, 1, 2, 26, 31 }));
+      assertUnit(l.pHead->pNext == pOne);   // relinked, not copied
+      assertEmptyFixture(lSrc);
+      // teardown
+      l.clear();
+   }
+
+   // splice a whole list onto the end of an empty one
+   void test_splice_listEnd()
+   {  // setup
+      custom::list<int> l;
+      custom::list<int> lSrc;
+      setupStandardFixture(lSrc);
+      custom::list<int>::iterator itEnd(nullptr);
+      // exercise
+      l.splice(itEnd, lSrc);
+      // verify
+      assertStandardFixture(l);
+      assertEmptyFixture(lSrc);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   // splice the tail of one list onto the end of another
+   void test_splice_nodeEnd()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      custom::list<int> lSrc{ 1, 2 };
+      custom::list<int>::iterator itEnd(nullptr);
+      custom::list<int>::iterator it(lSrc.pTail);
+      // exercise
+      l.splice(itEnd, lSrc, it);
+      // verify
+      assertUnit(sameValues(l, { 11, 26, 31, 2 }));
+      assertUnit(sameValues(lSrc, { 1 }));
+      // teardown
+      l.clear();
+   }
+
+   // move one node to the front of its own list
+   void test_splice_nodeSelf()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      custom::list<int>::iterator itPos(l.pHead);
+      custom::list<int>::iterator it(l.pTail);
+      // exercise
+      l.splice(itPos, l, it);
+      // verify
+      assertUnit(sameValues(l, { 31, 11, 26 }));
+      // teardown
+      l.clear();
+   }
+
+   // splice the middle of one list into another
+   void test_splice_range()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      custom::list<int> lSrc{ 1, 2, 3, 4 };
+      custom::list<int>::iterator itPos(l.pTail);
+      custom::list<int>::iterator itFirst(lSrc.pHead->pNext);
+      custom::list<int>::iterator itLast(lSrc.pTail);
+      // exercise
+      l.splice(itPos, lSrc, itFirst, itLast);
+      // verify
+      assertUnit(sameValues(l, { 11, 26, 2, 3, 31 }));
+      assertUnit(sameValues(lSrc, { 1, 4 }));
+      // teardown
+      l.clear();
+   }
+
+   // rotate a list by splicing its front range onto its end
+   void test_splice_rangeSelf()
+   {  // setup
+      custom::list<int> l{ 1, 2, 3, 4, 5 };
+      custom::list<int>::iterator itEnd(nullptr);
+      custom::list<int>::iterator itFirst(l.pHead);
+      custom::list<int>::iterator itLast(l.pHead->pNext->pNext);
+      // exercise
+      l.splice(itEnd, l, itFirst, itLast);
+      // verify
+      assertUnit(sameValues(l, { 3, 4, 5, 1, 2 }));
+   }  // teardown
+
+   /***************************************
+    * MERGE
+    ***************************************/
+
+   // merge two sorted lists into one
+   void test_merge_standard()
+   {  // setup
+      custom::list<int> l;
+      setupStandardFixture(l);
+      custom::list<int> lSrc{ 5, 26, 40 };
+      // exercise
+      l.merge(lSrc);
+      // verify
+      assertUnit(sameValues(l, { 5, 11, 26, 26, 31, 40 }));
+      assertEmptyFixture(lSrc);
+      // teardown
+      l.clear();
+   }
+
+   // merging into an empty list takes every node
+   void test_merge_empty()
+   {  // setup
+      custom::list<int> l;
+      custom::list<int> lSrc;
+      setupStandardFixture(lSrc);
+      // exercise
+      l.merge(lSrc);
+      // verify
+      assertStandardFixture(l);
+      assertEmptyFixture(lSrc);
+      // teardown
+      teardownStandardFixture(l);
+   }
+
+   // on a tie the node already in the list comes first
+   void test_merge_stable()
+   {  // setup
+      custom::list<int> l{ 1, 2, 3 };
+      custom::list<int> lSrc{ 2, 3 };
+      custom::list<int>::Node* pTwo = l.pHead->pNext;
+      custom::list<int>::Node* pThree = lSrc.pTail;
+      // exercise
+      l.merge(lSrc);
+      // verify
+      assertUnit(sameValues(l, { 1, 2, 2, 3, 3 }));
+      assertUnit(l.pHead->pNext == pTwo);
+      assertUnit(l.pTail == pThree);
+   }  // teardown
+
+   /***************************************
+    * SORT
+    ***************************************/
+
+   // sorting an empty list does nothing
+   void test_sort_empty()
+   {  // setup
+      custom::list<int> l;
+      // exercise
+      l.sort();
+      // verify
+      assertEmptyFixture(l);
+   }  // teardown
+
+   // sort a short list, relinking the nodes
+   void test_sort_standard()
+   {  // setup
+      custom::list<int> l{ 31, 11, 26 };
+      custom::list<int>::Node* pEleven = l.pHead->pNext;
+      // exercise
+      l.sort();
+      // verify
+      assertUnit(sameValues(l, { 11, 26, 31 }));
+      assertUnit(l.pHead == pEleven);
+   }  // teardown
+
+   // sort with a comparison of our own
+   void test_sort_descending()
+   {  // setup
+      custom::list<int> l{ 3, 1, 4, 1, 5, 9, 2, 6 };
+      // exercise
+      l.sort([](int lhs, int rhs) { return lhs > rhs; });
+      // verify
+      assertUnit(sameValues(l, { 9, 6, 5, 4, 3, 2, 1, 1 }));
+   }  // teardown
+
+   // equal elements keep their order through the sort
+   void test_sort_stable()
+   {  // setup
+      custom::list<int> l;
+      std::vector<custom::list<int>::Node*> nodes;
+      for (int i = 0; i < 1000; i++)
+      {
+         l.push_back((i * 7919) % 10);
+         nodes.push_back(l.pTail);
+      }
+      // exercise
+      l.sort();
+      // verify
+      std::vector<int> sorted;
+      for (int i = 0; i < 1000; i++)
+         sorted.push_back((i * 7919) % 10);
+      std::stable_sort(sorted.begin(), sorted.end());
+      assertUnit(sameValues(l, sorted));
+      bool stable = true;
+      for (custom::list<int>::Node* p = l.pHead; p && p->pNext; p = p->pNext)
+         if (p->data == p->pNext->data)
+            stable = stable && std::find(nodes.begin(), nodes.end(), p) <
+                               std::find(nodes.begin(), nodes.end(), p->pNext);
+      assertUnit(stable);
+   }  // teardown
+
+   /****************************************************************
+    * SAME VALUES
+    * Does the list hold exactly these values, with every pPrev,
+    * pTail and numElements agreeing with the pNext chain?
+    ****************************************************************/
+   bool sameValues(const custom::list<int>& l, const std::vector<int>& values)
+   {
+      if (l.numElements != values.size())
+         return false;
+      custom::list<int>::Node* pPrev = nullptr;
+      custom::list<int>::Node* p = l.pHead;
+      for (size_t i = 0; i < values.size(); i++, pPrev = p, p = p->pNext)
+         if (p == nullptr || p->pPrev != pPrev || p->data != values[i])
+            return false;
+      return p == nullptr && l.pTail == pPrev;
+   }
+
    /****************************************************************
     * Setup Standard Fixture
     *        pHead             pTail
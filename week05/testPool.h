@@ -0,0 +1,216 @@
+/***********************************************************************
+ * Header:
+ *    TEST POOL
+ * Summary:
+ *    Unit tests for the pool allocator
+ * Author
+ *    Steven Sellers
+ ************************************************************************/
+
+#pragma once
+#ifdef DEBUG
+
+#include "pool.h"       // class under test
+#include "unitTest.h"   // unit test baseclass
+
+/***********************************************
+ * TEST POOL
+ * Unit tests for the pool allocator
+ ***********************************************/
+class TestPool : public UnitTest
+{
+public:
+   void run()
+   {
+      reset();
+
+      // Construct
+      test_construct_default();
+      test_constructRebind_shares();
+      test_selectCopy_newPool();
+
+      // Allocate
+      test_allocate_contiguous();
+      test_allocate_newSlab();
+      test_allocate_array();
+      test_deallocate_reuse();
+
+      // Release
+      test_release_unshared();
+      test_release_shared();
+      test_release_startsOver();
+
+      report("Pool");
+   }
+
+   /***************************************
+    * CONSTRUCT
+    ***************************************/
+
+   // a new allocator has an empty pool
+   void test_construct_default()
+   {  // setup
+      // exercise
+      custom::pool_allocator<long> alloc;
+      // verify
+      assertUnit(alloc.pPool != nullptr);
+      if (alloc.pPool)
+      {
+         assertUnit(alloc.pPool->pSlabs == nullptr);
+         assertUnit(alloc.pPool->pFree == nullptr);
+         assertUnit(alloc.pPool->sizeBlock == 0);
+      }
+   }  // teardown
+
+   // an allocator rebound to another type shares the pool
+   void test_constructRebind_shares()
+   {  // setup
+      custom::pool_allocator<long> alloc;
+      // exercise
+      custom::pool_allocator<double> allocRebind(alloc);
+      // verify
+      assertUnit(allocRebind.pPool == alloc.pPool);
+      assertUnit(allocRebind == alloc);
+      assertUnit(alloc.pPool.use_count() == 2);
+   }  // teardown
+
+   // a copied container gets its own pool
+   void test_selectCopy_newPool()
+   {  // setup
+      custom::pool_allocator<long> alloc;
+      // exercise
+      custom::pool_allocator<long> allocCopy = alloc.select_on_container_copy_construction();
+      // verify
+      assertUnit(allocCopy != alloc);
+      assertUnit(alloc.pPool.use_count() == 1);
+   }  // teardown
+
+   /***************************************
+    * ALLOCATE
+    ***************************************/
+
+   // blocks come one after another from the same slab
+   void test_allocate_contiguous()
+   {  // setup
+      custom::pool_allocator<long> alloc;
+      // exercise
+      long* p1 = alloc.allocate(1);
+      long* p2 = alloc.allocate(1);
+      long* p3 = alloc.allocate(1);
+      // verify
+      size_t sizeBlock = alloc.pPool->sizeBlock;
+      assertUnit(sizeBlock >= sizeof(long));
+      assertUnit((char*)p2 - (char*)p1 == (long)sizeBlock);
+      assertUnit((char*)p3 - (char*)p2 == (long)sizeBlock);
+      assertUnit(alloc.pPool->pSlabs != nullptr);
+      if (alloc.pPool->pSlabs)
+         assertUnit(alloc.pPool->pSlabs->pNext == nullptr);
+      // teardown
+      alloc.deallocate(p1, 1);
+      alloc.deallocate(p2, 1);
+      alloc.deallocate(p3, 1);
+   }
+
+   // a full slab is followed by a bigger one
+   void test_allocate_newSlab()
+   {  // setup
+      custom::pool_allocator<long> alloc;
+      for (int i = 0; i < 64; i++)
+         alloc.allocate(1);
+      assertUnit(alloc.pPool->pNext == alloc.pPool->pEnd);
+      // exercise
+      long* p = alloc.allocate(1);
+      // verify
+      assertUnit(alloc.pPool->pSlabs != nullptr);
+      if (alloc.pPool->pSlabs)
+         assertUnit(alloc.pPool->pSlabs->pNext != nullptr);
+      assertUnit(alloc.pPool->numBlocksNext == 256);
+      assertUnit((char*)p + alloc.pPool->sizeBlock == alloc.pPool->pNext);
+   }  // teardown
+
+   // more than one object at a time does not come from the pool
+   void test_allocate_array()
+   {  // setup
+      custom::pool_allocator<long> alloc;
+      // exercise
+      long* p = alloc.allocate(4);
+      // verify
+      assertUnit(p != nullptr);
+      assertUnit(alloc.pPool->pSlabs == nullptr);
+      // teardown
+      alloc.deallocate(p, 4);
+      assertUnit(alloc.pPool->pFree == nullptr);
+   }
+
+   // a freed block is the next one handed out
+   void test_deallocate_reuse()
+   {  // setup
+      custom::pool_allocator<long> alloc;
+      long* p1 = alloc.allocate(1);
+      long* p2 = alloc.allocate(1);
+      // exercise
+      alloc.deallocate(p1, 1);
+      long* p3 = alloc.allocate(1);
+      // verify
+      assertUnit(p3 == p1);
+      assertUnit(alloc.pPool->pFree == nullptr);
+      // teardown
+      alloc.deallocate(p2, 1);
+      alloc.deallocate(p3, 1);
+   }
+
+   /***************************************
+    * RELEASE
+    ***************************************/
+
+   // a pool nobody else uses can drop every slab at once
+   void test_release_unshared()
+   {  // setup
+      custom::pool_allocator<long> alloc;
+      for (int i = 0; i < 100; i++)
+         alloc.allocate(1);
+      // exercise
+      bool released = custom::releaseAll(alloc);
+      // verify
+      assertUnit(released);
+      assertUnit(alloc.pPool->pSlabs == nullptr);
+      assertUnit(alloc.pPool->pFree == nullptr);
+      assertUnit(alloc.pPool->pNext == alloc.pPool->pEnd);
+   }  // teardown
+
+   // a shared pool must not be dropped
+   void test_release_shared()
+   {  // setup
+      custom::pool_allocator<long> alloc;
+      custom::pool_allocator<long> allocShare(alloc);
+      long* p = alloc.allocate(1);
+      std::allocator<long> allocStd;
+      // exercise
+      bool released = custom::releaseAll(alloc);
+      bool releasedStd = custom::releaseAll(allocStd);
+      // verify
+      assertUnit(!released);
+      assertUnit(!releasedStd);
+      assertUnit(alloc.pPool->pSlabs != nullptr);
+      // teardown
+      alloc.deallocate(p, 1);
+   }
+
+   // after a release the next slab is small again
+   void test_release_startsOver()
+   {  // setup
+      custom::pool_allocator<long> alloc;
+      for (int i = 0; i < 100; i++)
+         alloc.allocate(1);
+      // exercise
+      bool released = custom::releaseAll(alloc);
+      // verify
+      assertUnit(released);
+      assertUnit(alloc.pPool->sizeBlock == 0);
+      assertUnit(alloc.pPool->numBlocksNext == 64);
+      alloc.allocate(1);
+      assertUnit(size_t(alloc.pPool->pEnd - alloc.pPool->pNext) == 63 * alloc.pPool->sizeBlock);
+   }  // teardown
+};
+
+#endif // DEBUG
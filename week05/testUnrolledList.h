@@ -0,0 +1,520 @@
+/***********************************************************************
+ * Header:
+ *    TEST UNROLLED LIST
+ * Summary:
+ *    Unit tests for unrolled_list
+ * Author
+ *    Steven Sellers
+ ************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG
+
+#include "unrolled_list.h"   // class under test
+#include "unitTest.h"        // unit test baseclass
+
+#include <string>
+#include <vector>
+
+/***********************************************
+ * TEST UNROLLED LIST
+ * Unit tests for unrolled_list. Four elements to a node
+ * keeps the splits and merges easy to draw
+ ***********************************************/
+class TestUnrolledList : public UnitTest
+{
+   using List = custom::unrolled_list<int, 4>;
+   using Nodes = std::vector<std::vector<int>>;
+public:
+   void run()
+   {
+      reset();
+
+      // Construct
+      test_construct_default();
+      test_construct_init();
+      test_construct_copy();
+      test_construct_move();
+      test_assign_copy();
+      test_assign_init();
+      test_swap();
+
+      // Access
+      test_front_back();
+      test_front_empty();
+
+      // Iterator
+      test_iterator_forward();
+      test_iterator_backward();
+      test_iterator_empty();
+
+      // Insert
+      test_pushback_newNode();
+      test_pushfront_shift();
+      test_pushfront_newNode();
+      test_insert_room();
+      test_insert_splitLow();
+      test_insert_splitHigh();
+      test_insert_end();
+      test_insert_strings();
+
+      // Remove
+      test_popback_node();
+      test_popfront_node();
+      test_pop_empty();
+      test_erase_shift();
+      test_erase_merge();
+      test_erase_borrow();
+      test_erase_lastInNode();
+      test_erase_all();
+      test_clear_strings();
+      test_clear_pool();
+
+      report("UnrolledList");
+   }
+
+   /***************************************
+    * CONSTRUCT
+    ***************************************/
+
+   // an empty list has no nodes
+   void test_construct_default()
+   {  // setup
+      // exercise
+      List l;
+      // verify
+      assertUnit(l.empty());
+      assertUnit(l.pHead == nullptr);
+      assertUnit(l.pTail == nullptr);
+   }  // teardown
+
+   // values fill each node before the next
+   void test_construct_init()
+   {  // setup
+      // exercise
+      List l{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+      // verify
+      assertUnit(sameNodes(l, { { 1, 2, 3, 4 }, { 5, 6, 7, 8 }, { 9 } }));
+   }  // teardown
+
+   // a copy has the same elements in new nodes
+   void test_construct_copy()
+   {  // setup
+      List lSrc{ 1, 2, 3, 4, 5 };
+      // exercise
+      List lDes(lSrc);
+      // verify
+      assertUnit(sameNodes(lDes, { { 1, 2, 3, 4 }, { 5 } }));
+      assertUnit(sameNodes(lSrc, { { 1, 2, 3, 4 }, { 5 } }));
+      assertUnit(lDes.pHead != lSrc.pHead);
+   }  // teardown
+
+   // a move takes the nodes
+   void test_construct_move()
+   {  // setup
+      List lSrc{ 1, 2, 3, 4, 5 };
+      List::Node* pHead = lSrc.pHead;
+      // exercise
+      List lDes(std::move(lSrc));
+      // verify
+      assertUnit(sameNodes(lDes, { { 1, 2, 3, 4 }, { 5 } }));
+      assertUnit(lDes.pHead == pHead);
+      assertUnit(sameNodes(lSrc, {}));
+   }  // teardown
+
+   // copy a list over a bigger one
+   void test_assign_copy()
+   {  // setup
+      List lSrc{ 1, 2 };
+      List lDes{ 9, 9, 9, 9, 9, 9 };
+      // exercise
+      lDes = lSrc;
+      // verify
+      assertUnit(sameNodes(lDes, { { 1, 2 } }));
+      assertUnit(sameNodes(lSrc, { { 1, 2 } }));
+   }  // teardown
+
+   // assign from an initializer list
+   void test_assign_init()
+   {  // setup
+      List l{ 9 };
+      // exercise
+      l = { 1, 2, 3, 4, 5 };
+      // verify
+      assertUnit(sameNodes(l, { { 1, 2, 3, 4 }, { 5 } }));
+   }  // teardown
+
+   // swap trades the nodes
+   void test_swap()
+   {  // setup
+      List l1{ 1, 2, 3, 4, 5 };
+      List l2;
+      // exercise
+      swap(l1, l2);
+      // verify
+      assertUnit(sameNodes(l1, {}));
+      assertUnit(sameNodes(l2, { { 1, 2, 3, 4 }, { 5 } }));
+   }  // teardown
+
+   /***************************************
+    * ACCESS
+    ***************************************/
+
+   // front and back reach into the end nodes
+   void test_front_back()
+   {  // setup
+      List l{ 1, 2, 3, 4, 5 };
+      // exercise
+      l.front() = 10;
+      l.back() = 50;
+      // verify
+      assertUnit(sameNodes(l, { { 10, 2, 3, 4 }, { 50 } }));
+   }  // teardown
+
+   // an empty list has no front
+   void test_front_empty()
+   {  // setup
+      List l;
+      bool thrown = false;
+      // exercise
+      try
+      {
+         l.front();
+      }
+      catch (const std::out_of_range&)
+      {
+         thrown = true;
+      }
+      // verify
+      assertUnit(thrown);
+   }  // teardown
+
+   /***************************************
+    * ITERATOR
+    ***************************************/
+
+   // walk every element across the nodes
+   void test_iterator_forward()
+   {  // setup
+      List l{ 1, 2, 3, 4, 5, 6 };
+      std::vector<int> values;
+      // exercise
+      for (List::iterator it = l.begin(); it != l.end(); it++)
+         values.push_back(*it);
+      // verify
+      assertUnit(values == std::vector<int>({ 1, 2, 3, 4, 5, 6 }));
+   }  // teardown
+
+   // walk back from end() to begin()
+   void test_iterator_backward()
+   {  // setup
+      List l{ 1, 2, 3, 4, 5, 6 };
+      std::vector<int> values;
+      List::iterator it = l.end();
+      // exercise
+      while (it != l.begin())
+         values.push_back(*--it);
+      // verify
+      assertUnit(values == std::vector<int>({ 6, 5, 4, 3, 2, 1 }));
+      assertUnit(it.p == l.pHead);
+      assertUnit(it.index == 0);
+   }  // teardown
+
+   // begin() of an empty list is end()
+   void test_iterator_empty()
+   {  // setup
+      List l;
+      // exercise
+      List::iterator it = l.begin();
+      // verify
+      assertUnit(it == l.end());
+   }  // teardown
+
+   /***************************************
+    * INSERT
+    ***************************************/
+
+   // a full tail starts a new node
+   void test_pushback_newNode()
+   {  // setup
+      List l{ 1, 2, 3, 4 };
+      List::Node* pHead = l.pHead;
+      // exercise
+      l.push_back(5);
+      // verify
+      assertUnit(sameNodes(l, { { 1, 2, 3, 4 }, { 5 } }));
+      assertUnit(l.pHead == pHead);
+   }  // teardown
+
+   // a head with room shifts up to make a space
+   void test_pushfront_shift()
+   {  // setup
+      List l{ 1, 2 };
+      // exercise
+      l.push_front(0);
+      // verify
+      assertUnit(sameNodes(l, { { 0, 1, 2 } }));
+   }  // teardown
+
+   // a full head gets a new node in front of it
+   void test_pushfront_newNode()
+   {  // setup
+      List l{ 1, 2, 3, 4 };
+      // exercise
+      l.push_front(0);
+      // verify
+      assertUnit(sameNodes(l, { { 0 }, { 1, 2, 3, 4 } }));
+   }  // teardown
+
+   // a node with room takes the insert itself
+   void test_insert_room()
+   {  // setup
+      List l{ 1, 2, 3, 4, 5, 6 };
+      List::iterator it(&l, l.pTail, 1);
+      // exercise
+      List::iterator itNew = l.insert(it, 99);
+      // verify
+      assertUnit(sameNodes(l, { { 1, 2, 3, 4 }, { 5, 99, 6 } }));
+      assertUnit(*itNew == 99);
+   }  // teardown
+
+   // a full node splits and the insert lands in the lower half
+   void test_insert_splitLow()
+   {  // setup
+      List l{ 1, 2, 3, 4, 5 };
+      List::iterator it(&l, l.pHead, 1);
+      // exercise
+      List::iterator itNew = l.insert(it, 99);
+      // verify
+      assertUnit(sameNodes(l, { { 1, 99, 2 }, { 3, 4 }, { 5 } }));
+      assertUnit(itNew.p == l.pHead);
+      assertUnit(*itNew == 99);
+   }  // teardown
+
+   // a full node splits and the insert lands in the upper half
+   void test_insert_splitHigh()
+   {  // setup
+      List l{ 1, 2, 3, 4 };
+      List::iterator it(&l, l.pHead, 3);
+      // exercise
+      List::iterator itNew = l.insert(it, 99);
+      // verify
+      assertUnit(sameNodes(l, { { 1, 2 }, { 3, 99, 4 } }));
+      assertUnit(itNew.p == l.pTail);
+      assertUnit(*itNew == 99);
+   }  // teardown
+
+   // insert at end() is push_back
+   void test_insert_end()
+   {  // setup
+      List l{ 1, 2, 3, 4 };
+      // exercise
+      List::iterator itNew = l.insert(l.end(), 5);
+      // verify
+      assertUnit(sameNodes(l, { { 1, 2, 3, 4 }, { 5 } }));
+      assertUnit(*itNew == 5);
+      assertUnit(++itNew == l.end());
+   }  // teardown
+
+   // elements that own memory survive the shifts and splits
+   void test_insert_strings()
+   {  // setup
+      custom::unrolled_list<std::string, 4> l;
+      for (int i = 0; i < 20; i++)
+         l.insert(l.begin(), std::string(30, char('a' + i)));
+      // exercise
+      l.insert(l.end(), std::string("end"));
+      // verify
+      assertUnit(l.size() == 21);
+      assertUnit(l.front() == std::string(30, 't'));
+      assertUnit(l.back() == "end");
+      char c = 't';
+      bool ordered = true;
+      for (auto it = l.begin(); *it != "end"; ++it)
+         ordered = ordered && (*it == std::string(30, c--));
+      assertUnit(ordered);
+   }  // teardown
+
+   /***************************************
+    * REMOVE
+    ***************************************/
+
+   // popping the last element of a node frees the node
+   void test_popback_node()
+   {  // setup
+      List l{ 1, 2, 3, 4, 5 };
+      // exercise
+      l.pop_back();
+      // verify
+      assertUnit(sameNodes(l, { { 1, 2, 3, 4 } }));
+   }  // teardown
+
+   // popping the front shifts the head node down
+   void test_popfront_node()
+   {  // setup
+      List l{ 1, 5, 6 };
+      l.push_front(0);
+      l.push_front(-1);
+      // exercise
+      l.pop_front();
+      // verify
+      assertUnit(sameNodes(l, { { 0, 1, 5, 6 } }));
+   }  // teardown
+
+   // popping an empty list does nothing
+   void test_pop_empty()
+   {  // setup
+      List l;
+      // exercise
+      l.pop_back();
+      l.pop_front();
+      // verify
+      assertUnit(sameNodes(l, {}));
+   }  // teardown
+
+   // erase from a node that stays half full
+   void test_erase_shift()
+   {  // setup
+      List l{ 1, 2, 3, 4, 5 };
+      List::iterator it(&l, l.pHead, 1);
+      // exercise
+      List::iterator itNext = l.erase(it);
+      // verify
+      assertUnit(sameNodes(l, { { 1, 3, 4 }, { 5 } }));
+      assertUnit(*itNext == 3);
+   }  // teardown
+
+   // a node under half full takes in a small successor
+   void test_erase_merge()
+   {  // setup
+      List l{ 1, 2, 3, 4, 5, 6 };
+      l.erase(l.begin());
+      l.erase(l.begin());                    // { 3, 4 } { 5, 6 }
+      List::iterator it(&l, l.pHead, 0);
+      // exercise
+      List::iterator itNext = l.erase(it);
+      // verify
+      assertUnit(sameNodes(l, { { 4, 5, 6 } }));
+      assertUnit(*itNext == 4);
+   }  // teardown
+
+   // a node under half full borrows from a big successor
+   void test_erase_borrow()
+   {  // setup
+      List l{ 1, 2, 3, 4, 5, 6, 7, 8 };
+      l.erase(l.begin());
+      l.erase(l.begin());                    // { 3, 4 } { 5, 6, 7, 8 }
+      List::iterator it(&l, l.pHead, 1);
+      // exercise
+      List::iterator itNext = l.erase(it);
+      // verify
+      assertUnit(sameNodes(l, { { 3, 5 }, { 6, 7, 8 } }));
+      assertUnit(*itNext == 5);
+   }  // teardown
+
+   // erasing the only element of a node frees it
+   void test_erase_lastInNode()
+   {  // setup
+      List l{ 1, 2, 3, 4, 5 };
+      List::iterator it(&l, l.pTail, 0);
+      // exercise
+      List::iterator itNext = l.erase(it);
+      // verify
+      assertUnit(sameNodes(l, { { 1, 2, 3, 4 } }));
+      assertUnit(itNext == l.end());
+   }  // teardown
+
+   // erase every other element, then the rest
+   void test_erase_all()
+   {  // setup
+      List l;
+      for (int i = 0; i < 100; i++)
+         l.push_back(i);
+      // exercise
+      for (List::iterator it = l.begin(); it != l.end(); )
+      {
+         it = l.erase(it);
+         if (it != l.end())
+            ++it;
+      }
+      // verify
+      std::vector<int> odd;
+      for (int i = 1; i < 100; i += 2)
+         odd.push_back(i);
+      assertUnit(sameValues(l, odd));
+      for (List::iterator it = l.begin(); it != l.end(); )
+         it = l.erase(it);
+      assertUnit(sameNodes(l, {}));
+   }  // teardown
+
+   // clearing destroys every element
+   void test_clear_strings()
+   {  // setup
+      custom::unrolled_list<std::string, 4> l;
+      for (int i = 0; i < 10; i++)
+         l.push_back(std::string(30, 'x'));
+      // exercise
+      l.clear();
+      // verify
+      assertUnit(l.empty());
+      assertUnit(l.pHead == nullptr);
+      assertUnit(l.pTail == nullptr);
+   }  // teardown
+
+   // clearing a pooled list of ints drops the slabs in one step
+   void test_clear_pool()
+   {  // setup
+      custom::unrolled_list<int, 4, custom::pool_allocator<int>> l;
+      for (int i = 0; i < 100; i++)
+         l.push_back(i);
+      // exercise
+      l.clear();
+      // verify
+      assertUnit(l.empty());
+      assertUnit(l.pHead == nullptr);
+      assertUnit(l.alloc.pPool->pSlabs == nullptr);
+   }  // teardown
+
+   /****************************************************************
+    * SAME NODES
+    * Does the list hold exactly these nodes of values, with every
+    * pPrev, pTail and numElements agreeing with the pNext chain?
+    ****************************************************************/
+   bool sameNodes(const List& l, const Nodes& nodes)
+   {
+      size_t num = 0;
+      List::Node* pPrev = nullptr;
+      List::Node* p = l.pHead;
+      for (size_t n = 0; n < nodes.size(); n++, pPrev = p, p = p->pNext)
+      {
+         if (p == nullptr || p->pPrev != pPrev || p->num != nodes[n].size())
+            return false;
+         for (size_t i = 0; i < p->num; i++)
+            if ((*p)[i] != nodes[n][i])
+               return false;
+         num += p->num;
+      }
+      return p == nullptr && l.pTail == pPrev && l.numElements == num;
+   }
+
+   /****************************************************************
+    * SAME VALUES
+    * Does the list hold these values, however they are split
+    * into nodes? No node may be empty
+    ****************************************************************/
+   bool sameValues(const List& l, const std::vector<int>& values)
+   {
+      std::vector<int> found;
+      for (List::Node* p = l.pHead; p; p = p->pNext)
+      {
+         if (p->num == 0)
+            return false;
+         for (size_t i = 0; i < p->num; i++)
+            found.push_back((*p)[i]);
+      }
+      return found == values && l.numElements == values.size();
+   }
+};
+
+#endif // DEBUG
@@ -0,0 +1,749 @@
+/***********************************************************************
+ * Header:
+ *    UNROLLED LIST
+ * Summary:
+ *    A linked list whose nodes each hold a small array of elements
+ *      __       ____       ____         __
+ *     /  |    .'    '.   .'    '.   _  / /
+ *     `| |   |  .--.  | |  .--.  | (_)/ /
+ *      | |   | |    | | | |    | |   / / _
+ *     _| |_  |  `--'  | |  `--'  |  / / (_)
+ *    |_____|  '.____.'   '.____.'  /_/
+ *
+ *
+ *    This will contain the class definition of:
+ *        unrolled_list           : A list of arrays of up to B elements
+ *        unrolled_list::iterator : An iterator through unrolled_list
+ * Author
+ *    Noah Li, Steven Sellers, Josh Hamilton.
+ ************************************************************************/
+
+#pragma once
+#include <cassert>     // for ASSERT
+#include <cstddef>     // for size_t
+#include <initializer_list>
+#include <memory>      // for std::allocator
+#include <new>         // for placement new
+#include <stdexcept>   // for std::out_of_range
+#include <type_traits> // for std::aligned_storage
+#include <utility>     // for std::move
+#include "pool.h"      // for releaseAll
+
+class TestUnrolledList;   // forward declaration for unit tests
+
+namespace custom
+{
+
+/**************************************************
+ * UNROLLED LIST
+ * A list where every node holds up to B elements side by side.
+ * A walk through the list reads B elements per node instead of
+ * one, and the pointers cost 2/B per element instead of 2.
+ * Nodes are split when an insert finds them full. When an erase
+ * leaves a node less than half full, the node takes elements
+ * from its successor, or merges with it. Any insert or erase
+ * may move the elements of its node and the next, so it
+ * invalidates iterators into those two nodes.
+ **************************************************/
+template <typename T, size_t B = 16, typename A = std::allocator<T>>
+class unrolled_list
+{
+   static_assert(B >= 2, "an unrolled_list node must hold at least two elements");
+   friend class ::TestUnrolledList; // give unit tests access to the privates
+public:
+   //
+   // Construct
+   //
+
+   unrolled_list() : numElements(0), pHead(nullptr), pTail(nullptr), alloc() {}
+   explicit unrolled_list(const A& a) : numElements(0), pHead(nullptr), pTail(nullptr), alloc(a) {}
+   unrolled_list(const unrolled_list& rhs);
+   unrolled_list(unrolled_list&& rhs);
+   unrolled_list(const std::initializer_list<T>& il) : unrolled_list(il.begin(), il.end()) {}
+   template <class Iterator>
+   unrolled_list(Iterator first, Iterator last);
+  ~unrolled_list()
+   {
+      clear();
+   }
+
+   //
+   // Assign
+   //
+
+   unrolled_list& operator = (const unrolled_list& rhs);
+   unrolled_list& operator = (unrolled_list&& rhs);
+   unrolled_list& operator = (const std::initializer_list<T>& il);
+   void swap(unrolled_list& rhs);
+   A get_allocator() const { return A(alloc); }
+
+   //
+   // Iterator
+   //
+
+   class iterator;
+   iterator begin() { return iterator(this, pHead, 0); }
+   iterator end()   { return iterator(this, nullptr, 0); }
+
+   //
+   // Access
+   //
+
+   T& front();
+   T& back();
+
+   //
+   // Insert
+   //
+
+   void push_front(const T&  data) { push_front(T(data)); }
+   void push_front(      T&& data);
+   void push_back (const T&  data) { push_back(T(data)); }
+   void push_back (      T&& data);
+   iterator insert(iterator it, const T& data) { return insert(it, T(data)); }
+   iterator insert(iterator it, T&& data);
+
+   //
+   // Remove
+   //
+
+   void pop_back();
+   void pop_front();
+   void clear();
+   iterator erase(const iterator& it);
+
+   //
+   // Status
+   //
+
+   bool empty()  const { return size() == 0; }
+   size_t size() const { return numElements; }
+
+private:
+   // nested node class
+   class Node;
+
+   using NodeAlloc  = typename std::allocator_traits<A>::template rebind_alloc<Node>;
+   using NodeTraits = std::allocator_traits<NodeAlloc>;
+
+   // every node is created and destroyed through the allocator
+   Node * createNode();
+   void destroyNode(Node * pNode) noexcept;
+   Node * linkAfter(Node * pPrev);
+   void unlink(Node * pNode) noexcept;
+
+   // elements move within and between nodes
+   void emplaceAt(Node * pNode, size_t index, T&& data);
+   void eraseAt(Node * pNode, size_t index);
+   void rebalance(Node * pNode);
+
+   // member variables
+   size_t numElements; // elements, not nodes
+   Node * pHead;       // first node, or nullptr
+   Node * pTail;       // last node, or nullptr
+   NodeAlloc alloc;    // where the nodes come from
+};
+
+/*************************************************
+ * NODE
+ * Up to B elements in raw storage. Only the first num slots
+ * hold a constructed T, so the node itself is trivially
+ * destructible and the list destroys the elements
+ *************************************************/
+template <typename T, size_t B, typename A>
+class unrolled_list <T, B, A> :: Node
+{
+public:
+   Node() : pNext(nullptr), pPrev(nullptr), num(0) {}
+
+   T & operator [] (size_t index)
+   {
+      assert(index < B);
+      return *reinterpret_cast<T*>(&slots[index]);
+   }
+
+   Node * pNext;    // pointer to next node
+   Node * pPrev;    // pointer to previous node
+   size_t num;      // constructed elements at the front of slots
+   typename std::aligned_storage<sizeof(T), alignof(T)>::type slots[B];
+};
+
+/*************************************************
+ * UNROLLED LIST ITERATOR
+ * A node and a slot within it. end() is a null node, and the
+ * list pointer lets -- step back from it to the last element
+ ************************************************/
+template <typename T, size_t B, typename A>
+class unrolled_list <T, B, A> :: iterator
+{
+   friend class ::TestUnrolledList; // give unit tests access to the privates
+   template <typename TT, size_t BB, typename AA>
+   friend class custom::unrolled_list;
+public:
+   // constructors, destructors, and assignment operator
+   iterator() : pList(nullptr), p(nullptr), index(0) {}
+   iterator(unrolled_list * pList, Node * p, size_t index) : pList(pList), p(p), index(index) {}
+   iterator(const iterator& rhs) = default;
+   iterator & operator = (const iterator & rhs) = default;
+
+   // equals, not equals operator
+   bool operator == (const iterator & rhs) const { return p == rhs.p && index == rhs.index; }
+   bool operator != (const iterator & rhs) const { return !(*this == rhs); }
+
+   // dereference operator, fetch an element
+   T & operator * () const
+   {
+      if (p)
+         return (*p)[index];
+      throw std::out_of_range("Dereferencing end iterator");
+   }
+   T * operator -> () const
+   {
+      return &**this;
+   }
+
+   // prefix increment
+   iterator & operator ++ ()
+   {
+      if (p && ++index == p->num)
+      {
+         p = p->pNext;
+         index = 0;
+      }
+      return *this;
+   }
+
+   // postfix increment
+   iterator operator ++ (int postfix)
+   {
+      iterator pre = *this;
+      ++*this;
+      return pre;
+   }
+
+   // prefix decrement
+   iterator & operator -- ()
+   {
+      if (p == nullptr)
+      {
+         p = (pList ? pList->pTail : nullptr);
+         index = (p ? p->num - 1 : 0);
+      }
+      else if (index > 0)
+         index--;
+      else if (p->pPrev)
+      {
+         p = p->pPrev;
+         index = p->num - 1;
+      }
+      return *this;
+   }
+
+   // postfix decrement
+   iterator operator -- (int postfix)
+   {
+      iterator pre = *this;
+      --*this;
+      return pre;
+   }
+
+private:
+   unrolled_list * pList;   // the list, to step back from end()
+   Node * p;                // the node, or nullptr for end()
+   size_t index;            // the slot within the node
+};
+
+/*****************************************
+ * UNROLLED LIST :: COPY constructor
+ * The allocator decides whether the copy shares its pool
+ ****************************************/
+template <typename T, size_t B, typename A>
+unrolled_list <T, B, A> ::unrolled_list(const unrolled_list& rhs) :
+   numElements(0), pHead(nullptr), pTail(nullptr),
+   alloc(NodeTraits::select_on_container_copy_construction(rhs.alloc))
+{
+   try
+   {
+      for (Node * p = rhs.pHead; p; p = p->pNext)
+         for (size_t i = 0; i < p->num; i++)
+            push_back((*p)[i]);
+   }
+   catch (...)
+   {
+      clear();
+      throw;
+   }
+}
+
+/*****************************************
+ * UNROLLED LIST :: MOVE constructor
+ * Steal the nodes from the RHS
+ ****************************************/
+template <typename T, size_t B, typename A>
+unrolled_list <T, B, A> ::unrolled_list(unrolled_list&& rhs) :
+   numElements(rhs.numElements), pHead(rhs.pHead), pTail(rhs.pTail), alloc(rhs.alloc)
+{
+   rhs.pHead = rhs.pTail = nullptr;
+   rhs.numElements = 0;
+}
+
+/*****************************************
+ * UNROLLED LIST :: RANGE constructor
+ * Fill each node before starting the next
+ ****************************************/
+template <typename T, size_t B, typename A>
+template <class Iterator>
+unrolled_list <T, B, A> ::unrolled_list(Iterator first, Iterator last) : unrolled_list()
+{
+   try
+   {
+      for (Iterator it = first; it != last; ++it)
+         push_back(*it);
+   }
+   catch (...)
+   {
+      clear();
+      throw;
+   }
+}
+
+/**********************************************
+ * UNROLLED LIST :: assignment operator
+ *     INPUT  : a list to be copied
+ *     OUTPUT :
+ *     COST   : O(n)
+ *********************************************/
+template <typename T, size_t B, typename A>
+unrolled_list <T, B, A> & unrolled_list <T, B, A> :: operator = (const unrolled_list& rhs)
+{
+   if (this != &rhs)
+   {
+      clear();
+      for (Node * p = rhs.pHead; p; p = p->pNext)
+         for (size_t i = 0; i < p->num; i++)
+            push_back((*p)[i]);
+   }
+   return *this;
+}
+
+/**********************************************
+ * UNROLLED LIST :: assignment operator - MOVE
+ *     INPUT  : a list to be moved
+ *     OUTPUT :
+ *     COST   : O(n) with respect to the size of the LHS
+ *********************************************/
+template <typename T, size_t B, typename A>
+unrolled_list <T, B, A> & unrolled_list <T, B, A> :: operator = (unrolled_list&& rhs)
+{
+   if (this != &rhs)
+   {
+      clear();
+
+      // nodes from an allocator we cannot take must be moved one by one
+      if (!NodeTraits::propagate_on_container_move_assignment::value && !(alloc == rhs.alloc))
+      {
+         for (Node * p = rhs.pHead; p; p = p->pNext)
+            for (size_t i = 0; i < p->num; i++)
+               push_back(std::move((*p)[i]));
+         rhs.clear();
+         return *this;
+      }
+
+      if (NodeTraits::propagate_on_container_move_assignment::value)
+         alloc = rhs.alloc;
+      pHead = rhs.pHead;
+      pTail = rhs.pTail;
+      numElements = rhs.numElements;
+
+      rhs.pHead = rhs.pTail = nullptr;
+      rhs.numElements = 0;
+   }
+   return *this;
+}
+
+/**********************************************
+ * UNROLLED LIST :: assignment operator
+ *     INPUT  : the values to copy
+ *     OUTPUT :
+ *     COST   : O(n)
+ *********************************************/
+template <typename T, size_t B, typename A>
+unrolled_list <T, B, A> & unrolled_list <T, B, A> :: operator = (const std::initializer_list<T>& il)
+{
+   clear();
+   for (const T & t : il)
+      push_back(t);
+   return *this;
+}
+
+/**********************************************
+ * UNROLLED LIST :: SWAP
+ * Swap the nodes, and the allocators with them
+ *     COST   : O(1)
+ *********************************************/
+template <typename T, size_t B, typename A>
+void unrolled_list <T, B, A> ::swap(unrolled_list& rhs)
+{
+   std::swap(pHead, rhs.pHead);
+   std::swap(pTail, rhs.pTail);
+   std::swap(numElements, rhs.numElements);
+   std::swap(alloc, rhs.alloc);
+}
+
+template <typename T, size_t B, typename A>
+void swap(unrolled_list <T, B, A> & lhs, unrolled_list <T, B, A> & rhs)
+{
+   lhs.swap(rhs);
+}
+
+/*********************************************
+ * UNROLLED LIST :: FRONT and BACK
+ * The first and last elements
+ *     COST   : O(1)
+ *********************************************/
+template <typename T, size_t B, typename A>
+T & unrolled_list <T, B, A> ::front()
+{
+   if (pHead == nullptr)
+      throw std::out_of_range("front() of an empty unrolled_list");
+   return (*pHead)[0];
+}
+
+template <typename T, size_t B, typename A>
+T & unrolled_list <T, B, A> ::back()
+{
+   if (pTail == nullptr)
+      throw std::out_of_range("back() of an empty unrolled_list");
+   return (*pTail)[pTail->num - 1];
+}
+
+/*********************************************
+ * UNROLLED LIST :: PUSH BACK
+ * add an item to the end of the list, starting a new
+ * node when the last one is full
+ *     COST   : O(1)
+ *********************************************/
+template <typename T, size_t B, typename A>
+void unrolled_list <T, B, A> ::push_back(T && data)
+{
+   Node * pNode = pTail;
+   if (pNode == nullptr || pNode->num == B)
+      pNode = linkAfter(pTail);
+
+   try
+   {
+      emplaceAt(pNode, pNode->num, std::move(data));
+   }
+   catch (...)
+   {
+      if (pNode->num == 0)
+      {
+         unlink(pNode);
+         destroyNode(pNode);
+      }
+      throw;
+   }
+}
+
+/*********************************************
+ * UNROLLED LIST :: PUSH FRONT
+ * add an item to the front of the list, starting a new
+ * node when the first one is full
+ *     COST   : O(B)
+ *********************************************/
+template <typename T, size_t B, typename A>
+void unrolled_list <T, B, A> ::push_front(T && data)
+{
+   Node * pNode = pHead;
+   if (pNode == nullptr || pNode->num == B)
+      pNode = linkAfter(nullptr);
+
+   try
+   {
+      emplaceAt(pNode, 0, std::move(data));
+   }
+   catch (...)
+   {
+      if (pNode->num == 0)
+      {
+         unlink(pNode);
+         destroyNode(pNode);
+      }
+      throw;
+   }
+}
+
+/*********************************************
+ * UNROLLED LIST :: POP BACK
+ * remove the last item, and the last node when it empties
+ *     COST   : O(1)
+ *********************************************/
+template <typename T, size_t B, typename A>
+void unrolled_list <T, B, A> ::pop_back()
+{
+   if (pTail == nullptr)
+      return;
+
+   Node * pNode = pTail;
+   eraseAt(pNode, pNode->num - 1);
+   if (pNode->num == 0)
+   {
+      unlink(pNode);
+      destroyNode(pNode);
+   }
+}
+
+/*********************************************
+ * UNROLLED LIST :: POP FRONT
+ * remove the first item, and the first node when it empties
+ *     COST   : O(B)
+ *********************************************/
+template <typename T, size_t B, typename A>
+void unrolled_list <T, B, A> ::pop_front()
+{
+   if (pHead == nullptr)
+      return;
+
+   Node * pNode = pHead;
+   eraseAt(pNode, 0);
+   if (pNode->num == 0)
+   {
+      unlink(pNode);
+      destroyNode(pNode);
+   }
+}
+
+/**********************************************
+ * UNROLLED LIST :: CLEAR
+ * Remove all the items currently in the list
+ *     COST   : O(n), or O(slabs) for a private pool
+ *              of elements with nothing to destroy
+ *********************************************/
+template <typename T, size_t B, typename A>
+void unrolled_list <T, B, A> ::clear()
+{
+   // nodes of trivial elements can go back to a private pool all at once
+   if (pHead && std::is_trivially_destructible<T>::value && releaseAll(alloc))
+      pHead = nullptr;
+
+   while (pHead != nullptr)
+   {
+      Node * pNode = pHead;
+      pHead = pHead->pNext;
+      for (size_t i = 0; i < pNode->num; i++)
+         (*pNode)[i].~T();
+      destroyNode(pNode);
+   }
+   pTail = nullptr;
+   numElements = 0;
+}
+
+/******************************************
+ * UNROLLED LIST :: INSERT
+ * add an item in front of it. A full node is split in half
+ * first, so the other nodes are never touched
+ *     INPUT  : where the item goes and the item
+ *     OUTPUT : iterator to the new item
+ *     COST   : O(B)
+ ******************************************/
+template <typename T, size_t B, typename A>
+typename unrolled_list <T, B, A> ::iterator unrolled_list <T, B, A> ::insert(iterator it, T && data)
+{
+   if (it.p == nullptr)
+   {
+      push_back(std::move(data));
+      return iterator(this, pTail, pTail->num - 1);
+   }
+
+   Node * pNode = it.p;
+   size_t index = it.index;
+   if (pNode->num == B)
+   {
+      // move the upper half into a new node
+      Node * pSplit = linkAfter(pNode);
+      size_t half = B / 2;
+      for (size_t i = half; i < B; i++)
+      {
+         ::new (static_cast<void*>(&(*pSplit)[i - half])) T(std::move((*pNode)[i]));
+         (*pNode)[i].~T();
+         pSplit->num++;
+         pNode->num--;
+      }
+      if (index > half)
+      {
+         pNode = pSplit;
+         index -= half;
+      }
+   }
+
+   emplaceAt(pNode, index, std::move(data));
+   return iterator(this, pNode, index);
+}
+
+/******************************************
+ * UNROLLED LIST :: ERASE
+ * remove an item, then refill its node from the next one
+ * if it is left less than half full
+ *     INPUT  : an iterator to the item being removed
+ *     OUTPUT : iterator to the item after it
+ *     COST   : O(B)
+ ******************************************/
+template <typename T, size_t B, typename A>
+typename unrolled_list <T, B, A> ::iterator unrolled_list <T, B, A> ::erase(const iterator & it)
+{
+   Node * pNode = it.p;
+   size_t index = it.index;
+   if (pNode == nullptr)
+      return end();
+
+   eraseAt(pNode, index);
+   if (pNode->num == 0)
+   {
+      Node * pNext = pNode->pNext;
+      unlink(pNode);
+      destroyNode(pNode);
+      return iterator(this, pNext, 0);
+   }
+
+   // the element after the erased one is still at index once rebalanced
+   rebalance(pNode);
+   if (index < pNode->num)
+      return iterator(this, pNode, index);
+   return iterator(this, pNode->pNext, 0);
+}
+
+/**************************************************
+ * UNROLLED LIST :: EMPLACE AT
+ * Build an element at index, shifting the ones after it up
+ * a slot. The node must have room
+ *************************************************/
+template <typename T, size_t B, typename A>
+void unrolled_list <T, B, A> ::emplaceAt(Node * pNode, size_t index, T && data)
+{
+   assert(pNode->num < B && index <= pNode->num);
+   if (index == pNode->num)
+      ::new (static_cast<void*>(&(*pNode)[index])) T(std::move(data));
+   else
+   {
+      ::new (static_cast<void*>(&(*pNode)[pNode->num])) T(std::move((*pNode)[pNode->num - 1]));
+      for (size_t i = pNode->num - 1; i > index; i--)
+         (*pNode)[i] = std::move((*pNode)[i - 1]);
+      (*pNode)[index] = std::move(data);
+   }
+   pNode->num++;
+   numElements++;
+}
+
+/**************************************************
+ * UNROLLED LIST :: ERASE AT
+ * Destroy the element at index, shifting the ones after it
+ * down a slot. The node stays, even when it empties
+ *************************************************/
+template <typename T, size_t B, typename A>
+void unrolled_list <T, B, A> ::eraseAt(Node * pNode, size_t index)
+{
+   assert(index < pNode->num);
+   for (size_t i = index + 1; i < pNode->num; i++)
+      (*pNode)[i - 1] = std::move((*pNode)[i]);
+   (*pNode)[pNode->num - 1].~T();
+   pNode->num--;
+   numElements--;
+}
+
+/**************************************************
+ * UNROLLED LIST :: REBALANCE
+ * Keep a node at least half full: take every element of the
+ * next node if they fit, else borrow just its first
+ *************************************************/
+template <typename T, size_t B, typename A>
+void unrolled_list <T, B, A> ::rebalance(Node * pNode)
+{
+   Node * pNext = pNode->pNext;
+   if (pNode->num >= B / 2 || pNext == nullptr)
+      return;
+
+   if (pNode->num + pNext->num <= B)
+   {
+      for (size_t i = 0; i < pNext->num; i++)
+      {
+         ::new (static_cast<void*>(&(*pNode)[pNode->num])) T(std::move((*pNext)[i]));
+         (*pNext)[i].~T();
+         pNode->num++;
+      }
+      pNext->num = 0;
+      unlink(pNext);
+      destroyNode(pNext);
+   }
+   else
+   {
+      ::new (static_cast<void*>(&(*pNode)[pNode->num])) T(std::move((*pNext)[0]));
+      pNode->num++;
+      numElements++;    // eraseAt counts the one it removes
+      eraseAt(pNext, 0);
+   }
+}
+
+/**************************************************
+ * UNROLLED LIST :: CREATE NODE
+ * Allocate an empty node
+ *************************************************/
+template <typename T, size_t B, typename A>
+typename unrolled_list <T, B, A> ::Node * unrolled_list <T, B, A> ::createNode()
+{
+   Node * pNode = NodeTraits::allocate(alloc, 1);
+   ::new (static_cast<void*>(pNode)) Node;
+   return pNode;
+}
+
+/**************************************************
+ * UNROLLED LIST :: DESTROY NODE
+ * Give a node's memory back. Its elements are already gone
+ *************************************************/
+template <typename T, size_t B, typename A>
+void unrolled_list <T, B, A> ::destroyNode(Node * pNode) noexcept
+{
+   pNode->~Node();
+   NodeTraits::deallocate(alloc, pNode, 1);
+}
+
+/**************************************************
+ * UNROLLED LIST :: LINK AFTER
+ * Hang a new, empty node after pPrev, or at the front
+ * when pPrev is nullptr
+ *************************************************/
+template <typename T, size_t B, typename A>
+typename unrolled_list <T, B, A> ::Node * unrolled_list <T, B, A> ::linkAfter(Node * pPrev)
+{
+   Node * pNode = createNode();
+   Node * pNext = (pPrev ? pPrev->pNext : pHead);
+   pNode->pPrev = pPrev;
+   pNode->pNext = pNext;
+   if (pPrev)
+      pPrev->pNext = pNode;
+   else
+      pHead = pNode;
+   if (pNext)
+      pNext->pPrev = pNode;
+   else
+      pTail = pNode;
+   return pNode;
+}
+
+/**************************************************
+ * UNROLLED LIST :: UNLINK
+ * Take a node out of the chain without freeing it
+ *************************************************/
+template <typename T, size_t B, typename A>
+void unrolled_list <T, B, A> ::unlink(Node * pNode) noexcept
+{
+   if (pNode->pPrev)
+      pNode->pPrev->pNext = pNode->pNext;
+   else
+      pHead = pNode->pNext;
+   if (pNode->pNext)
+      pNode->pNext->pPrev = pNode->pPrev;
+   else
+      pTail = pNode->pPrev;
+}
+
+}; // namespace custom
@@ -148,20 +148,32 @@ void addRight(BNode <T>* pNode, T && t)
 
 /*****************************************************
  * DELETE BINARY TREE
- * Delete all the nodes below pThis including pThis
- * using postfix traverse: LRV
+ * Delete all the nodes below pThis including pThis.
+ * Rather than recurse, which runs out of stack on a
+ * degenerate tree, rotate each left child up into the
+ * root's place until the root has no left child, then
+ * delete the root and carry on with its right child.
+ *   COST   : O(n) time, O(1) extra memory
  ****************************************************/
 template <class T>
 void clear(BNode <T> * & pThis)
 {
-   if (pThis == nullptr)
+   while (pThis != nullptr)
    {
-      return;
+      if (pThis->pLeft != nullptr)
+      {
+         BNode <T>* pLeft = pThis->pLeft;
+         pThis->pLeft = pLeft->pRight;
+         pLeft->pRight = pThis;
+         pThis = pLeft;
+      }
+      else
+      {
+         BNode <T>* pRight = pThis->pRight;
+         delete pThis;
+         pThis = pRight;
+      }
    }
-   clear(pThis->pLeft);
-   clear(pThis->pRight);
-   delete pThis;
-   pThis = nullptr;
 }
 
 /***********************************************
@@ -180,7 +192,12 @@ inline void swap(BNode <T>*& pLHS, BNode <T>*& pRHS)
 /**********************************************
  * COPY BINARY TREE
  * Copy pSrc->pRight to pDest->pRight and
- * pSrc->pLeft onto pDest->pLeft
+ * pSrc->pLeft onto pDest->pLeft. Walk both trees in
+ * step without recursing: down to each missing child,
+ * up through the parent pointers once both are built.
+ * Every pParent under pSrc must be right: the climb
+ * asserts it rather than wander off into another tree.
+ *   COST   : O(n) time, O(1) extra memory
  *********************************************/
 template <class T>
 BNode <T> * copy(const BNode <T> * pSrc)
@@ -191,36 +208,80 @@ BNode <T> * copy(const BNode <T> * pSrc)
    }
 
    BNode <T>* pDest = new BNode <T>(pSrc->data);
-   pDest->pRight = copy(pSrc->pRight);
-   pDest->pLeft = copy(pSrc->pLeft);
-   if (pDest->pLeft)
+   const BNode <T>* pS = pSrc;
+   BNode <T>* pD = pDest;
+   try
    {
-      pDest->pLeft->pParent = pDest;
+      while (true)
+      {
+         if (pS->pLeft && !pD->pLeft)
+         {
+            addLeft(pD, pS->pLeft->data);
+            pS = pS->pLeft;
+            pD = pD->pLeft;
+         }
+         else if (pS->pRight && !pD->pRight)
+         {
+            addRight(pD, pS->pRight->data);
+            pS = pS->pRight;
+            pD = pD->pRight;
+         }
+         else if (pS == pSrc)
+         {
+            return pDest;
+         }
+         else
+         {
+            assert(pS->pParent != nullptr &&
+                   (pS->pParent->pLeft == pS || pS->pParent->pRight == pS));
+            assert(pD->pParent != nullptr);
+            pS = pS->pParent;
+            pD = pD->pParent;
+         }
+      }
    }
-
-   if (pDest->pRight)
+   catch (...)
    {
-      pDest->pRight->pParent = pDest;
+      clear(pDest);
+      throw;
    }
+}
 
-   return pDest;
+/**********************************************
+ * ASSIGN NODE
+ * Give pDest the value t under pParent, building
+ * the node if it is not already there
+ *********************************************/
+template <class T>
+inline void assignNode(BNode <T> * & pDest, const T & t, BNode <T> * pParent)
+{
+   if (pDest == nullptr)
+   {
+      pDest = new BNode<T>(t);
+   }
+   else
+   {
+      pDest->data = t;
+   }
+   pDest->pParent = pParent;
 }
 
 /**********************************************
  * assign
  * copy the values from pSrc onto pDest preserving
- * as many of the nodes as possible.
+ * as many of the nodes as possible. Like copy, this
+ * walks both trees in step instead of recursing:
+ * fill the left side, then the right side, then climb
+ * until we come up out of a left child. Like copy,
+ * every pParent under pSrc must be right.
+ *   COST   : O(n) time, O(1) extra memory
  *********************************************/
 template <class T>
 void assign(BNode <T> * & pDest, const BNode <T>* pSrc)
 {
    if (pSrc == nullptr)
    {
-      if (pDest != nullptr)
-      {
-         clear(pDest);
-         pDest = nullptr;
-      }
+      clear(pDest);
       return;
    }
 
@@ -233,21 +294,50 @@ void assign(BNode <T> * & pDest, const BNode <T>* pSrc)
       pDest->data = pSrc->data;
    }
 
-   if (pSrc->pLeft != nullptr || pDest->pLeft != nullptr)
+   const BNode <T>* pS = pSrc;
+   BNode <T>* pD = pDest;
+   bool leftDone = false;
+   while (true)
    {
-      assign(pDest->pLeft, pSrc->pLeft);
-      if (pDest->pLeft != nullptr)
+      // the left side first
+      if (!leftDone)
       {
-         pDest->pLeft->pParent = pDest;
+         if (pS->pLeft != nullptr)
+         {
+            assignNode(pD->pLeft, pS->pLeft->data, pD);
+            pS = pS->pLeft;
+            pD = pD->pLeft;
+            continue;
+         }
+         clear(pD->pLeft);
       }
-   }
 
-   if (pSrc->pRight != nullptr || pDest->pRight != nullptr)
-   {
-      assign(pDest->pRight, pSrc->pRight);
-      if (pDest->pRight != nullptr)
+      // then the right side
+      if (pS->pRight != nullptr)
+      {
+         assignNode(pD->pRight, pS->pRight->data, pD);
+         pS = pS->pRight;
+         pD = pD->pRight;
+         leftDone = false;
+         continue;
+      }
+      clear(pD->pRight);
+
+      // both done: climb past every node whose right side is done
+      bool fromLeft = false;
+      while (!fromLeft)
       {
-         pDest->pRight->pParent = pDest;
+         if (pS == pSrc)
+         {
+            return;
+         }
+         assert(pS->pParent != nullptr &&
+                (pS->pParent->pLeft == pS || pS->pParent->pRight == pS));
+         assert(pD->pParent != nullptr);
+         fromLeft = (pS->pParent->pLeft == pS);
+         pS = pS->pParent;
+         pD = pD->pParent;
       }
+      leftDone = true;
    }
 }
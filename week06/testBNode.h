@@ -34,6 +34,7 @@ public:
       test_copy_nullptr();
       test_copy_one();
       test_copy_standard();
+      test_copy_degenerate();
 
       // Assign
       test_assign_emptyToEmpty();
@@ -42,6 +43,8 @@ public:
       test_assign_oneToStandard();
       test_assign_standardToOne();
       test_assign_standardToStandard();
+      test_assign_degenerateToStandard();
+      test_assign_standardToDegenerate();
       test_swap_emptyEmpty();
       test_swap_emptyStandard();
       test_swap_standardEmpty();
@@ -65,6 +68,8 @@ public:
       test_clear_empty();
       test_clear_one();
       test_clear_standard();
+      test_clear_degenerateLeft();
+      test_clear_degenerateRight();
 
       // Status
       test_size_empty();
@@ -216,6 +221,25 @@ public:
       teardownStandardFixture(pDest);
    }
 
+   // copy a tree too deep to copy recursively
+   void test_copy_degenerate()
+   {  // setup
+      //    (0)
+      //      +-(1)
+      //          +-(2) ...
+      BNode <int>* pSrc = setupDegenerateFixture(NUM_DEGENERATE, false);
+      BNode <int>* pDest = nullptr;
+      // exercise
+      pDest = copy(pSrc);
+      // verify
+      assertUnit(pSrc != pDest);
+      assertUnit(isDegenerateFixture(pSrc, NUM_DEGENERATE, false));
+      assertUnit(isDegenerateFixture(pDest, NUM_DEGENERATE, false));
+      // teardown
+      clear(pSrc);
+      clear(pDest);
+   }
+
    /***************************************
     * Assignment
     *    void assign(BNode <T> * & pDest, const BNode <T>* pSrc)
@@ -387,6 +411,54 @@ public:
      teardownStandardFixture(pDest);
    }
 
+   // assignment operator : standard = degenerate
+   void test_assign_degenerateToStandard()
+   {  // setup
+      //    (0)
+      //      +-(1)
+      //          +-(2) ...
+      BNode <int>* pSrc = setupDegenerateFixture(NUM_DEGENERATE, false);
+      //                      (50) = pDest
+      //            +----------+----------+
+      //           (38)                  (73)
+      //       +----+----+           +----+----+
+      //      (26)      (49)        (64)      (85)
+      BNode <int>* pDest = setupStandardFixture();
+      BNode <int>* pRoot = pDest;
+      // exercise
+      assign(pDest, pSrc);
+      // verify
+      assertUnit(pDest == pRoot);
+      assertUnit(isDegenerateFixture(pSrc, NUM_DEGENERATE, false));
+      assertUnit(isDegenerateFixture(pDest, NUM_DEGENERATE, false));
+      // teardown
+      clear(pSrc);
+      clear(pDest);
+   }
+
+   // assignment operator : degenerate = standard
+   void test_assign_standardToDegenerate()
+   {  // setup
+      //                      (50) = pSrc
+      //            +----------+----------+
+      //           (38)                  (73)
+      //       +----+----+           +----+----+
+      //      (26)      (49)        (64)      (85)
+      BNode <int>* pSrc = setupStandardFixture();
+      //                ... (2)-+
+      //                  (1)-+
+      //                    (0) = pDest
+      BNode <int>* pDest = setupDegenerateFixture(NUM_DEGENERATE, true);
+      // exercise
+      assign(pDest, pSrc);
+      // verify
+      assertStandardFixture(pSrc);
+      assertStandardFixture(pDest);
+      // teardown
+      teardownStandardFixture(pSrc);
+      teardownStandardFixture(pDest);
+   }
+
    /***************************************
     * SWAP
     ***************************************/
@@ -1194,6 +1266,32 @@ public:
       assertUnit(p == nullptr);
    }  // teardown
 
+   // delete a tree that leans all the way left
+   void test_clear_degenerateLeft()
+   {  // setup
+      //                ... (2)-+
+      //                  (1)-+
+      //                    (0) = p
+      BNode <int>* p = setupDegenerateFixture(NUM_DEGENERATE, true);
+      // exercise
+      clear(p);
+      // verify
+      assertUnit(p == nullptr);
+   }  // teardown
+
+   // delete a tree that leans all the way right
+   void test_clear_degenerateRight()
+   {  // setup
+      //    (0) = p
+      //      +-(1)
+      //          +-(2) ...
+      BNode <int>* p = setupDegenerateFixture(NUM_DEGENERATE, false);
+      // exercise
+      clear(p);
+      // verify
+      assertUnit(p == nullptr);
+   }  // teardown
+
    // delete a standard fixture
    void test_clear_standard()
    {  // setup
@@ -1211,6 +1309,51 @@ public:
 
 
 
+   /*************************************************************
+    * SETUP DEGENERATE FIXTURE
+    * A chain of num nodes holding 0, 1, 2, ... with each node
+    * hanging off the left (or right) of the one before, like
+    * inserting sorted values with no balancing. A million
+    * levels is far more than a recursive walk can survive.
+    *************************************************************/
+   enum { NUM_DEGENERATE = 1000000 };
+
+   BNode <int>* setupDegenerateFixture(int num, bool toLeft)
+   {
+      BNode <int>* pRoot = new BNode <int>(int(0));
+      BNode <int>* p = pRoot;
+      for (int i = 1; i < num; i++)
+      {
+         if (toLeft)
+         {
+            addLeft(p, i);
+            p = p->pLeft;
+         }
+         else
+         {
+            addRight(p, i);
+            p = p->pRight;
+         }
+      }
+      return pRoot;
+   }
+
+   // is this the chain setupDegenerateFixture() built?
+   bool isDegenerateFixture(const BNode <int>* pRoot, int num, bool toLeft)
+   {
+      const BNode <int>* pParent = nullptr;
+      const BNode <int>* p = pRoot;
+      for (int i = 0; i < num; i++)
+      {
+         if (p == nullptr || p->data != i || p->pParent != pParent ||
+             (toLeft ? p->pRight : p->pLeft) != nullptr)
+            return false;
+         pParent = p;
+         p = (toLeft ? p->pLeft : p->pRight);
+      }
+      return p == nullptr;
+   }
+
    /*************************************************************
     * SETUP STANDARD FIXTURE
     *                   (50)
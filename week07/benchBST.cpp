@@ -0,0 +1,87 @@
+/***********************************************************************
+ * Source:
+ *    Bench BST
+ * Summary:
+ *    Time a deep copy of a big BST, one thread against many. The
+ *    tree is copied with copyParallel forking 0, 1, 2, ... levels
+ *    down, so 1, 2, 4, ... threads share the work, up to the
+ *    number of hardware threads and at least eight. The report is
+ *    nanoseconds per node copied. Build the BenchBST project in
+ *    Release, or:
+ *       g++ -O2 -std=c++14 -pthread benchBST.cpp
+ * Author
+ *    Noah Li, Steven Sellers, Josh Hamilton.
+ ************************************************************************/
+
+#include "bst.h"      // for BST
+
+#include <chrono>     // for steady_clock
+#include <cstddef>    // for size_t
+#include <iomanip>    // for setw and setprecision
+#include <iostream>   // for cout
+#include <thread>     // for hardware_concurrency
+
+const size_t NUM_ELEMENTS = 2000000;   // nodes in the tree
+const int    NUM_PASSES   = 3;         // copies at each fork depth
+
+/**********************************************************************
+ * VALUE AT
+ * The i'th value. A fixed scramble of 0 .. NUM_ELEMENTS-1, so the
+ * nodes are not laid out in tree order
+ ***********************************************************************/
+int valueAt(size_t i)
+{
+   return int((i * 7919) % NUM_ELEMENTS);
+}
+
+/**********************************************************************
+ * BENCH BST
+ * A friend of BST, so it can choose how deep copyParallel forks
+ ***********************************************************************/
+class BenchBST
+{
+public:
+   // copy bst NUM_PASSES times, forking depthFork levels down.
+   // Only the copy is timed, not tearing it down again
+   static void timeCopy(const custom::BST<int> & bst, int depthFork)
+   {
+      long long sum = 0;
+      std::chrono::steady_clock::duration elapsed{};
+      for (int pass = 0; pass < NUM_PASSES; pass++)
+      {
+         custom::BST<int> copy;
+         auto start = std::chrono::steady_clock::now();
+         copy.root = copy.copyParallel(bst.root, depthFork);
+         elapsed += std::chrono::steady_clock::now() - start;
+         copy.numElements = bst.numElements;
+         sum += copy.root->data;
+      }
+
+      double ns = std::chrono::duration<double, std::nano>(elapsed).count();
+      std::cout << std::right << std::setw(3) << (1 << depthFork) << " threads"
+                << std::setw(10) << std::fixed << std::setprecision(2)
+                << ns / (double(NUM_ELEMENTS) * NUM_PASSES) << " ns/node"
+                << "   (sum " << sum << ")\n";
+   }
+};
+
+/**********************************************************************
+ * MAIN
+ * Build the tree once, then copy it at every fork depth
+ ***********************************************************************/
+int main()
+{
+   unsigned int maxThreads = std::thread::hardware_concurrency();
+   if (maxThreads < 8)
+      maxThreads = 8;
+
+   custom::BST<int> bst;
+   for (size_t i = 0; i < NUM_ELEMENTS; i++)
+      bst.insert(valueAt(i));
+
+   std::cout << NUM_ELEMENTS << " nodes, " << NUM_PASSES << " passes\n";
+   for (int depthFork = 0; (1u << depthFork) <= maxThreads; depthFork++)
+      BenchBST::timeCopy(bst, depthFork);
+
+   return 0;
+}
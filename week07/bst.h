@@ -28,7 +28,9 @@
 #endif // !DEBUG
 
 #include <cassert>
-#include <utility>
+#include <future>     // for std::async
+#include <system_error> // for std::system_error
+#include <thread>     // for std::thread::hardware_concurrency
 #include <memory>     // for std::allocator
 #include <functional> // for std::less
 #include <utility>    // for std::pair
@@ -36,6 +38,7 @@
 class TestBST; // forward declaration for unit tests
 class TestMap;
 class TestSet;
+class BenchBST; // forward declaration for the copy benchmark
 
 namespace custom
 {
@@ -55,6 +58,7 @@ namespace custom
         friend class ::TestBST; // give unit tests access to the privates
         friend class ::TestMap;
         friend class ::TestSet;
+        friend class ::BenchBST; // and the benchmark, to pick the fork depth
 
         template <class KK, class VV>
         friend class map;
@@ -130,6 +134,18 @@ namespace custom
         void deleteNode(BNode*& pDelete, bool toRight);
         void deleteBinaryTree(BNode*& pDelete) noexcept;
         void copyBinaryTree(const BNode* pSrc, BNode*& pDest);
+        BNode* copyParallel(const BNode* pSrc, int depthFork);
+        static int findDepthFork();
+        static const size_t numParallelCopy = 1 << 15; // smallest tree worth copying on threads
+
+        // red-black balancing after an erase
+        void balanceErase(BNode* pNode, BNode* pParent);
+        static bool isBlack(const BNode* pNode) { return pNode == nullptr || !pNode->isRed; }
+
+#ifdef DEBUG
+        // red-black validation for the unit tests
+        bool verifyRedBlack() const;
+#endif // DEBUG
     };
 
 
@@ -145,9 +161,9 @@ namespace custom
         //
         // Construct
         //
-        BNode() : pLeft(nullptr), pRight(nullptr), pParent(nullptr), data() {} // from bnode
-        BNode(const T& t) : pLeft(nullptr), pRight(nullptr), pParent(nullptr), data(t) {}
-        BNode(T&& t) : pLeft(nullptr), pRight(nullptr), pParent(nullptr), data(std::move(t)) {}
+        BNode() : data(), pLeft(nullptr), pRight(nullptr), pParent(nullptr), isRed(true) {} // from bnode
+        BNode(const T& t) : data(t), pLeft(nullptr), pRight(nullptr), pParent(nullptr), isRed(true) {}
+        BNode(T&& t) : data(std::move(t)), pLeft(nullptr), pRight(nullptr), pParent(nullptr), isRed(true) {}
 
         //
         // Insert
@@ -165,6 +181,23 @@ namespace custom
         bool isRightChild(BNode* pNode) const { return pRight == pNode; } // Check if a node is the right child of its parent
         bool isLeftChild(BNode* pNode) const { return pLeft == pNode; } // Check if a node is the left child of its parent
 
+        //
+        // Balance
+        //
+        void balance();          // red-black fixup after this node was inserted
+        void rotateLeft();       // our right child takes our place
+        void rotateRight();      // our left child takes our place
+
+#ifdef DEBUG
+        //
+        // Verify
+        //
+        int    findHeight() const;
+        int    findBlackDepth() const;
+        bool   verifyRedBlack(int depth) const;
+        size_t computeSize() const;
+#endif // DEBUG
+
         //
         // Data
         //
@@ -242,6 +275,9 @@ namespace custom
         // must give friend status to remove so it can call getNode() from it
         friend BST <T> ::iterator BST <T> ::erase(iterator& it);
 
+        // insert needs the new node to balance the tree from there
+        friend class BST <T>;
+
     private:
 
         // the node
@@ -335,8 +371,12 @@ namespace custom
     template <typename T>
     BST <T>& BST <T> :: operator = (const BST <T>& rhs)
     {
-        // Copy the binary tree from rhs to this tree
-        copyBinaryTree(rhs.root, this->root);
+        // Copy the binary tree from rhs to this tree. A big tree going
+        // into an empty one has no nodes to reuse, so copy it on threads
+        if (nullptr == this->root && rhs.numElements >= numParallelCopy)
+            this->root = copyParallel(rhs.root, findDepthFork());
+        else
+            copyBinaryTree(rhs.root, this->root);
         // Ensure the root's parent is null (root nodes should not have parents)
         assert(nullptr == this->root || this->root->pParent == nullptr);
         // Copy the number of elements
@@ -409,6 +449,7 @@ namespace custom
             {
                 assert(numElements == 0); // Ensure tree is indeed empty
                 root = new BNode(t); // Create the root node
+                root->isRed = false; // The root is always black
                 numElements = 1; // Increment number of elements
                 pairReturn.first = iterator(root); // Set the iterator to the root
                 pairReturn.second = true; // Indicate that the insertion was successful
@@ -462,6 +503,9 @@ namespace custom
             assert(root != nullptr); // Ensure root is not lost
             numElements++; // Increment the element count
 
+            // Restore the red-black properties, possibly rotating the root away
+            pairReturn.first.pNode->balance();
+
             // If we lost the root, find it
             while (root->pParent != nullptr)
                 root = root->pParent;
@@ -485,6 +529,7 @@ namespace custom
             {
                 assert(numElements == 0); // Ensure tree is indeed empty
                 root = new BNode(std::move(t)); // Create the root node with moved value
+                root->isRed = false; // The root is always black
                 numElements = 1; // Increment number of elements
                 pairReturn.first = iterator(root); // Set the iterator to the root
                 pairReturn.second = true; // Indicate that the insertion was successful
@@ -538,6 +583,9 @@ namespace custom
             assert(root != nullptr); // Ensure root is not lost
             numElements++; // Increment the element count
 
+            // Restore the red-black properties, possibly rotating the root away
+            pairReturn.first.pNode->balance();
+
             // If we lost the root, find it
             while (root->pParent != nullptr)
                 root = root->pParent;
@@ -565,10 +613,17 @@ namespace custom
         iterator itNext = it; // Iterator to return the next node
         BNode* pDelete = it.pNode; // Node to delete
 
+        // Red-black bookkeeping: the color taken out of the tree, the node
+        // that moved into its place (possibly nullptr), and that spot's parent
+        bool removedRed = pDelete->isRed;
+        BNode* pFix = nullptr;
+        BNode* pFixParent = pDelete->pParent;
+
         // Case 1: Node has no left child
         if (pDelete->pLeft == nullptr)
         {
             itNext++; // Move to next node
+            pFix = pDelete->pRight;
             if (pDelete->pParent)
             {
                 // Reattach the parent's pointer to the right child
@@ -600,6 +655,7 @@ namespace custom
         else if (pDelete->pRight == nullptr)
         {
             itNext++; // Move to next node
+            pFix = pDelete->pLeft;
             if (pDelete->pParent)
             {
                 // Reattach the parent's pointer to the left child
@@ -636,6 +692,12 @@ namespace custom
                 pIOS = pIOS->pLeft;
             }
 
+            // The successor leaves its old spot and inherits our color
+            removedRed = pIOS->isRed;
+            pIOS->isRed = pDelete->isRed;
+            pFix = pIOS->pRight;
+            pFixParent = (pIOS->pParent == pDelete ? pIOS : pIOS->pParent);
+
             if (pIOS->pParent != pDelete)
             {
                 // Reattach the in-order successor's parent to its right child
@@ -685,6 +747,10 @@ namespace custom
         delete pDelete; // Delete the node
         numElements--; // Decrement the number of elements
 
+        // Removing a black node shortens one path; restore the black depth
+        if (!removedRed)
+            balanceErase(pFix, pFixParent);
+
         return itNext; // Return the iterator to the next node
     }
 
@@ -742,6 +808,131 @@ namespace custom
 
     }
 
+    /*****************************************************
+     * BST :: BALANCE ERASE
+     * A black node was removed from above pNode (which may be nullptr)
+     * so every path through pNode is one black node short. Push the
+     * shortage up the tree or fix it with a rotation.
+     ****************************************************/
+    template <typename T>
+    void BST <T> ::balanceErase(BNode* pNode, BNode* pParent)
+    {
+        while (pNode != root && isBlack(pNode))
+        {
+            assert(pParent != nullptr);
+            if (pParent->pLeft == pNode)
+            {
+                BNode* pSibling = pParent->pRight;
+                assert(pSibling != nullptr);
+
+                // Case 1: red sibling. Rotate so our sibling is black
+                if (pSibling->isRed)
+                {
+                    pSibling->isRed = false;
+                    pParent->isRed = true;
+                    pParent->rotateLeft();
+                    if (root == pParent)
+                        root = pSibling;
+                    pSibling = pParent->pRight;
+                }
+
+                // Case 2: black sibling with black children. Recolor and move up
+                if (isBlack(pSibling->pLeft) && isBlack(pSibling->pRight))
+                {
+                    pSibling->isRed = true;
+                    pNode = pParent;
+                    pParent = pNode->pParent;
+                }
+                else
+                {
+                    // Case 3: the sibling's far child is black. Turn it into case 4
+                    if (isBlack(pSibling->pRight))
+                    {
+                        pSibling->pLeft->isRed = false;
+                        pSibling->isRed = true;
+                        pSibling->rotateRight();
+                        pSibling = pParent->pRight;
+                    }
+
+                    // Case 4: the sibling's far child is red. One rotation finishes
+                    pSibling->isRed = pParent->isRed;
+                    pParent->isRed = false;
+                    pSibling->pRight->isRed = false;
+                    pParent->rotateLeft();
+                    if (root == pParent)
+                        root = pSibling;
+                    pNode = root;
+                }
+            }
+            else
+            {
+                BNode* pSibling = pParent->pLeft;
+                assert(pSibling != nullptr);
+
+                // Case 1: red sibling. Rotate so our sibling is black
+                if (pSibling->isRed)
+                {
+                    pSibling->isRed = false;
+                    pParent->isRed = true;
+                    pParent->rotateRight();
+                    if (root == pParent)
+                        root = pSibling;
+                    pSibling = pParent->pLeft;
+                }
+
+                // Case 2: black sibling with black children. Recolor and move up
+                if (isBlack(pSibling->pLeft) && isBlack(pSibling->pRight))
+                {
+                    pSibling->isRed = true;
+                    pNode = pParent;
+                    pParent = pNode->pParent;
+                }
+                else
+                {
+                    // Case 3: the sibling's far child is black. Turn it into case 4
+                    if (isBlack(pSibling->pLeft))
+                    {
+                        pSibling->pRight->isRed = false;
+                        pSibling->isRed = true;
+                        pSibling->rotateLeft();
+                        pSibling = pParent->pLeft;
+                    }
+
+                    // Case 4: the sibling's far child is red. One rotation finishes
+                    pSibling->isRed = pParent->isRed;
+                    pParent->isRed = false;
+                    pSibling->pLeft->isRed = false;
+                    pParent->rotateRight();
+                    if (root == pParent)
+                        root = pSibling;
+                    pNode = root;
+                }
+            }
+        }
+
+        if (pNode)
+            pNode->isRed = false;
+    }
+
+#ifdef DEBUG
+    /*****************************************************
+     * BST :: VERIFY RED BLACK
+     * The root is black, no red node has a red child, every path
+     * has the same number of black nodes, and the size is right
+     ****************************************************/
+    template <typename T>
+    bool BST <T> ::verifyRedBlack() const
+    {
+        if (root == nullptr)
+            return numElements == 0;
+
+        return !root->isRed &&
+               root->pParent == nullptr &&
+               root->verifyRedBlack(root->findBlackDepth()) &&
+               root->computeSize() == numElements;
+    }
+#endif // DEBUG
+
     /******************************************************
      ******************************************************
      ******************************************************
@@ -857,25 +1048,214 @@ namespace custom
 
 
 
+    /******************************************************
+     * BINARY NODE :: BALANCE
+     * This node was just inserted red. Fix any red-red violation
+     * with the parent by recoloring or rotating.
+     ******************************************************/
+    template <typename T>
+    void BST <T> ::BNode::balance()
+    {
+        // Case 1: we are the root. Color ourselves black and call it a day
+        if (pParent == nullptr)
+        {
+            isRed = false;
+            return;
+        }
+
+        // Case 2: our parent is black. Nothing to do
+        if (!pParent->isRed)
+            return;
+
+        // A red parent without a parent of its own is a red root
+        BNode* pGranny = pParent->pParent;
+        if (pGranny == nullptr)
+        {
+            pParent->isRed = false;
+            return;
+        }
+        BNode* pAunt = (pGranny->isLeftChild(pParent) ? pGranny->pRight : pGranny->pLeft);
+
+        // Case 3: parent and aunt are red. Push the red up to granny
+        if (pAunt != nullptr && pAunt->isRed)
+        {
+            pParent->isRed = false;
+            pAunt->isRed = false;
+            pGranny->isRed = true;
+            pGranny->balance();
+            return;
+        }
+
+        // Case 4: black aunt. An inner grandchild is first rotated outside...
+        BNode* pNode = this;
+        if (pGranny->isLeftChild(pParent) && pParent->isRightChild(this))
+        {
+            pParent->rotateLeft();
+            pNode = pLeft;
+        }
+        else if (pGranny->isRightChild(pParent) && pParent->isLeftChild(this))
+        {
+            pParent->rotateRight();
+            pNode = pRight;
+        }
+
+        // ...then granny rotates down under the parent and they swap colors
+        BNode* pTop = pNode->pParent;
+        if (pGranny->isLeftChild(pTop))
+            pGranny->rotateRight();
+        else
+            pGranny->rotateLeft();
+        pTop->isRed = false;
+        pGranny->isRed = true;
+    }
+
+    /******************************************************
+     * BINARY NODE :: ROTATE LEFT
+     * Our right child takes our place and we become its left child
+     ******************************************************/
+    template <typename T>
+    void BST <T> ::BNode::rotateLeft()
+    {
+        BNode* pPivot = pRight;
+        assert(pPivot != nullptr);
+
+        // Our parent adopts the pivot in our place
+        if (pParent)
+        {
+            if (pParent->isLeftChild(this))
+                pParent->pLeft = pPivot;
+            else
+                pParent->pRight = pPivot;
+        }
+        pPivot->pParent = pParent;
+
+        // The pivot's left subtree moves over to us
+        addRight(pPivot->pLeft);
+        pPivot->addLeft(this);
+    }
+
+    /******************************************************
+     * BINARY NODE :: ROTATE RIGHT
+     * Our left child takes our place and we become its right child
+     ******************************************************/
+    template <typename T>
+    void BST <T> ::BNode::rotateRight()
+    {
+        BNode* pPivot = pLeft;
+        assert(pPivot != nullptr);
+
+        // Our parent adopts the pivot in our place
+        if (pParent)
+        {
+            if (pParent->isLeftChild(this))
+                pParent->pLeft = pPivot;
+            else
+                pParent->pRight = pPivot;
+        }
+        pPivot->pParent = pParent;
+
+        // The pivot's right subtree moves over to us
+        addLeft(pPivot->pRight);
+        pPivot->addRight(this);
+    }
+
+#ifdef DEBUG
+    /******************************************************
+     * BINARY NODE :: FIND HEIGHT
+     * The number of nodes on the longest path down from here
+     ******************************************************/
+    template <typename T>
+    int BST <T> ::BNode::findHeight() const
+    {
+        int heightLeft = (pLeft ? pLeft->findHeight() : 0);
+        int heightRight = (pRight ? pRight->findHeight() : 0);
+        return 1 + (heightLeft > heightRight ? heightLeft : heightRight);
+    }
+
+    /******************************************************
+     * BINARY NODE :: FIND BLACK DEPTH
+     * The number of black nodes down the left-most path
+     ******************************************************/
+    template <typename T>
+    int BST <T> ::BNode::findBlackDepth() const
+    {
+        int depth = 0;
+        for (const BNode* p = this; p; p = p->pLeft)
+            if (!p->isRed)
+                depth++;
+        return depth;
+    }
+
+    /******************************************************
+     * BINARY NODE :: VERIFY RED BLACK
+     * Every path below must have depth black nodes, no red node may
+     * have a red child, and the parent pointers must be consistent
+     ******************************************************/
+    template <typename T>
+    bool BST <T> ::BNode::verifyRedBlack(int depth) const
+    {
+        if (!isRed)
+            depth--;
+
+        // Red nodes cannot have red children
+        if (isRed && ((pLeft && pLeft->isRed) || (pRight && pRight->isRed)))
+            return false;
+
+        // The children must point back to us
+        if ((pLeft && pLeft->pParent != this) || (pRight && pRight->pParent != this))
+            return false;
+
+        // A missing child ends a path: all black nodes must be used up
+        if ((!pLeft || !pRight) && depth != 0)
+            return false;
+
+        return (!pLeft  || pLeft->verifyRedBlack(depth)) &&
+               (!pRight || pRight->verifyRedBlack(depth));
+    }
+
+    /******************************************************
+     * BINARY NODE :: COMPUTE SIZE
+     * The number of nodes in this subtree
+     ******************************************************/
+    template <typename T>
+    size_t BST <T> ::BNode::computeSize() const
+    {
+        return 1 + (pLeft ? pLeft->computeSize() : 0) + (pRight ? pRight->computeSize() : 0);
+    }
+#endif // DEBUG
+
     /**************************************************
        * BST node :: deletebinary tree
-       *
+       * Rotate each left child up into pDelete's place until
+       * it has none, then delete pDelete and go right. No
+       * recursion and no extra memory, however tall the tree.
        *************************************************/
     template <typename T>
     void BST <T> ::deleteBinaryTree(BNode*& pDelete) noexcept
     {
-        if (pDelete == nullptr)
-            return;
-        deleteBinaryTree(pDelete->pLeft);
-        deleteBinaryTree(pDelete->pRight);
-
-        delete pDelete;
-        pDelete = nullptr;
+        while (pDelete != nullptr)
+        {
+            if (pDelete->pLeft != nullptr)
+            {
+                BNode* pLeft = pDelete->pLeft;
+                pDelete->pLeft = pLeft->pRight;
+                pLeft->pRight = pDelete;
+                pDelete = pLeft;
+            }
+            else
+            {
+                BNode* pDead = pDelete;
+                pDelete = pDelete->pRight;
+                delete pDead;
+            }
+        }
     }
 
     /**************************************************
      * BST node :: copy binary tree
-     *
+     * Walk pSrc and pDest in step, reusing the nodes pDest
+     * already has. Down the left side, then the right, then
+     * up the parent pointers until we leave a left child.
      *************************************************/
     template <typename T>
     void BST <T> ::copyBinaryTree(const BNode* pSrc, BNode*& pDest)
@@ -886,28 +1266,172 @@ namespace custom
             return;
         }
 
-        assert(pSrc);
         try
         {
             if (nullptr == pDest)
                 pDest = new BST::BNode(pSrc->data);
-
             else
                 pDest->data = pSrc->data;
+            pDest->isRed = pSrc->isRed;
+
+            const BNode* pS = pSrc;
+            BNode* pD = pDest;
+            bool leftDone = false;
+            while (true)
+            {
+                // the left side first
+                if (!leftDone)
+                {
+                    if (pS->pLeft)
+                    {
+                        if (nullptr == pD->pLeft)
+                            pD->addLeft(new BST::BNode(pS->pLeft->data));
+                        else
+                        {
+                            pD->pLeft->data = pS->pLeft->data;
+                            pD->pLeft->pParent = pD;
+                        }
+                        pD->pLeft->isRed = pS->pLeft->isRed;
+                        pS = pS->pLeft;
+                        pD = pD->pLeft;
+                        continue;
+                    }
+                    deleteBinaryTree(pD->pLeft);
+                }
+
+                // then the right side
+                if (pS->pRight)
+                {
+                    if (nullptr == pD->pRight)
+                        pD->addRight(new BST::BNode(pS->pRight->data));
+                    else
+                    {
+                        pD->pRight->data = pS->pRight->data;
+                        pD->pRight->pParent = pD;
+                    }
+                    pD->pRight->isRed = pS->pRight->isRed;
+                    pS = pS->pRight;
+                    pD = pD->pRight;
+                    leftDone = false;
+                    continue;
+                }
+                deleteBinaryTree(pD->pRight);
+
+                // both done: climb past every node whose right side is done
+                bool fromLeft = false;
+                while (!fromLeft)
+                {
+                    if (pS == pSrc)
+                        return;
+                    fromLeft = (pS->pParent->pLeft == pS);
+                    pS = pS->pParent;
+                    pD = pD->pParent;
+                }
+                leftDone = true;
+            }
         }
         catch (...)
         {
             throw "ERROR: Unable to allocate a node";
         }
-        assert(pDest != nullptr);
+    }
+
+    /**************************************************
+     * BST node :: copy parallel
+     * Copy pSrc into a new tree. Above depthFork levels the left
+     * subtree goes to another thread while this one does the
+     * right; below that each thread runs copyBinaryTree. The
+     * red-black tree keeps the pieces within a factor of two
+     *************************************************/
+    template <typename T>
+    typename BST <T> ::BNode* BST <T> ::copyParallel(const BNode* pSrc, int depthFork)
+    {
+        BNode* pDest = nullptr;
+        if (depthFork <= 0 || nullptr == pSrc)
+        {
+            // copyBinaryTree leaves what it built in pDest when it throws
+            try
+            {
+                copyBinaryTree(pSrc, pDest);
+            }
+            catch (...)
+            {
+                deleteBinaryTree(pDest);
+                throw;
+            }
+            return pDest;
+        }
+
+        try
+        {
+            pDest = new BST::BNode(pSrc->data);
+        }
+        catch (...)
+        {
+            throw "ERROR: Unable to allocate a node";
+        }
+        pDest->isRed = pSrc->isRed;
+
+        // no thread to spare? Then the left side waits for get()
+        auto copyLeft = [this, pSrc, depthFork]() { return copyParallel(pSrc->pLeft, depthFork - 1); };
+        std::future<BNode*> futureLeft;
+        try
+        {
+            futureLeft = std::async(std::launch::async, copyLeft);
+        }
+        catch (const std::system_error&)
+        {
+            futureLeft = std::async(std::launch::deferred, copyLeft);
+        }
 
-        copyBinaryTree(pSrc->pLeft, pDest->pLeft);
-        if (pSrc->pLeft)
-            pDest->pLeft->pParent = pDest;
+        BNode* pLeft = nullptr;
+        BNode* pRight = nullptr;
+        try
+        {
+            pRight = copyParallel(pSrc->pRight, depthFork - 1);
+        }
+        catch (...)
+        {
+            try
+            {
+                pLeft = futureLeft.get();
+            }
+            catch (...)
+            {
+            }
+            deleteBinaryTree(pLeft);
+            delete pDest;
+            throw;
+        }
 
-        copyBinaryTree(pSrc->pRight, pDest->pRight);
-        if (pSrc->pRight)
-            pDest->pRight->pParent = pDest;
+        try
+        {
+            pLeft = futureLeft.get();
+        }
+        catch (...)
+        {
+            deleteBinaryTree(pRight);
+            delete pDest;
+            throw;
+        }
+
+        pDest->addLeft(pLeft);
+        pDest->addRight(pRight);
+        return pDest;
+    }
+
+    /**************************************************
+     * BST node :: find depth fork
+     * Fork until there is a subtree for every core
+     *************************************************/
+    template <typename T>
+    int BST <T> ::findDepthFork()
+    {
+        unsigned int numCores = std::thread::hardware_concurrency();
+        int depth = 0;
+        while ((1u << depth) < numCores && depth < 6)
+            depth++;
+        return depth;
     }
 
     /**************************************************
@@ -20,6 +20,7 @@
 #include <iostream>
 #include <string>
 #include <functional> // for std::less and std::greater
+#include <atomic>     // for std::atomic
 
  /***********************************************
   * TEST BST
@@ -38,6 +39,9 @@ public:
       test_constructCopy_empty();
       test_constructCopy_one();
       test_constructCopy_standard();
+      test_constructCopy_parallel();
+      test_copyParallel_deep();
+      test_copyParallel_throw();
       test_constructMove_empty();
       test_constructMove_one();
       test_constructMove_standard();
@@ -53,6 +57,7 @@ public:
       test_assign_oneToStandard();
       test_assign_standardToOne();
       test_assign_standardToStandard();
+      test_assign_degenerateToOne();
       test_assignMove_emptyToEmpty();
       test_assignMove_standardToEmpty();
       test_assignMove_emptyToStandard();
@@ -109,6 +114,12 @@ public:
       test_erase_twoChildrenSpecial();
       test_clear_empty();
       test_clear_standard();
+      test_clear_degenerate();
+
+      // Balance
+      test_balance_insertSorted();
+      test_balance_insertInnerGrandchild();
+      test_balance_erase();
 
       // Status
       test_empty_empty();
@@ -2868,6 +2879,265 @@ public:
    }
 
 
+   /***************************************
+    * PARALLEL COPY
+    *    BST::copyParallel forks subtrees
+    *    onto other threads
+    ***************************************/
+
+   // a big copy goes through copyParallel and keeps every link and color
+   void test_constructCopy_parallel()
+   {  // setup
+      custom::BST <int> bstSrc;
+      for (int i = 0; i < NUM_PARALLEL; i++)
+         bstSrc.insert((i * 7919) % NUM_PARALLEL);
+      // exercise
+      custom::BST <int> bstDest(bstSrc);
+      // verify
+      assertUnit(bstDest.root != bstSrc.root);
+      assertUnit(bstDest.numElements == NUM_PARALLEL);
+      assertUnit(bstDest.verifyRedBlack());
+      assertUnit(isSameTree(bstSrc.root, bstDest.root, nullptr));
+   }  // teardown
+
+   // forking past the bottom of the tree stops at the leaves
+   void test_copyParallel_deep()
+   {  // setup
+      custom::BST <int> bstSrc;
+      for (int i = 0; i < 100; i++)
+         bstSrc.insert(i);
+      custom::BST <int> bstDest;
+      // exercise
+      bstDest.root = bstDest.copyParallel(bstSrc.root, 10);
+      bstDest.numElements = bstSrc.numElements;
+      // verify
+      assertUnit(bstDest.root != bstSrc.root);
+      assertUnit(bstDest.verifyRedBlack());
+      assertUnit(isSameTree(bstSrc.root, bstDest.root, nullptr));
+   }  // teardown
+
+   // a copy that throws partway through a thread's subtree frees it all
+   void test_copyParallel_throw()
+   {  // setup
+      custom::BST <ThrowOnCopy> bstSrc;
+      for (int i = 0; i < 100; i++)
+         bstSrc.insert(ThrowOnCopy(i));
+      custom::BST <ThrowOnCopy> bstDest;
+      ThrowOnCopy::copiesLeft() = 50;
+      bool thrown = false;
+      // exercise
+      try
+      {
+         bstDest.root = bstDest.copyParallel(bstSrc.root, 1);
+      }
+      catch (...)
+      {
+         thrown = true;
+      }
+      // verify
+      assertUnit(thrown);
+      assertUnit(bstDest.root == nullptr);
+      assertUnit(ThrowOnCopy::live() == 100);
+      // teardown
+      ThrowOnCopy::copiesLeft() = -1;
+   }
+
+   /***************************************
+    * DEGENERATE
+    *    BST::operator= and BST::clear on a
+    *    tree far too deep to walk recursively
+    ***************************************/
+
+   // assign a million-level chain over a one-node tree
+   void test_assign_degenerateToOne()
+   {  // setup
+      custom::BST <int> bstSrc;
+      setupDegenerateFixture(bstSrc, NUM_DEGENERATE);
+      custom::BST <int> bstDest;
+      bstDest.insert(99);
+      custom::BST <int>::BNode* pRoot = bstDest.root;
+      // exercise
+      bstDest = bstSrc;
+      // verify
+      assertUnit(bstDest.root == pRoot);
+      assertUnit(bstDest.numElements == NUM_DEGENERATE);
+      assertUnit(isDegenerateFixture(bstSrc, NUM_DEGENERATE));
+      assertUnit(isDegenerateFixture(bstDest, NUM_DEGENERATE));
+   }  // teardown
+
+   // clear a million-level chain
+   void test_clear_degenerate()
+   {  // setup
+      custom::BST <int> bst;
+      setupDegenerateFixture(bst, NUM_DEGENERATE);
+      // exercise
+      bst.clear();
+      // verify
+      assertUnit(bst.root == nullptr);
+      assertUnit(bst.numElements == 0);
+   }  // teardown
+
+   /***************************************
+    * BALANCE
+    *    BST::insert and BST::erase keep the
+    *    red-black properties
+    ***************************************/
+
+   // sorted input used to degenerate into a linked list
+   void test_balance_insertSorted()
+   {  // setup
+      custom::BST <int> bst;
+      // exercise
+      for (int i = 0; i < 1000; i++)
+         bst.insert(i);
+      // verify
+      assertUnit(bst.size() == 1000);
+      assertUnit(bst.verifyRedBlack());
+      assertUnit(bst.root != nullptr);
+      if (bst.root)
+         assertUnit(bst.root->findHeight() <= 20);  // 2 log(n + 1)
+      int value = 0;
+      bool inOrder = true;
+      for (auto it = bst.begin(); it != bst.end(); ++it)
+         inOrder = inOrder && (*it == value++);
+      assertUnit(inOrder);
+      assertUnit(value == 1000);
+   }  // teardown
+
+   // an inner grandchild takes a double rotation
+   void test_balance_insertInnerGrandchild()
+   {  // setup
+      //            (50b)
+      //        +----+
+      //      (30r)
+      custom::BST <int> bst;
+      bst.insert(50);
+      bst.insert(30);
+      // exercise
+      auto pairBST = bst.insert(40);
+      // verify
+      //            (40b)
+      //        +----+----+
+      //      (30r)     (50r)
+      assertUnit(pairBST.second == true);
+      assertUnit(pairBST.first != bst.end());
+      assertUnit(bst.verifyRedBlack());
+      assertUnit(bst.root != nullptr);
+      if (bst.root)
+      {
+         assertUnit(bst.root->data == 40);
+         assertUnit(bst.root->isRed == false);
+         assertUnit(bst.root->pLeft && bst.root->pLeft->data == 30);
+         assertUnit(bst.root->pRight && bst.root->pRight->data == 50);
+         assertUnit(bst.root->pLeft && bst.root->pLeft->isRed);
+         assertUnit(bst.root->pRight && bst.root->pRight->isRed);
+      }
+      if (pairBST.first != bst.end())
+         assertUnit(pairBST.first.pNode == bst.root);
+   }  // teardown
+
+   // erase every node in a scrambled order, checking the tree each time
+   void test_balance_erase()
+   {  // setup
+      custom::BST <int> bst;
+      for (int i = 0; i < 500; i++)
+         bst.insert((i * 7919) % 500);
+      bool isRedBlack = true;
+      // exercise
+      for (int i = 0; i < 500; i++)
+      {
+         auto it = bst.find((i * 263) % 500);
+         assertUnit(it != bst.end());
+         bst.erase(it);
+         isRedBlack = isRedBlack && bst.verifyRedBlack();
+      }
+      // verify
+      assertUnit(isRedBlack);
+      assertUnit(bst.empty());
+      assertUnit(bst.root == nullptr);
+   }  // teardown
+
+
+   /**************************************************************
+    * THROW ON COPY
+    * An int whose copy constructor throws when copiesLeft runs
+    * down to zero. live counts the ones in existence, so a
+    * leaked node shows. Both are atomic: copies run on threads
+    *************************************************************/
+   struct ThrowOnCopy
+   {
+      ThrowOnCopy(int value = 0) : value(value) { live()++; }
+      ThrowOnCopy(const ThrowOnCopy& rhs) : value(rhs.value)
+      {
+         if (--copiesLeft() == 0)
+            throw "ERROR: unable to copy";
+         live()++;
+      }
+      ThrowOnCopy& operator = (const ThrowOnCopy& rhs) = default;
+      ~ThrowOnCopy() { live()--; }
+      bool operator <  (const ThrowOnCopy& rhs) const { return value < rhs.value; }
+      bool operator == (const ThrowOnCopy& rhs) const { return value == rhs.value; }
+
+      static std::atomic<int>& live()       { static std::atomic<int> num(0);  return num; }
+      static std::atomic<int>& copiesLeft() { static std::atomic<int> num(-1); return num; }
+      int value;
+   };
+
+   /**************************************************************
+    * SAME TREE
+    * Does pDest hold the same values and colors as pSrc, in
+    * different nodes, with every parent link right?
+    *************************************************************/
+   enum { NUM_PARALLEL = 100000 };
+
+   bool isSameTree(const custom::BST <int>::BNode* pSrc,
+                   const custom::BST <int>::BNode* pDest,
+                   const custom::BST <int>::BNode* pParent)
+   {
+      if (pSrc == nullptr || pDest == nullptr)
+         return pSrc == pDest;
+      return pSrc != pDest &&
+             pSrc->data == pDest->data &&
+             pSrc->isRed == pDest->isRed &&
+             pDest->pParent == pParent &&
+             isSameTree(pSrc->pLeft, pDest->pLeft, pDest) &&
+             isSameTree(pSrc->pRight, pDest->pRight, pDest);
+   }
+
+   /**************************************************************
+    * SETUP DEGENERATE FIXTURE
+    * 0, 1, 2, ... each the right child of the one before, the
+    * tree sorted input builds with no balancing
+    *************************************************************/
+   enum { NUM_DEGENERATE = 1000000 };
+
+   void setupDegenerateFixture(custom::BST <int>& bst, int num)
+   {
+      custom::BST<int>::BNode* p = new custom::BST<int>::BNode(0);
+      bst.root = p;
+      for (int i = 1; i < num; i++)
+      {
+         p->addRight(new custom::BST<int>::BNode(i));
+         p = p->pRight;
+      }
+      bst.numElements = num;
+   }
+
+   // is this the chain setupDegenerateFixture() built?
+   bool isDegenerateFixture(const custom::BST <int>& bst, int num)
+   {
+      const custom::BST<int>::BNode* pParent = nullptr;
+      const custom::BST<int>::BNode* p = bst.root;
+      for (int i = 0; i < num; i++)
+      {
+         if (p == nullptr || p->data != i || p->pParent != pParent || p->pLeft != nullptr)
+            return false;
+         pParent = p;
+         p = p->pRight;
+      }
+      return p == nullptr;
+   }
+
    /**************************************************************
     * SETUP STANDARD FIXTURE
     *                (50) 
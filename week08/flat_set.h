@@ -0,0 +1,336 @@
+/***********************************************************************
+* Header:
+*    Flat Set
+* Summary:
+*    A set kept as a sorted vector rather than a tree
+*      __       ____       ____         __
+*     /  |    .'    '.   .'    '.   _  / /
+*     `| |   |  .--.  | |  .--.  | (_)/ /
+*      | |   | |    | | | |    | |   / / _
+*     _| |_  |  `--'  | |  `--'  |  / / (_)
+*    |_____|  '.____.'   '.____.'  /_/
+*
+*    This will contain the class definition of:
+*        flat_set            : A set stored as a sorted custom::vector
+*        flat_set::iterator  : An iterator through flat_set
+* Author
+*    Josh Hamilton, Noah Li, & Steven Sellers
+************************************************************************/
+
+#pragma once
+
+#include <algorithm>  // for std::stable_sort and std::inplace_merge
+#include <cassert>
+#include <cstddef>    // for size_t
+#include <utility>    // for std::pair and std::move
+#include "vector.h"
+
+class TestFlatSet;    // forward declaration for unit tests
+
+namespace custom
+{
+
+/************************************************
+ * FLAT SET
+ * The same interface as set, but the elements sit in one
+ * sorted vector: no nodes, no pointers, and a lookup is a
+ * binary search over contiguous memory. Build it in bulk
+ * and read it often. A single insert or erase shifts
+ * everything after it, and any change to the set can
+ * invalidate every iterator.
+ ***********************************************/
+template <typename T>
+class flat_set
+{
+   friend class ::TestFlatSet; // give unit tests access to the privates
+public:
+
+   //
+   // Construct
+   //
+   flat_set() {}
+   flat_set(const flat_set& rhs) : elements(rhs.elements) {}
+   flat_set(flat_set&& rhs) noexcept : elements(std::move(rhs.elements)) {}
+   flat_set(const std::initializer_list <T>& il)
+   {
+      insert(il.begin(), il.end());
+   }
+   template <class Iterator>
+   flat_set(Iterator first, Iterator last)
+   {
+      insert(first, last);
+   }
+   ~flat_set() {}
+
+   //
+   // Assign
+   //
+   flat_set & operator = (const flat_set & rhs)
+   {
+      elements = rhs.elements;
+      return *this;
+   }
+   flat_set & operator = (flat_set && rhs)
+   {
+      elements = std::move(rhs.elements);
+      return *this;
+   }
+   flat_set & operator = (const std::initializer_list <T> & il)
+   {
+      clear();
+      insert(il.begin(), il.end());
+      return *this;
+   }
+   void swap(flat_set& rhs) noexcept
+   {
+      elements.swap(rhs.elements);
+   }
+
+   //
+   // Iterator
+   //
+   class iterator;
+   iterator begin() const noexcept { return iterator(base());          }
+   iterator end()   const noexcept { return iterator(base() + size()); }
+
+   //
+   // Access
+   //
+   iterator find(const T& t) const
+   {
+      size_t index = lowerBound(t);
+      if (index == size() || t < elements[index])
+         return end();
+      return iterator(base() + index);
+   }
+
+   //
+   // Status
+   //
+   bool   empty() const noexcept { return elements.empty(); }
+   size_t size()  const noexcept { return elements.size();  }
+
+   //
+   // Insert
+   //
+   std::pair<iterator, bool> insert(const T& t) { return emplaceAt(t, t);            }
+   std::pair<iterator, bool> insert(T&& t)      { return emplaceAt(t, std::move(t)); }
+   void insert(const std::initializer_list<T>& il)
+   {
+      insert(il.begin(), il.end());
+   }
+   template <class Iterator>
+   void insert(Iterator first, Iterator last);
+   void reserve(size_t num) { elements.reserve(num); }
+
+   //
+   // Remove
+   //
+   void clear() noexcept
+   {
+      elements.clear();
+   }
+   iterator erase(iterator& it)
+   {
+      size_t index = it.p - base();
+      eraseRange(index, index + 1);
+      return iterator(base() + index);
+   }
+   size_t erase(const T& t)
+   {
+      iterator it = find(t);
+      if (it == end())
+         return 0;
+      erase(it);
+      return 1;
+   }
+   iterator erase(iterator& itBegin, iterator& itEnd)
+   {
+      size_t index = itBegin.p - base();
+      eraseRange(index, itEnd.p - base());
+      return iterator(base() + index);
+   }
+
+private:
+
+   // the start of the elements, or nullptr when there are none
+   const T* base() const
+   {
+      return elements.empty() ? nullptr : &elements[0];
+   }
+
+   size_t lowerBound(const T& t) const;
+   template <class U>
+   std::pair<iterator, bool> emplaceAt(const T& t, U&& u);
+   void eraseRange(size_t indexBegin, size_t indexEnd);
+
+   custom::vector <T> elements;   // sorted, no two equal
+};
+
+
+/**************************************************
+ * FLAT SET ITERATOR
+ * An iterator through flat_set. A pointer into the vector
+ *************************************************/
+template <typename T>
+class flat_set <T> :: iterator
+{
+   friend class ::TestFlatSet; // give unit tests access to the privates
+   friend class custom::flat_set<T>;
+
+public:
+   // constructors, destructors, and assignment operator
+   iterator() : p(nullptr) {}
+   iterator(const T* p) : p(p) {}
+   iterator(const iterator & rhs) = default;
+   iterator& operator = (const iterator & rhs) = default;
+
+   // Equals, not equals operator
+   bool operator != (const iterator & rhs) const { return p != rhs.p; }
+   bool operator == (const iterator & rhs) const { return p == rhs.p; }
+
+   // Dereference operator
+   const T& operator * () const { return *p; }
+
+   // Prefix increment
+   iterator& operator ++ ()
+   {
+      ++p;
+      return *this;
+   }
+
+   // Postfix increment
+   iterator operator++ (int)
+   {
+      iterator tmp(*this);
+      ++p;
+      return tmp;
+   }
+
+   // Prefix decrement
+   iterator& operator -- ()
+   {
+      --p;
+      return *this;
+   }
+
+   // Postfix decrement
+   iterator operator-- (int)
+   {
+      iterator tmp(*this);
+      --p;
+      return tmp;
+   }
+
+private:
+
+   const T* p;
+};
+
+/*****************************************************
+ * FLAT SET :: LOWER BOUND
+ * The index of the first element not less than t. Each
+ * step halves the range without a data-dependent branch,
+ * so the compiler can use a conditional move and the
+ * loop never mispredicts
+ ****************************************************/
+template <typename T>
+size_t flat_set <T> ::lowerBound(const T& t) const
+{
+   size_t num = size();
+   if (num == 0)
+      return 0;
+
+   const T* pBase = base();
+   while (num > 1)
+   {
+      size_t half = num / 2;
+      pBase = (pBase[half] < t) ? pBase + half : pBase;
+      num -= half;
+   }
+   return (pBase - base()) + (*pBase < t ? 1 : 0);
+}
+
+/*****************************************************
+ * FLAT SET :: EMPLACE AT
+ * Put u where t belongs, unless t is already there
+ ****************************************************/
+template <typename T>
+template <class U>
+std::pair<typename flat_set <T> ::iterator, bool> flat_set <T> ::emplaceAt(const T& t, U&& u)
+{
+   size_t index = lowerBound(t);
+   if (index < size() && !(t < elements[index]))
+      return std::pair<iterator, bool>(iterator(base() + index), false);
+
+   typename custom::vector<T>::iterator it = (index == size() ? elements.end() :
+                                              typename custom::vector<T>::iterator(index, elements));
+   elements.emplace(it, std::forward<U>(u));
+   return std::pair<iterator, bool>(iterator(base() + index), true);
+}
+
+/*****************************************************
+ * FLAT SET :: INSERT RANGE
+ * Append the lot, sort only the new part, then merge it into
+ * the old part and drop the duplicates. Equal elements keep
+ * their order, so the one already in the set (or the first
+ * of the new ones) wins. O(n log n) rather than n inserts
+ * of O(n) each
+ ****************************************************/
+template <typename T>
+template <class Iterator>
+void flat_set <T> ::insert(Iterator itFirst, Iterator itLast)
+{
+   size_t numOld = size();
+   for (Iterator it = itFirst; it != itLast; ++it)
+      elements.push_back(*it);
+   if (size() == numOld)
+      return;
+
+   T* pBegin = &elements[0];
+   T* pMiddle = pBegin + numOld;
+   T* pEnd = pBegin + size();
+   std::stable_sort(pMiddle, pEnd);
+   std::inplace_merge(pBegin, pMiddle, pEnd);
+
+   // slide each first-of-its-kind down over the duplicates
+   size_t numKeep = 1;
+   for (size_t i = 1; i < size(); i++)
+      if (elements[numKeep - 1] < elements[i])
+      {
+         if (numKeep != i)
+            elements[numKeep] = std::move(elements[i]);
+         numKeep++;
+      }
+   while (size() > numKeep)
+      elements.pop_back();
+}
+
+/*****************************************************
+ * FLAT SET :: ERASE RANGE
+ * Slide the tail down over [indexBegin, indexEnd)
+ ****************************************************/
+template <typename T>
+void flat_set <T> ::eraseRange(size_t indexBegin, size_t indexEnd)
+{
+   assert(indexBegin <= indexEnd && indexEnd <= size());
+   size_t numErase = indexEnd - indexBegin;
+   if (numErase == 0)
+      return;
+   for (size_t i = indexEnd; i < size(); i++)
+      elements[i - numErase] = std::move(elements[i]);
+   for (size_t i = 0; i < numErase; i++)
+      elements.pop_back();
+}
+
+/*****************************************************
+ * SWAP
+ * Swap two flat sets
+ ****************************************************/
+template <typename T>
+void swap(flat_set <T>& lhs, flat_set <T>& rhs) noexcept
+{
+   lhs.swap(rhs);
+}
+
+}; // namespace custom
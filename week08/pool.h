@@ -0,0 +1,258 @@
+/***********************************************************************
+ * Header:
+ *    Pool
+ * Summary:
+ *    A pool allocator that hands out nodes from large slabs
+ *      __       ____       ____         __
+ *     /  |    .'    '.   .'    '.   _  / /
+ *     `| |   |  .--.  | |  .--.  | (_)/ /
+ *      | |   | |    | | | |    | |   / / _
+ *     _| |_  |  `--'  | |  `--'  |  / / (_)
+ *    |_____|  '.____.'   '.____.'  /_/
+ *
+ *    This will contain the class definition of:
+ *       pool              : slabs of fixed-size blocks and a free list
+ *       pool_allocator    : an allocator sharing one pool between copies
+ * Author
+ *    Steven Sellers
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>     // for size_t and std::max_align_t
+#include <memory>      // for std::shared_ptr
+#include <new>         // for ::operator new
+#include <type_traits> // for std::true_type
+
+class TestPool;
+class TestBST;
+
+namespace custom
+{
+
+/************************************************
+ * POOL
+ * Carves fixed-size blocks out of slabs. A block is handed out
+ * from the free list if there is one, otherwise by bumping a pointer
+ * through the current slab. The block size is set by the first
+ * allocation, so one pool serves one node type.
+ ***********************************************/
+class pool
+{
+   friend class ::TestPool;
+   friend class ::TestBST;
+public:
+   pool() : pSlabs(nullptr), pFree(nullptr), pNext(nullptr), pEnd(nullptr),
+            sizeBlock(0), numBlocksNext(64) {}
+   pool(const pool& rhs) = delete;
+   pool& operator = (const pool& rhs) = delete;
+   ~pool() { release(); }
+
+   // can a block of this size come from the pool?
+   bool fits(size_t size, size_t align) const
+   {
+      return align <= alignof(std::max_align_t) && (sizeBlock == 0 || size <= sizeBlock);
+   }
+
+   void* allocate(size_t size, size_t align);
+   void  deallocate(void* p) noexcept;
+   void  release() noexcept;
+
+private:
+   struct Slab  { Slab*  pNext; };  // header at the front of every slab
+   struct Block { Block* pNext; };  // a freed block on the free list
+
+   static constexpr size_t sizeHeader = (sizeof(Slab) + alignof(std::max_align_t) - 1) /
+                                        alignof(std::max_align_t) * alignof(std::max_align_t);
+   static constexpr size_t numBlocksMax = 65536;
+
+   Slab*  pSlabs;          // every slab we own, newest first
+   Block* pFree;           // blocks given back, ready for reuse
+   char*  pNext;           // next unused block in the newest slab
+   char*  pEnd;            // end of the newest slab
+   size_t sizeBlock;       // bytes per block, fixed on the first allocation
+   size_t numBlocksNext;   // blocks in the next slab. Doubles each time
+};
+
+/************************************************
+ * POOL ALLOCATOR
+ * A standard allocator over a pool. Copies, including copies
+ * rebound to another type, share the pool so the nodes of one
+ * container are packed together. Anything other than a single
+ * object goes to ::operator new.
+ ***********************************************/
+template <class T>
+class pool_allocator
+{
+   template <class U>
+   friend class pool_allocator;
+   friend class ::TestPool;
+   friend class ::TestBST;
+public:
+   using value_type = T;
+   using propagate_on_container_copy_assignment = std::false_type;
+   using propagate_on_container_move_assignment = std::true_type;
+   using propagate_on_container_swap            = std::true_type;
+
+   //
+   // Construct
+   //
+   pool_allocator() : pPool(std::make_shared<pool>()), isDecided(false), isPooled(false) {}
+   pool_allocator(const pool_allocator& rhs) noexcept = default;
+   template <class U>
+   pool_allocator(const pool_allocator<U>& rhs) noexcept :
+      pPool(rhs.pPool), isDecided(false), isPooled(false) {}
+   pool_allocator& operator = (const pool_allocator& rhs) noexcept = default;
+
+   // a copied container gets a pool of its own
+   pool_allocator select_on_container_copy_construction() const
+   {
+      return pool_allocator();
+   }
+
+   //
+   // Allocate
+   //
+   T* allocate(size_t num)
+   {
+      if (usePool(num))
+         return static_cast<T*>(pPool->allocate(sizeof(T), alignof(T)));
+      return static_cast<T*>(::operator new(num * sizeof(T)));
+   }
+   void deallocate(T* p, size_t num) noexcept
+   {
+      if (usePool(num))
+         pPool->deallocate(p);
+      else
+         ::operator delete(p);
+   }
+
+   // Drop every block at once. Only allowed when nobody else shares the pool
+   bool release() noexcept
+   {
+      if (pPool.use_count() != 1)
+         return false;
+      pPool->release();
+      isDecided = false;
+      return true;
+   }
+
+   //
+   // Compare: equal allocators can free each other's blocks
+   //
+   template <class U>
+   bool operator == (const pool_allocator<U>& rhs) const noexcept { return pPool == rhs.pPool; }
+   template <class U>
+   bool operator != (const pool_allocator<U>& rhs) const noexcept { return pPool != rhs.pPool; }
+
+private:
+   // Does a single T come from the pool? The pool's block size is set
+   // by its first allocation, so the answer is settled on first use and
+   // remembered. allocate and deallocate then cannot disagree
+   bool usePool(size_t num) noexcept
+   {
+      if (num != 1)
+         return false;
+      if (!isDecided)
+      {
+         isPooled = pPool->fits(sizeof(T), alignof(T));
+         isDecided = true;
+      }
+      return isPooled;
+   }
+
+   std::shared_ptr<pool> pPool;
+   bool isDecided;   // has usePool looked at the pool yet?
+   bool isPooled;    // if so, does a single T come from the pool?
+};
+
+/*****************************************************
+ * RELEASE ALL
+ * Give back every block an allocator handed out in one step.
+ * Most allocators cannot, so the caller must free them one by one
+ ****************************************************/
+template <class Alloc>
+inline bool releaseAll(Alloc&) noexcept
+{
+   return false;
+}
+
+template <class T>
+inline bool releaseAll(pool_allocator<T>& alloc) noexcept
+{
+   return alloc.release();
+}
+
+/*****************************************************
+ * POOL :: ALLOCATE
+ * Reuse a freed block, else bump through the slab, else grow
+ ****************************************************/
+inline void* pool::allocate(size_t size, size_t align)
+{
+   // the first allocation sets the block size
+   if (sizeBlock == 0)
+   {
+      if (align < alignof(Block))
+         align = alignof(Block);
+      sizeBlock = (size < sizeof(Block) ? sizeof(Block) : size);
+      sizeBlock = (sizeBlock + align - 1) / align * align;
+   }
+   assert(size <= sizeBlock);
+
+   // a block that was given back
+   if (pFree)
+   {
+      Block* pBlock = pFree;
+      pFree = pFree->pNext;
+      return pBlock;
+   }
+
+   // a new slab when the current one is used up
+   if (pNext == pEnd)
+   {
+      Slab* pSlab = static_cast<Slab*>(::operator new(sizeHeader + numBlocksNext * sizeBlock));
+      pSlab->pNext = pSlabs;
+      pSlabs = pSlab;
+      pNext = reinterpret_cast<char*>(pSlab) + sizeHeader;
+      pEnd = pNext + numBlocksNext * sizeBlock;
+      if (numBlocksNext < numBlocksMax)
+         numBlocksNext *= 2;
+   }
+
+   void* p = pNext;
+   pNext += sizeBlock;
+   return p;
+}
+
+/*****************************************************
+ * POOL :: DEALLOCATE
+ * Put the block on the free list
+ ****************************************************/
+inline void pool::deallocate(void* p) noexcept
+{
+   Block* pBlock = static_cast<Block*>(p);
+   pBlock->pNext = pFree;
+   pFree = pBlock;
+}
+
+/*****************************************************
+ * POOL :: RELEASE
+ * Free every slab. Any block still handed out is gone.
+ * The pool starts over, small slabs and all
+ ****************************************************/
+inline void pool::release() noexcept
+{
+   while (pSlabs)
+   {
+      Slab* pDelete = pSlabs;
+      pSlabs = pSlabs->pNext;
+      ::operator delete(pDelete);
+   }
+   pFree = nullptr;
+   pNext = pEnd = nullptr;
+   sizeBlock = 0;
+   numBlocksNext = 64;
+}
+
+}; // namespace custom
@@ -31,9 +31,10 @@ namespace custom
 
 /************************************************
  * SET
- * A class that represents a Set
+ * A class that represents a Set. The nodes of the
+ * tree come from A
  ***********************************************/
-template <typename T>
+template <typename T, typename A = std::allocator<T>>
 class set
 {
    friend class ::TestSet; // give unit tests access to the privates
@@ -46,6 +47,10 @@ public:
     {
     }
 
+    explicit set(const A& a) : bst(a)
+    {
+    }
+
     set(const set& rhs)
     {
         bst = rhs.bst;
@@ -64,8 +69,7 @@ public:
     template <class Iterator>
     set(Iterator first, Iterator last)
     {
-        for (auto it = first; it != last; ++it)
-            bst.insert(*it);
+        bst.insert(first, last, true);  // Linear time if sorted
     }
 
   ~set() { }
@@ -158,10 +162,7 @@ public:
    template <class Iterator>
    void insert(Iterator first, Iterator last)
    {
-       for (auto it = first; it != last; ++it)
-       {
-           bst.insert(*it, true);  // Ensure keepUnique is true
-       }
+       bst.insert(first, last, true);  // Ensure keepUnique is true
    }
 
 
@@ -199,7 +200,7 @@ public:
 
 private:
    
-   custom::BST <T> bst;
+   custom::BST <T, A> bst;
 };
 
 
@@ -207,17 +208,17 @@ private:
  * SET ITERATOR
  * An iterator through Set
  *************************************************/
-template <typename T>
-class set <T> :: iterator
+template <typename T, typename A>
+class set <T, A> :: iterator
 {
    friend class ::TestSet; // give unit tests access to the privates
-   friend class custom::set<T>;
+   friend class custom::set<T, A>;
 
 public:
    // constructors, destructors, and assignment operator
     iterator() = default;
 
-    iterator(const typename custom::BST<T>::iterator & itRHS) : it(itRHS) {}
+    iterator(const typename custom::BST<T, A>::iterator & itRHS) : it(itRHS) {}
 
     iterator(const iterator & rhs) = default;
 
@@ -272,7 +273,7 @@ public:
    
 private:
 
-   typename custom::BST<T>::iterator it;
+   typename custom::BST<T, A>::iterator it;
 };
 
 
@@ -19,7 +19,11 @@
 #include <memory>
 #include <iostream>
 #include <string>
+#include <vector>
+#include <sstream>  // for std::istringstream
+#include <iterator> // for std::istream_iterator
 #include <functional> // for std::less and std::greater
+#include <atomic>     // for std::atomic
 
  /***********************************************
   * TEST BST
@@ -38,6 +42,9 @@ public:
       test_constructCopy_empty();
       test_constructCopy_one();
       test_constructCopy_standard();
+      test_constructCopy_parallel();
+      test_copyParallel_deep();
+      test_copyParallel_throw();
       test_constructMove_empty();
       test_constructMove_one();
       test_constructMove_standard();
@@ -51,6 +58,7 @@ public:
       test_assign_oneToStandard();
       test_assign_standardToOne();
       test_assign_standardToStandard();
+      test_assign_degenerateToOne();
       test_assignMove_emptyToEmpty();
       test_assignMove_standardToEmpty();
       test_assignMove_emptyToStandard();
@@ -91,6 +99,10 @@ public:
       test_insertMove_oneRight();
       test_insertMove_duplicate();
       test_insertMove_keepUnique();
+      test_insertRange_sorted();
+      test_insertRange_unsorted();
+      test_insertRange_singlePass();
+      test_buildSorted_sizes();
 
       // Remove
       test_erase_empty();
@@ -100,6 +112,17 @@ public:
       test_erase_twoChildren();
       test_clear_empty();
       test_clear_standard();
+      test_clear_degenerate();
+
+      // Balance
+      test_balance_insertSorted();
+      test_balance_insertInnerGrandchild();
+      test_balance_erase();
+
+      // Allocator
+      test_pool_insertErase();
+      test_pool_clear();
+      test_pool_copy();
 
       // Status
       test_empty_empty();
@@ -2475,6 +2498,426 @@ public:
       bst.root = nullptr;
    }
 
+   /***************************************
+    * INSERT RANGE
+    *    BST::insert(first, last, keepUnique)
+    *    BST::buildSorted(first, num)
+    ***************************************/
+
+   // a sorted range is built directly, one compare per element
+   void test_insertRange_sorted()
+   {  // setup
+      std::vector<Spy> v;
+      for (int i = 1; i <= 7; i++)
+         v.push_back(Spy(i * 10));
+      custom::BST <Spy> bst;
+      Spy::reset();
+      // exercise
+      bst.insert(v.begin(), v.end(), true /* keepUnique */);
+      // verify
+      assertUnit(Spy::numLessthan() == 6);    // check the order
+      assertUnit(Spy::numCopy() == 7);        // copy-create each element
+      assertUnit(Spy::numAlloc() == 7);       // allocate each element
+      assertUnit(Spy::numEquals() == 0);
+      assertUnit(Spy::numDestructor() == 0);
+      assertUnit(Spy::numDelete() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numDefault() == 0);
+      assertUnit(Spy::numNondefault() == 0);
+      assertUnit(Spy::numCopyMove() == 0);
+      assertUnit(Spy::numAssignMove() == 0);
+      //                (40)
+      //          +-------+-------+
+      //        (20)            (60)
+      //     +----+----+     +----+----+
+      //   (10)      (30)  (50)      (70)
+      assertUnit(bst.numElements == 7);
+      assertUnit(bst.verifyRedBlack());
+      assertUnit(bst.root != nullptr);
+      if (bst.root)
+      {
+         assertUnit(bst.root->data == Spy(40));
+         assertUnit(bst.root->findHeight() == 3);
+         assertUnit(bst.root->pLeft && bst.root->pLeft->data == Spy(20));
+         assertUnit(bst.root->pRight && bst.root->pRight->data == Spy(60));
+      }
+   }  // teardown
+
+   // an unsorted range is inserted one element at a time
+   void test_insertRange_unsorted()
+   {  // setup
+      std::vector<int> v{ 50, 30, 70, 20, 40, 60, 80, 30 };
+      custom::BST <int> bst;
+      // exercise
+      bst.insert(v.begin(), v.end(), true /* keepUnique */);
+      // verify
+      assertUnit(bst.numElements == 7);
+      assertUnit(bst.verifyRedBlack());
+      int previous = 0;
+      bool inOrder = true;
+      for (auto it = bst.begin(); it != bst.end(); ++it)
+      {
+         inOrder = inOrder && previous < *it;
+         previous = *it;
+      }
+      assertUnit(inOrder);
+   }  // teardown
+
+   // a range that can only be read once is still inserted in full
+   void test_insertRange_singlePass()
+   {  // setup
+      std::istringstream sin("10 20 30 40 50");
+      custom::BST <int> bst;
+      // exercise
+      bst.insert(std::istream_iterator<int>(sin), std::istream_iterator<int>());
+      // verify
+      assertUnit(bst.numElements == 5);
+      assertUnit(bst.verifyRedBlack());
+      assertUnit(bst.root && bst.root->data == 20);
+   }  // teardown
+
+   // every size builds a valid red-black tree of minimal height
+   void test_buildSorted_sizes()
+   {
+      bool isRedBlack = true;
+      bool isShort = true;
+      for (int num = 0; num <= 100; num++)
+      {  // setup
+         std::vector<int> v;
+         for (int i = 0; i < num; i++)
+            v.push_back(i);
+         custom::BST <int> bst;
+         bst.insert(99);
+         // exercise
+         bst.buildSorted(v.begin(), v.size());
+         // verify
+         int height = 0;
+         while ((1 << height) <= num)
+            height++;
+         isRedBlack = isRedBlack && bst.verifyRedBlack() && bst.size() == (size_t)num;
+         isShort = isShort && (bst.root == nullptr || bst.root->findHeight() == height);
+      }  // teardown
+      assertUnit(isRedBlack);
+      assertUnit(isShort);
+   }
+
+   /***************************************
+    * PARALLEL COPY
+    *    BST::copyParallel forks subtrees
+    *    onto other threads
+    ***************************************/
+
+   // a big copy goes through copyParallel and keeps every link and color
+   void test_constructCopy_parallel()
+   {  // setup
+      custom::BST <int> bstSrc;
+      for (int i = 0; i < NUM_PARALLEL; i++)
+         bstSrc.insert((i * 7919) % NUM_PARALLEL);
+      // exercise
+      custom::BST <int> bstDest(bstSrc);
+      // verify
+      assertUnit(bstDest.root != bstSrc.root);
+      assertUnit(bstDest.numElements == NUM_PARALLEL);
+      assertUnit(bstDest.verifyRedBlack());
+      assertUnit(isSameTree(bstSrc.root, bstDest.root, nullptr));
+   }  // teardown
+
+   // forking past the bottom of the tree stops at the leaves
+   void test_copyParallel_deep()
+   {  // setup
+      custom::BST <int> bstSrc;
+      for (int i = 0; i < 100; i++)
+         bstSrc.insert(i);
+      custom::BST <int> bstDest;
+      // exercise
+      bstDest.root = bstDest.copyParallel(bstSrc.root, 10);
+      bstDest.numElements = bstSrc.numElements;
+      // verify
+      assertUnit(bstDest.root != bstSrc.root);
+      assertUnit(bstDest.verifyRedBlack());
+      assertUnit(isSameTree(bstSrc.root, bstDest.root, nullptr));
+   }  // teardown
+
+   // a copy that throws partway through a thread's subtree frees it all
+   void test_copyParallel_throw()
+   {  // setup
+      custom::BST <ThrowOnCopy> bstSrc;
+      for (int i = 0; i < 100; i++)
+         bstSrc.insert(ThrowOnCopy(i));
+      custom::BST <ThrowOnCopy> bstDest;
+      ThrowOnCopy::copiesLeft() = 50;
+      bool thrown = false;
+      // exercise
+      try
+      {
+         bstDest.root = bstDest.copyParallel(bstSrc.root, 1);
+      }
+      catch (...)
+      {
+         thrown = true;
+      }
+      // verify
+      assertUnit(thrown);
+      assertUnit(bstDest.root == nullptr);
+      assertUnit(ThrowOnCopy::live() == 100);
+      // teardown
+      ThrowOnCopy::copiesLeft() = -1;
+   }
+
+   /***************************************
+    * DEGENERATE
+    *    BST::operator= and BST::clear on a
+    *    tree far too deep to walk recursively
+    ***************************************/
+
+   // assign a million-level chain over a one-node tree
+   void test_assign_degenerateToOne()
+   {  // setup
+      custom::BST <int> bstSrc;
+      setupDegenerateFixture(bstSrc, NUM_DEGENERATE);
+      custom::BST <int> bstDest;
+      bstDest.insert(99);
+      custom::BST <int>::BNode* pRoot = bstDest.root;
+      // exercise
+      bstDest = bstSrc;
+      // verify
+      assertUnit(bstDest.root == pRoot);
+      assertUnit(bstDest.numElements == NUM_DEGENERATE);
+      assertUnit(isDegenerateFixture(bstSrc, NUM_DEGENERATE));
+      assertUnit(isDegenerateFixture(bstDest, NUM_DEGENERATE));
+   }  // teardown
+
+   // clear a million-level chain
+   void test_clear_degenerate()
+   {  // setup
+      custom::BST <int> bst;
+      setupDegenerateFixture(bst, NUM_DEGENERATE);
+      // exercise
+      bst.clear();
+      // verify
+      assertUnit(bst.root == nullptr);
+      assertUnit(bst.numElements == 0);
+   }  // teardown
+
+   /***************************************
+    * BALANCE
+    *    BST::insert and BST::erase keep the
+    *    red-black properties
+    ***************************************/
+
+   // sorted input used to degenerate into a linked list
+   void test_balance_insertSorted()
+   {  // setup
+      custom::BST <int> bst;
+      // exercise
+      for (int i = 0; i < 1000; i++)
+         bst.insert(i);
+      // verify
+      assertUnit(bst.size() == 1000);
+      assertUnit(bst.verifyRedBlack());
+      assertUnit(bst.root != nullptr);
+      if (bst.root)
+         assertUnit(bst.root->findHeight() <= 20);  // 2 log(n + 1)
+      int value = 0;
+      bool inOrder = true;
+      for (auto it = bst.begin(); it != bst.end(); ++it)
+         inOrder = inOrder && (*it == value++);
+      assertUnit(inOrder);
+      assertUnit(value == 1000);
+   }  // teardown
+
+   // an inner grandchild takes a double rotation
+   void test_balance_insertInnerGrandchild()
+   {  // setup
+      //            (50b)
+      //        +----+
+      //      (30r)
+      custom::BST <int> bst;
+      bst.insert(50);
+      bst.insert(30);
+      // exercise
+      auto pairBST = bst.insert(40);
+      // verify
+      //            (40b)
+      //        +----+----+
+      //      (30r)     (50r)
+      assertUnit(pairBST.second == true);
+      assertUnit(pairBST.first != bst.end());
+      assertUnit(bst.verifyRedBlack());
+      assertUnit(bst.root != nullptr);
+      if (bst.root)
+      {
+         assertUnit(bst.root->data == 40);
+         assertUnit(bst.root->isRed == false);
+         assertUnit(bst.root->pLeft && bst.root->pLeft->data == 30);
+         assertUnit(bst.root->pRight && bst.root->pRight->data == 50);
+         assertUnit(bst.root->pLeft && bst.root->pLeft->isRed);
+         assertUnit(bst.root->pRight && bst.root->pRight->isRed);
+      }
+      if (pairBST.first != bst.end())
+         assertUnit(pairBST.first.pNode == bst.root);
+   }  // teardown
+
+   // erase every node in a scrambled order, checking the tree each time
+   void test_balance_erase()
+   {  // setup
+      custom::BST <int> bst;
+      for (int i = 0; i < 500; i++)
+         bst.insert((i * 7919) % 500);
+      bool isRedBlack = true;
+      // exercise
+      for (int i = 0; i < 500; i++)
+      {
+         auto it = bst.find((i * 263) % 500);
+         assertUnit(it != bst.end());
+         bst.erase(it);
+         isRedBlack = isRedBlack && bst.verifyRedBlack();
+      }
+      // verify
+      assertUnit(isRedBlack);
+      assertUnit(bst.empty());
+      assertUnit(bst.root == nullptr);
+   }  // teardown
+
+
+   /***************************************
+    * ALLOCATOR
+    *    BST <T, pool_allocator<T>>
+    ***************************************/
+
+   // a pooled tree inserts and erases like any other
+   void test_pool_insertErase()
+   {  // setup
+      custom::BST <int, custom::pool_allocator<int>> bst;
+      // exercise
+      for (int i = 0; i < 1000; i++)
+         bst.insert((i * 7919) % 1000);
+      for (int i = 0; i < 1000; i += 2)
+      {
+         auto it = bst.find(i);
+         bst.erase(it);
+      }
+      // verify
+      assertUnit(bst.size() == 500);
+      assertUnit(bst.verifyRedBlack());
+      assertUnit(bst.alloc.pPool->pFree != nullptr);   // erased nodes wait for reuse
+      bst.insert(1000);
+      assertUnit(bst.size() == 501);
+   }  // teardown
+
+   // clearing a pooled tree of ints drops the slabs in one step
+   void test_pool_clear()
+   {  // setup
+      custom::BST <int, custom::pool_allocator<int>> bst;
+      for (int i = 0; i < 1000; i++)
+         bst.insert(i);
+      // exercise
+      bst.clear();
+      // verify
+      assertUnit(bst.root == nullptr);
+      assertUnit(bst.numElements == 0);
+      assertUnit(bst.alloc.pPool->pSlabs == nullptr);
+      bst.insert(50);
+      assertUnit(bst.size() == 1);
+   }  // teardown
+
+   // a copy of a pooled tree gets a pool of its own
+   void test_pool_copy()
+   {  // setup
+      custom::BST <int, custom::pool_allocator<int>> bst;
+      for (int i = 0; i < 100; i++)
+         bst.insert(i);
+      // exercise
+      custom::BST <int, custom::pool_allocator<int>> bstCopy(bst);
+      // verify
+      assertUnit(bstCopy.alloc != bst.alloc);
+      assertUnit(bstCopy.size() == 100);
+      assertUnit(bstCopy.verifyRedBlack());
+      bst.clear();
+      assertUnit(bstCopy.size() == 100);
+      assertUnit(*bstCopy.begin() == 0);
+   }  // teardown
+
+   /**************************************************************
+    * THROW ON COPY
+    * An int whose copy constructor throws when copiesLeft runs
+    * down to zero. live counts the ones in existence, so a
+    * leaked node shows. Both are atomic: copies run on threads
+    *************************************************************/
+   struct ThrowOnCopy
+   {
+      ThrowOnCopy(int value = 0) : value(value) { live()++; }
+      ThrowOnCopy(const ThrowOnCopy& rhs) : value(rhs.value)
+      {
+         if (--copiesLeft() == 0)
+            throw "ERROR: unable to copy";
+         live()++;
+      }
+      ThrowOnCopy& operator = (const ThrowOnCopy& rhs) = default;
+      ~ThrowOnCopy() { live()--; }
+      bool operator <  (const ThrowOnCopy& rhs) const { return value < rhs.value; }
+      bool operator == (const ThrowOnCopy& rhs) const { return value == rhs.value; }
+
+      static std::atomic<int>& live()       { static std::atomic<int> num(0);  return num; }
+      static std::atomic<int>& copiesLeft() { static std::atomic<int> num(-1); return num; }
+      int value;
+   };
+
+   /**************************************************************
+    * SAME TREE
+    * Does pDest hold the same values and colors as pSrc, in
+    * different nodes, with every parent link right?
+    *************************************************************/
+   enum { NUM_PARALLEL = 100000 };
+
+   bool isSameTree(const custom::BST <int>::BNode* pSrc,
+                   const custom::BST <int>::BNode* pDest,
+                   const custom::BST <int>::BNode* pParent)
+   {
+      if (pSrc == nullptr || pDest == nullptr)
+         return pSrc == pDest;
+      return pSrc != pDest &&
+             pSrc->data == pDest->data &&
+             pSrc->isRed == pDest->isRed &&
+             pDest->pParent == pParent &&
+             isSameTree(pSrc->pLeft, pDest->pLeft, pDest) &&
+             isSameTree(pSrc->pRight, pDest->pRight, pDest);
+   }
+
+   /**************************************************************
+    * SETUP DEGENERATE FIXTURE
+    * 0, 1, 2, ... each the right child of the one before, the
+    * tree sorted input builds with no balancing
+    *************************************************************/
+   enum { NUM_DEGENERATE = 1000000 };
+
+   void setupDegenerateFixture(custom::BST <int>& bst, int num)
+   {
+      custom::BST<int>::BNode* p = new custom::BST<int>::BNode(0);
+      bst.root = p;
+      for (int i = 1; i < num; i++)
+      {
+         p->addRight(new custom::BST<int>::BNode(i));
+         p = p->pRight;
+      }
+      bst.numElements = num;
+   }
+
+   // is this the chain setupDegenerateFixture() built?
+   bool isDegenerateFixture(const custom::BST <int>& bst, int num)
+   {
+      const custom::BST<int>::BNode* pParent = nullptr;
+      const custom::BST<int>::BNode* p = bst.root;
+      for (int i = 0; i < num; i++)
+      {
+         if (p == nullptr || p->data != i || p->pParent != pParent || p->pLeft != nullptr)
+            return false;
+         pParent = p;
+         p = p->pRight;
+      }
+      return p == nullptr;
+   }
+
    /**************************************************************
     * SETUP STANDARD FIXTURE
     *                (50) 
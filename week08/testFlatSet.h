@@ -0,0 +1,324 @@
+/***********************************************************************
+ * Header:
+ *    TEST FLAT SET
+ * Summary:
+ *    Unit tests for flat_set
+ * Author
+ *    Josh Hamilton, Noah Li, & Steven Sellers
+ ************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG
+
+#include "flat_set.h"
+#include "unitTest.h"
+#include "spy.h"
+
+#include <cassert>
+#include <utility>
+
+class TestFlatSet : public UnitTest
+{
+
+public:
+   void run()
+   {
+      reset();
+
+      // Construct
+      test_construct_default();
+      test_constructRange_unsorted();
+      test_constructRange_duplicates();
+      test_constructCopy_standard();
+      test_constructMove_standard();
+
+      // Access
+      test_find_empty();
+      test_find_standard();
+      test_find_missing();
+      test_lowerBound_every();
+
+      // Insert
+      test_insert_middle();
+      test_insert_duplicate();
+      test_insertMove_spyNoCopy();
+      test_insertRange_merge();
+
+      // Remove
+      test_erase_value();
+      test_erase_iterator();
+      test_erase_range();
+
+      // Iterator
+      test_iterator_walk();
+
+      report("FlatSet");
+   }
+
+   /***************************************
+    * CONSTRUCTOR
+    ***************************************/
+
+   // a new set holds nothing
+   void test_construct_default()
+   {  // setup
+      // exercise
+      custom::flat_set<int> s;
+      // verify
+      assertUnit(s.empty());
+      assertUnit(s.size() == 0);
+      assertUnit(s.begin() == s.end());
+   }  // teardown
+
+   // bulk load sorts the elements
+   void test_constructRange_unsorted()
+   {  // setup
+      int values[] = { 60, 20, 80, 40, 50, 70, 30 };
+      // exercise
+      custom::flat_set<int> s(values, values + 7);
+      // verify
+      assertStandardFixture(s);
+   }  // teardown
+
+   // bulk load keeps one of each
+   void test_constructRange_duplicates()
+   {  // setup
+      // exercise
+      custom::flat_set<int> s{ 50, 30, 50, 20, 30, 80, 60, 40, 70, 20 };
+      // verify
+      assertStandardFixture(s);
+   }  // teardown
+
+   void test_constructCopy_standard()
+   {  // setup
+      custom::flat_set<int> sSrc;
+      setupStandardFixture(sSrc);
+      // exercise
+      custom::flat_set<int> sDest(sSrc);
+      // verify
+      assertStandardFixture(sSrc);
+      assertStandardFixture(sDest);
+      assertUnit(sSrc.begin() != sDest.begin());
+   }  // teardown
+
+   void test_constructMove_standard()
+   {  // setup
+      custom::flat_set<int> sSrc;
+      setupStandardFixture(sSrc);
+      // exercise
+      custom::flat_set<int> sDest(std::move(sSrc));
+      // verify
+      assertStandardFixture(sDest);
+      assertUnit(sSrc.empty());
+   }  // teardown
+
+   /***************************************
+    * FIND
+    ***************************************/
+
+   void test_find_empty()
+   {  // setup
+      custom::flat_set<int> s;
+      // exercise
+      custom::flat_set<int>::iterator it = s.find(50);
+      // verify
+      assertUnit(it == s.end());
+   }  // teardown
+
+   void test_find_standard()
+   {  // setup
+      custom::flat_set<int> s;
+      setupStandardFixture(s);
+      // exercise
+      custom::flat_set<int>::iterator it = s.find(70);
+      // verify
+      assertUnit(it != s.end());
+      assertUnit(*it == 70);
+      assertUnit(it.p == &s.elements[5]);
+   }  // teardown
+
+   // below the smallest, between two and above the largest
+   void test_find_missing()
+   {  // setup
+      custom::flat_set<int> s;
+      setupStandardFixture(s);
+      // exercise and verify
+      assertUnit(s.find(10) == s.end());
+      assertUnit(s.find(55) == s.end());
+      assertUnit(s.find(99) == s.end());
+   }  // teardown
+
+   // the branchless search lands right for every size up to 17
+   void test_lowerBound_every()
+   {  // setup
+      bool correct = true;
+      for (int num = 0; num <= 17; num++)
+      {
+         custom::flat_set<int> s;
+         for (int i = 0; i < num; i++)
+            s.insert(i * 2);
+         // exercise and verify: every even is found, every odd falls before the next even
+         for (int t = -1; t <= num * 2; t++)
+         {
+            size_t expect = (t < 0 ? 0 : size_t((t + 1) / 2));
+            correct = correct && s.lowerBound(t) == expect;
+         }
+      }
+      assertUnit(correct);
+   }  // teardown
+
+   /***************************************
+    * INSERT
+    ***************************************/
+
+   // an insert lands in order
+   void test_insert_middle()
+   {  // setup
+      custom::flat_set<int> s{ 20, 30, 40, 60, 70, 80 };
+      // exercise
+      std::pair<custom::flat_set<int>::iterator, bool> result = s.insert(50);
+      // verify
+      assertUnit(result.second);
+      assertUnit(*result.first == 50);
+      assertStandardFixture(s);
+   }  // teardown
+
+   // a duplicate is found, not inserted
+   void test_insert_duplicate()
+   {  // setup
+      custom::flat_set<int> s;
+      setupStandardFixture(s);
+      // exercise
+      std::pair<custom::flat_set<int>::iterator, bool> result = s.insert(40);
+      // verify
+      assertUnit(!result.second);
+      assertUnit(*result.first == 40);
+      assertUnit(result.first.p == &s.elements[2]);
+      assertStandardFixture(s);
+   }  // teardown
+
+   // moving in moves, and a duplicate is neither copied nor moved
+   void test_insertMove_spyNoCopy()
+   {  // setup
+      custom::flat_set<Spy> s;
+      s.reserve(4);
+      Spy s50(50);
+      Spy s30(30);
+      Spy again(50);
+      Spy::reset();
+      // exercise
+      s.insert(std::move(s50));
+      s.insert(std::move(s30));
+      s.insert(std::move(again));
+      // verify
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(s.size() == 2);
+      assertUnit(s.elements[0].get() == 30);
+      assertUnit(s.elements[1].get() == 50);
+      assertUnit(again.get() == 50);
+   }  // teardown
+
+   // a range is merged in and the old element wins a tie
+   void test_insertRange_merge()
+   {  // setup
+      custom::flat_set<int> s{ 20, 50, 80 };
+      int values[] = { 70, 30, 50, 60, 40, 30 };
+      // exercise
+      s.insert(values, values + 6);
+      // verify
+      assertStandardFixture(s);
+   }  // teardown
+
+   /***************************************
+    * ERASE
+    ***************************************/
+
+   void test_erase_value()
+   {  // setup
+      custom::flat_set<int> s{ 20, 30, 40, 45, 50, 60, 70, 80 };
+      // exercise
+      size_t numMissing = s.erase(99);
+      size_t numErased = s.erase(45);
+      // verify
+      assertUnit(numMissing == 0);
+      assertUnit(numErased == 1);
+      assertStandardFixture(s);
+   }  // teardown
+
+   // erasing returns the element after
+   void test_erase_iterator()
+   {  // setup
+      custom::flat_set<int> s{ 10, 20, 30, 40, 50, 60, 70, 80 };
+      custom::flat_set<int>::iterator it = s.begin();
+      // exercise
+      custom::flat_set<int>::iterator itNext = s.erase(it);
+      // verify
+      assertUnit(*itNext == 20);
+      assertStandardFixture(s);
+   }  // teardown
+
+   void test_erase_range()
+   {  // setup
+      custom::flat_set<int> s;
+      setupStandardFixture(s);
+      custom::flat_set<int>::iterator itBegin = s.find(30);
+      custom::flat_set<int>::iterator itEnd = s.find(70);
+      // exercise
+      custom::flat_set<int>::iterator itNext = s.erase(itBegin, itEnd);
+      // verify
+      assertUnit(s.size() == 3);
+      assertUnit(*itNext == 70);
+      assertUnit(s.elements[0] == 20);
+      assertUnit(s.elements[1] == 70);
+      assertUnit(s.elements[2] == 80);
+   }  // teardown
+
+   /***************************************
+    * ITERATOR
+    ***************************************/
+
+   // forward through every element, then back again
+   void test_iterator_walk()
+   {  // setup
+      custom::flat_set<int> s;
+      setupStandardFixture(s);
+      bool inOrder = true;
+      int value = 20;
+      // exercise
+      for (custom::flat_set<int>::iterator it = s.begin(); it != s.end(); it++, value += 10)
+         inOrder = inOrder && *it == value;
+      custom::flat_set<int>::iterator it = s.end();
+      --it;
+      // verify
+      assertUnit(inOrder);
+      assertUnit(value == 90);
+      assertUnit(*it == 80);
+   }  // teardown
+
+   /***************************************************
+    * SETUP STANDARD FIXTURE
+    *    20 30 40 50 60 70 80
+    ***************************************************/
+   void setupStandardFixture(custom::flat_set<int>& s)
+   {
+      for (int i = 20; i <= 80; i += 10)
+         s.elements.push_back(i);
+   }
+
+   /***************************************************
+    * VERIFY STANDARD FIXTURE
+    *    20 30 40 50 60 70 80
+    ***************************************************/
+   void assertStandardFixtureParameters(const custom::flat_set<int>& s, int line, const char* function)
+   {
+      assertIndirect(s.size() == 7);
+      if (s.size() != 7)
+         return;
+      for (size_t i = 0; i < 7; i++)
+         assertIndirect(s.elements[i] == int(20 + 10 * i));
+   }
+};
+
+#endif // DEBUG
@@ -15,8 +15,10 @@
 #endif
 
 #include "testSet.h"        // for the set unit tests
+#include "testFlatSet.h"    // for the flat set unit tests
 #include "testBST.h"        // for the BST unit tests
 #include "testSpy.h"        // for the spy unit tests
+#include "testPool.h"       // for the pool allocator unit tests
 int Spy::counters[] = {};
 
 /**********************************************************************
@@ -28,8 +30,10 @@ int main()
 #ifdef DEBUG
    // unit tests
    TestSpy().run();
+   TestPool().run();
    TestBST().run();
    TestSet().run();
+   TestFlatSet().run();
 #endif // DEBUG
    
    return 0;
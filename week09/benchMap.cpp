@@ -0,0 +1,216 @@
+/***********************************************************************
+ * Source:
+ *    Bench Map
+ * Summary:
+ *    Time lookups in a map of NUM_KEYS int keys. Every lookup asks
+ *    for a key that is there, in a fixed scrambled order, and the
+ *    report is nanoseconds per lookup, and the heap each map takes
+ *    in bytes per key. The trees, flat_map, and the hash tables
+ *    are all there, with std::map and std::unordered_map as the
+ *    yardsticks.
+ *    Build the BenchMap project in Release, or:
+ *       g++ -O2 -std=c++14 benchMap.cpp
+ *    To see what logging every subscript costs, add -DMAP_TRACE
+ *    and send stdout to /dev/null. The report goes to stderr.
+ * Author
+ *    Noah Li, Steven Sellers, Josh Hamilton.
+ ************************************************************************/
+
+#include "map.h"            // for map
+#include "flat_map.h"       // for flat_map
+#include "unordered_map.h"  // for unordered_map
+#include "swiss.h"          // for swiss_map
+
+#include <chrono>           // for steady_clock
+#include <cstddef>          // for size_t
+#include <cstdlib>          // for malloc and free
+#include <iomanip>          // for setw and setprecision
+#include <iostream>         // for cerr
+#include <map>              // for std::map, the yardstick
+#include <new>              // for bad_alloc
+#include <unordered_map>    // for std::unordered_map, the other yardstick
+#include <vector>           // for the pairs to bulk load
+
+const size_t NUM_KEYS   = 1000000;   // keys in every map
+const int    NUM_PASSES = 5;         // lookups of every key
+
+/**********************************************************************
+ * KEY AT and PROBE AT
+ * The i'th key to add and the i'th key to look up. Two different
+ * fixed scrambles of 0 .. NUM_KEYS-1, so one lookup is no help
+ * finding the next, and nodes allocated one after another are not
+ * looked up one after another
+ ***********************************************************************/
+int keyAt(size_t i)
+{
+   return int((i * 7919) % NUM_KEYS);
+}
+
+int probeAt(size_t i)
+{
+   return int((i * 104729) % NUM_KEYS);
+}
+
+/**********************************************************************
+ * OPERATOR NEW and DELETE
+ * Keep a running count of the bytes on the heap. Each block
+ * carries its size in a 16-byte header, which keeps it aligned
+ ***********************************************************************/
+size_t bytesLive = 0;
+
+void * operator new (size_t num)
+{
+   size_t * p = static_cast<size_t *>(std::malloc(num + 16));
+   if (p == nullptr)
+      throw std::bad_alloc();
+   *p = num;
+   bytesLive += num;
+   return reinterpret_cast<char *>(p) + 16;
+}
+
+void operator delete (void * p) noexcept
+{
+   if (p == nullptr)
+      return;
+   size_t * pHeader = reinterpret_cast<size_t *>(static_cast<char *>(p) - 16);
+   bytesLive -= *pHeader;
+   std::free(pHeader);
+}
+
+void operator delete (void * p, size_t) noexcept
+{
+   operator delete (p);
+}
+
+/**********************************************************************
+ * REPORT BYTES
+ * What a map of NUM_KEYS keys holds on the heap, per key
+ ***********************************************************************/
+void reportBytes(const char * name, size_t bytes)
+{
+   std::cerr << std::left  << std::setw(36) << name
+             << std::right << std::setw(8)  << std::fixed << std::setprecision(2)
+             << double(bytes) / double(NUM_KEYS) << " bytes/key\n";
+}
+
+/**********************************************************************
+ * TIME LOOKUPS
+ * Call lookup on every key numPasses times, in the order given by
+ * order, and report the cost per call. The sum is printed so the
+ * lookups cannot be optimized away
+ ***********************************************************************/
+template <class Lookup>
+void timeLookups(const char * name, int numPasses, int (*order)(size_t), Lookup lookup)
+{
+   long long sum = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (int pass = 0; pass < numPasses; pass++)
+      for (size_t i = 0; i < NUM_KEYS; i++)
+         sum += lookup(order(i));
+   auto finish = std::chrono::steady_clock::now();
+
+   double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+   std::cerr << std::left  << std::setw(36) << name
+             << std::right << std::setw(8)  << std::fixed << std::setprecision(2)
+             << ns / (double(NUM_KEYS) * numPasses) << " ns/lookup"
+             << "   (sum " << sum << ")\n";
+}
+
+/**********************************************************************
+ * MAIN
+ * Fill each map with the same keys, then look every one up
+ ***********************************************************************/
+int main()
+{
+   std::cerr << NUM_KEYS << " keys, " << NUM_PASSES << " passes\n";
+
+   // subscript adds every key: one walk down the tree each
+   size_t bytesBefore = bytesLive;
+   custom::map<int, int> m;
+   timeLookups("map operator[] (insert)", 1, keyAt,
+               [&m](int key) { return m[key] = key; });
+   reportBytes("map", bytesLive - bytesBefore);
+
+   // subscript again: every key is found on the same one walk
+   timeLookups("map operator[] (hit)", NUM_PASSES, probeAt,
+               [&m](int key) { return m[key]; });
+
+   timeLookups("map find", NUM_PASSES, probeAt,
+               [&m](int key) { return (*m.find(key)).second; });
+
+   // bulk load: append every pair, then sort once
+   std::vector<custom::pair<int, int>> pairs;
+   pairs.reserve(NUM_KEYS);
+   for (size_t i = 0; i < NUM_KEYS; i++)
+      pairs.push_back(custom::pair<int, int>(keyAt(i), keyAt(i)));
+   bytesBefore = bytesLive;
+   custom::flat_map<int, int> mFlat;
+   mFlat.reserve(NUM_KEYS);
+   mFlat.insert(pairs.begin(), pairs.end());
+   reportBytes("flat_map", bytesLive - bytesBefore);
+
+   timeLookups("flat_map operator[] (hit)", NUM_PASSES, probeAt,
+               [&mFlat](int key) { return mFlat[key]; });
+
+   timeLookups("flat_map find", NUM_PASSES, probeAt,
+               [&mFlat](int key) { return (*mFlat.find(key)).second; });
+
+   // the same work in the standard library
+   bytesBefore = bytesLive;
+   std::map<int, int> mStd;
+   timeLookups("std::map operator[] (insert)", 1, keyAt,
+               [&mStd](int key) { return mStd[key] = key; });
+   reportBytes("std::map", bytesLive - bytesBefore);
+   timeLookups("std::map operator[] (hit)", NUM_PASSES, probeAt,
+               [&mStd](int key) { return mStd[key]; });
+
+   // Robin Hood probing over one flat slot array
+   bytesBefore = bytesLive;
+   custom::unordered_map<int, int> mHash;
+   timeLookups("unordered_map operator[] (insert)", 1, keyAt,
+               [&mHash](int key) { return mHash[key] = key; });
+   reportBytes("unordered_map", bytesLive - bytesBefore);
+
+   timeLookups("unordered_map operator[] (hit)", NUM_PASSES, probeAt,
+               [&mHash](int key) { return mHash[key]; });
+
+   timeLookups("unordered_map find", NUM_PASSES, probeAt,
+               [&mHash](int key) { return (*mHash.find(key)).second; });
+
+   // the same, with the room made up front
+   custom::unordered_map<int, int> mHashReserved;
+   mHashReserved.reserve(NUM_KEYS);
+   timeLookups("unordered_map (reserved) insert", 1, keyAt,
+               [&mHashReserved](int key) { return mHashReserved[key] = key; });
+
+   // control bytes matched sixteen at a time, keys touched only on a match
+   bytesBefore = bytesLive;
+   custom::swiss_map<int, int> mSwiss;
+   timeLookups("swiss_map operator[] (insert)", 1, keyAt,
+               [&mSwiss](int key) { return mSwiss[key] = key; });
+   reportBytes("swiss_map", bytesLive - bytesBefore);
+
+   timeLookups("swiss_map operator[] (hit)", NUM_PASSES, probeAt,
+               [&mSwiss](int key) { return mSwiss[key]; });
+
+   timeLookups("swiss_map find", NUM_PASSES, probeAt,
+               [&mSwiss](int key) { return (*mSwiss.find(key)).second; });
+
+   // the same, with the room made up front
+   custom::swiss_map<int, int> mSwissReserved;
+   mSwissReserved.reserve(NUM_KEYS);
+   timeLookups("swiss_map (reserved) insert", 1, keyAt,
+               [&mSwissReserved](int key) { return mSwissReserved[key] = key; });
+
+   // the standard library: a linked node per key
+   bytesBefore = bytesLive;
+   std::unordered_map<int, int> mHashStd;
+   timeLookups("std::unordered_map [] (insert)", 1, keyAt,
+               [&mHashStd](int key) { return mHashStd[key] = key; });
+   reportBytes("std::unordered_map", bytesLive - bytesBefore);
+
+   timeLookups("std::unordered_map [] (hit)", NUM_PASSES, probeAt,
+               [&mHashStd](int key) { return mHashStd[key]; });
+
+   return 0;
+}
@@ -28,10 +28,17 @@
 #endif // !DEBUG
 
 #include <cassert>
-#include <utility>
+#include <future>     // for std::async
+#include <system_error> // for std::system_error
+#include <thread>     // for std::thread::hardware_concurrency
 #include <memory>     // for std::allocator
 #include <functional> // for std::less
+#include <iterator>   // for std::iterator_traits
 #include <utility>    // for std::pair
+#include <new>        // for placement new
+#include <type_traits>// for std::is_trivially_destructible
+#include "pool.h"     // for releaseAll
+#include "pair.h"     // for in_place
 
 class TestBST; // forward declaration for unit tests
 class TestMap;
@@ -40,36 +47,49 @@ class TestSet;
 namespace custom
 {
 
-    template <class TT>
+    template <class TT, class AA>
     class set;
-    template <class KK, class VV>
+    template <class KK, class VV, class AA>
     class map;
 
+    /*****************************************************************
+     * ALLOCATES CONCURRENTLY
+     * Can several threads take nodes from copies of this allocator
+     * at once? std::allocator can. A pool_allocator cannot, since
+     * its copies share one pool with no lock
+     *****************************************************************/
+    template <class Alloc>
+    struct allocates_concurrently : std::false_type {};
+
+    template <class U>
+    struct allocates_concurrently<std::allocator<U>> : std::true_type {};
+
     /*****************************************************************
      * BINARY SEARCH TREE
-     * Create a Binary Search Tree
+     * Create a Binary Search Tree. The nodes come from A, rebound to BNode
      *****************************************************************/
-    template <typename T>
+    template <typename T, typename A = std::allocator<T>>
     class BST
     {
         friend class ::TestBST; // give unit tests access to the privates
         friend class ::TestMap;
         friend class ::TestSet;
 
-        template <class KK, class VV>
+        template <class KK, class VV, class AA>
         friend class map;
 
-        template <class TT>
+        template <class TT, class AA>
         friend class set;
 
-        template <class KK, class VV>
-        friend void swap(map<KK, VV>& lhs, map<KK, VV>& rhs);
+        template <class KK, class VV, class AA>
+        friend void swap(map<KK, VV, AA>& lhs, map<KK, VV, AA>& rhs);
     public:
         //
         // Construct
         //
 
         BST();
+        explicit BST(const A& a);
         BST(const BST& rhs);
         BST(BST&& rhs);
         BST(const std::initializer_list<T>& il);
@@ -97,6 +117,8 @@ namespace custom
         //
 
         iterator find(const T& t);
+        template <class Key>
+        iterator findKey(const Key& key) const;
 
         // 
         // Insert
@@ -104,6 +126,12 @@ namespace custom
 
         std::pair<iterator, bool> insert(const T& t, bool keepUnique = false);
         std::pair<iterator, bool> insert(T&& t, bool keepUnique = false);
+        template <class Key, class ... Args>
+        std::pair<iterator, bool> insertKey(const Key& key, Args&& ... args);
+        template <class Iterator>
+        void insert(Iterator first, Iterator last, bool keepUnique = false);
+        template <class Iterator>
+        void buildSorted(Iterator first, size_t num);
 
         //
         // Remove
@@ -123,13 +151,37 @@ namespace custom
     private:
 
         class BNode;
+        using NodeAlloc  = typename std::allocator_traits<A>::template rebind_alloc<BNode>;
+        using NodeTraits = std::allocator_traits<NodeAlloc>;
+
         BNode* root;              // root node of the binary search tree
         size_t numElements;        // number of elements currently in the tree
+        NodeAlloc alloc;           // where the nodes come from
+
+        // every node is created and destroyed through the allocator
+        template <class ... Args>
+        BNode* createNode(Args&& ... args);
+        void destroyNode(BNode* pNode) noexcept;
 
         // Bro Helfrich's stuff that he added.
         void deleteNode(BNode*& pDelete, bool toRight);
         void deleteBinaryTree(BNode*& pDelete) noexcept;
         void copyBinaryTree(const BNode* pSrc, BNode*& pDest);
+        BNode* copyParallel(const BNode* pSrc, int depthFork);
+        static int findDepthFork();
+        static const size_t numParallelCopy = 1 << 15; // smallest tree worth copying on threads
+        template <class Iterator>
+        BNode* buildBalanced(Iterator& it, size_t num, int depth, int depthRed);
+        static int findDepthRed(size_t num);
+
+        // red-black balancing after an erase
+        void balanceErase(BNode* pNode, BNode* pParent);
+        static bool isBlack(const BNode* pNode) { return pNode == nullptr || !pNode->isRed; }
+
+#ifdef DEBUG
+        // red-black validation for the unit tests
+        bool verifyRedBlack() const;
+#endif // DEBUG
     };
 
 
@@ -138,26 +190,25 @@ namespace custom
      * A single node in a binary tree. Note that the node does not know
      * anything about the properties of the tree so no validation can be done.
      *****************************************************************/
-    template <typename T>
-    class BST <T> ::BNode
+    template <typename T, typename A>
+    class BST <T, A> ::BNode
     {
     public:
         //
         // Construct
         //
-        BNode() : pLeft(nullptr), pRight(nullptr), pParent(nullptr), data() {} // from bnode
-        BNode(const T& t) : pLeft(nullptr), pRight(nullptr), pParent(nullptr), data(t) {}
-        BNode(T&& t) : pLeft(nullptr), pRight(nullptr), pParent(nullptr), data(std::move(t)) {}
+        BNode() : data(), pLeft(nullptr), pRight(nullptr), pParent(nullptr), isRed(true) {} // from bnode
+        BNode(const T& t) : data(t), pLeft(nullptr), pRight(nullptr), pParent(nullptr), isRed(true) {}
+        BNode(T&& t) : data(std::move(t)), pLeft(nullptr), pRight(nullptr), pParent(nullptr), isRed(true) {}
+        template <class ... Args>
+        BNode(in_place_t, Args&& ... args) : data(std::forward<Args>(args)...),
+                                             pLeft(nullptr), pRight(nullptr), pParent(nullptr), isRed(true) {}
 
         //
         // Insert
         //
         void addLeft(BNode* pNode);
         void addRight(BNode* pNode);
-        void addLeft(const T& t);
-        void addRight(const T& t);
-        void addLeft(T&& t);
-        void addRight(T&& t);
 
         // 
         // Status
@@ -165,6 +216,23 @@ namespace custom
         bool isRightChild(BNode* pNode) const { return pRight == pNode; } // Check if a node is the right child of its parent
         bool isLeftChild(BNode* pNode) const { return pLeft == pNode; } // Check if a node is the left child of its parent
 
+        //
+        // Balance
+        //
+        void balance();          // red-black fixup after this node was inserted
+        void rotateLeft();       // our right child takes our place
+        void rotateRight();      // our left child takes our place
+
+#ifdef DEBUG
+        //
+        // Verify
+        //
+        int    findHeight() const;
+        int    findBlackDepth() const;
+        bool   verifyRedBlack(int depth) const;
+        size_t computeSize() const;
+#endif // DEBUG
+
         //
         // Data
         //
@@ -179,17 +247,17 @@ namespace custom
      * BINARY SEARCH TREE ITERATOR
      * Forward and reverse iterator through a BST
      *********************************************************/
-    template <typename T>
-    class BST <T> ::iterator
+    template <typename T, typename A>
+    class BST <T, A> ::iterator
     {
         friend class ::TestBST; // give unit tests access to the privates
         friend class ::TestMap;
         friend class ::TestSet;
 
-        template <class KK, class VV>
+        template <class KK, class VV, class AA>
         friend class map;
 
-        template <class TT>
+        template <class TT, class AA>
         friend class set;
     public:
         // constructors and assignment
@@ -241,7 +309,10 @@ namespace custom
         }
 
         // must give friend status to remove so it can call getNode() from it
-        friend BST <T> ::iterator BST <T> ::erase(iterator& it);
+        friend BST <T, A> ::iterator BST <T, A> ::erase(iterator& it);
+
+        // insert needs the new node to balance the tree from there
+        friend class BST <T, A>;
 
     private:
 
@@ -262,8 +333,19 @@ namespace custom
      /*********************************************
       * BST :: DEFAULT CONSTRUCTOR
       ********************************************/
-    template <typename T>
-    BST <T> ::BST()
+    template <typename T, typename A>
+    BST <T, A> ::BST() : alloc()
+    {
+        root = nullptr;
+        numElements = 0;
+    }
+
+    /*********************************************
+     * BST :: ALLOCATOR CONSTRUCTOR
+     * An empty tree whose nodes come from a
+     ********************************************/
+    template <typename T, typename A>
+    BST <T, A> ::BST(const A& a) : alloc(a)
     {
         root = nullptr;
         numElements = 0;
@@ -273,8 +355,9 @@ namespace custom
      * BST :: COPY CONSTRUCTOR
      * Copy one tree to another
      ********************************************/
-    template <typename T>
-    BST <T> ::BST(const BST<T>& rhs)
+    template <typename T, typename A>
+    BST <T, A> ::BST(const BST <T, A>& rhs) :
+        alloc(NodeTraits::select_on_container_copy_construction(rhs.alloc))
     {
         root = nullptr;
         numElements = 0;
@@ -287,8 +370,8 @@ namespace custom
      * BST :: MOVE CONSTRUCTOR
      * Move one tree to another
      ********************************************/
-    template <typename T>
-    BST <T> ::BST(BST <T>&& rhs)
+    template <typename T, typename A>
+    BST <T, A> ::BST(BST <T, A>&& rhs) : alloc(rhs.alloc)
     {
         // blank slate
         root = nullptr;
@@ -307,8 +390,8 @@ namespace custom
      * BST :: INITIALIZER LIST CONSTRUCTOR
      * Create a BST from an initializer list
      ********************************************/
-    template <typename T>
-    BST <T> ::BST(const std::initializer_list<T>& il)
+    template <typename T, typename A>
+    BST <T, A> ::BST(const std::initializer_list<T>& il) : alloc()
     {
         root = nullptr;
         numElements = 0;
@@ -322,8 +405,8 @@ namespace custom
     /*********************************************
      * BST :: DESTRUCTOR
      ********************************************/
-    template <typename T>
-    BST <T> :: ~BST()
+    template <typename T, typename A>
+    BST <T, A> :: ~BST()
     {
         clear();
     }
@@ -333,11 +416,15 @@ namespace custom
      * BST :: ASSIGNMENT OPERATOR
      * Copy one tree to another
      ********************************************/
-    template <typename T>
-    BST <T>& BST <T> :: operator = (const BST <T>& rhs)
+    template <typename T, typename A>
+    BST <T, A>& BST <T, A> :: operator = (const BST <T, A>& rhs)
     {
-        // Copy the binary tree from rhs to this tree
-        copyBinaryTree(rhs.root, this->root);
+        // Copy the binary tree from rhs to this tree. A big tree going
+        // into an empty one has no nodes to reuse, so copy it on threads
+        if (nullptr == this->root && rhs.numElements >= numParallelCopy && allocates_concurrently<NodeAlloc>::value)
+            this->root = copyParallel(rhs.root, findDepthFork());
+        else
+            copyBinaryTree(rhs.root, this->root);
         // Ensure the root's parent is null (root nodes should not have parents)
         assert(nullptr == this->root || this->root->pParent == nullptr);
         // Copy the number of elements
@@ -351,8 +438,8 @@ namespace custom
      * BST :: ASSIGNMENT OPERATOR with INITIALIZATION LIST
      * Copy nodes onto a BTree
      ********************************************/
-    template <typename T>
-    BST <T>& BST <T> :: operator = (const std::initializer_list<T>& il)
+    template <typename T, typename A>
+    BST <T, A>& BST <T, A> :: operator = (const std::initializer_list<T>& il)
     {
         // Delete the existing tree
         deleteBinaryTree(root);
@@ -372,8 +459,8 @@ namespace custom
      * BST :: ASSIGN-MOVE OPERATOR
      * Move one tree to another
      ********************************************/
-    template <typename T>
-    BST <T>& BST <T> :: operator = (BST <T>&& rhs)
+    template <typename T, typename A>
+    BST <T, A>& BST <T, A> :: operator = (BST <T, A>&& rhs)
     {
         //clear the old bst
         clear();
@@ -388,19 +475,20 @@ namespace custom
      * BST :: SWAP
      * Swap two trees
      ********************************************/
-    template <typename T>
-    void BST <T> ::swap(BST <T>& rhs)
+    template <typename T, typename A>
+    void BST <T, A> ::swap(BST <T, A>& rhs)
     {
         std::swap(rhs.root, root);
         std::swap(rhs.numElements, numElements);
+        std::swap(rhs.alloc, alloc);
     }
 
     /*****************************************************
      * BST :: INSERT
      * Insert a node at a given location in the tree
      ****************************************************/
-    template <typename T>
-    std::pair<typename BST <T> ::iterator, bool> BST <T> ::insert(const T& t, bool keepUnique)
+    template <typename T, typename A>
+    std::pair<typename BST <T, A> ::iterator, bool> BST <T, A> ::insert(const T& t, bool keepUnique)
     {
         std::pair<iterator, bool> pairReturn(end(), false);
         try
@@ -409,7 +497,8 @@ namespace custom
             if (root == nullptr)
             {
                 assert(numElements == 0); // Ensure tree is indeed empty
-                root = new BNode(t); // Create the root node
+                root = createNode(t); // Create the root node
+                root->isRed = false; // The root is always black
                 numElements = 1; // Increment number of elements
                 pairReturn.first = iterator(root); // Set the iterator to the root
                 pairReturn.second = true; // Indicate that the insertion was successful
@@ -438,7 +527,7 @@ namespace custom
                     }
                     else
                     {
-                        node->addLeft(t); // Add new node as left child
+                        node->addLeft(createNode(t)); // Add new node as left child
                         done = true; // Insertion done
                         pairReturn.first = iterator(node->pLeft); // Set iterator to new node
                         pairReturn.second = true; // Indicate success
@@ -453,7 +542,7 @@ namespace custom
                     }
                     else
                     {
-                        node->addRight(t); // Add new node as right child
+                        node->addRight(createNode(t)); // Add new node as right child
                         done = true; // Insertion done
                         pairReturn.first = iterator(node->pRight); // Set iterator to new node
                         pairReturn.second = true; // Indicate success
@@ -463,6 +552,9 @@ namespace custom
             assert(root != nullptr); // Ensure root is not lost
             numElements++; // Increment the element count
 
+            // Restore the red-black properties, possibly rotating the root away
+            pairReturn.first.pNode->balance();
+
             // If we lost the root, find it
             while (root->pParent != nullptr)
                 root = root->pParent;
@@ -475,8 +567,8 @@ namespace custom
         return pairReturn;
     }
 
-    template <typename T>
-    std::pair<typename BST <T> ::iterator, bool> BST <T> ::insert(T&& t, bool keepUnique)
+    template <typename T, typename A>
+    std::pair<typename BST <T, A> ::iterator, bool> BST <T, A> ::insert(T&& t, bool keepUnique)
     {
         std::pair<iterator, bool> pairReturn(end(), false);
         try
@@ -485,7 +577,8 @@ namespace custom
             if (root == nullptr)
             {
                 assert(numElements == 0); // Ensure tree is indeed empty
-                root = new BNode(std::move(t)); // Create the root node with moved value
+                root = createNode(std::move(t)); // Create the root node with moved value
+                root->isRed = false; // The root is always black
                 numElements = 1; // Increment number of elements
                 pairReturn.first = iterator(root); // Set the iterator to the root
                 pairReturn.second = true; // Indicate that the insertion was successful
@@ -514,7 +607,7 @@ namespace custom
                     }
                     else
                     {
-                        node->addLeft(std::move(t)); // Add new node as left child with moved value
+                        node->addLeft(createNode(std::move(t))); // Add new node as left child with moved value
                         done = true; // Insertion done
                         pairReturn.first = iterator(node->pLeft); // Set iterator to new node
                         pairReturn.second = true; // Indicate success
@@ -529,7 +622,7 @@ namespace custom
                     }
                     else
                     {
-                        node->addRight(std::move(t)); // Add new node as right child with moved value
+                        node->addRight(createNode(std::move(t))); // Add new node as right child with moved value
                         done = true; // Insertion done
                         pairReturn.first = iterator(node->pRight); // Set iterator to new node
                         pairReturn.second = true; // Indicate success
@@ -539,6 +632,9 @@ namespace custom
             assert(root != nullptr); // Ensure root is not lost
             numElements++; // Increment the element count
 
+            // Restore the red-black properties, possibly rotating the root away
+            pairReturn.first.pNode->balance();
+
             // If we lost the root, find it
             while (root->pParent != nullptr)
                 root = root->pParent;
@@ -551,12 +647,176 @@ namespace custom
         return pairReturn;
     }
 
+    /*****************************************************
+     * BST :: INSERT KEY
+     * Find the element matching key, or build a new one from args
+     * if there is none. The key is compared directly against the
+     * stored data so nothing is constructed unless we insert
+     ****************************************************/
+    template <typename T, typename A>
+    template <class Key, class ... Args>
+    std::pair<typename BST <T, A> ::iterator, bool> BST <T, A> ::insertKey(const Key& key, Args&& ... args)
+    {
+        // Walk down until we find the key or fall off the tree
+        BNode* pParent = nullptr;
+        bool toLeft = false;
+        for (BNode* p = root; p != nullptr; p = (toLeft ? p->pLeft : p->pRight))
+        {
+            if (p->data == key)
+                return std::pair<iterator, bool>(iterator(p), false);
+            toLeft = key < p->data;
+            pParent = p;
+        }
+
+        BNode* pNew = nullptr;
+        try
+        {
+            pNew = createNode(in_place, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            throw "ERROR: unable to allocate node"; // Handle allocation errors
+        }
+
+        // Hang the new node where the search fell off
+        if (pParent == nullptr)
+            root = pNew;
+        else if (toLeft)
+            pParent->addLeft(pNew);
+        else
+            pParent->addRight(pNew);
+        numElements++;
+
+        // Restore the red-black properties and find the root again
+        pNew->balance();
+        while (root->pParent != nullptr)
+            root = root->pParent;
+
+        return std::pair<iterator, bool>(iterator(pNew), true);
+    }
+
+    /*****************************************************
+     * BST :: INSERT RANGE
+     * Insert everything in [first, last). When the tree is empty and
+     * the range is already sorted, the tree is built directly in
+     * linear time rather than with one walk per element
+     ****************************************************/
+    template <typename T, typename A>
+    template <class Iterator>
+    void BST <T, A> ::insert(Iterator first, Iterator last, bool keepUnique)
+    {
+        // A single-pass range can only be inserted one at a time
+        using Category = typename std::iterator_traits<Iterator>::iterator_category;
+        if (!std::is_base_of<std::forward_iterator_tag, Category>::value)
+        {
+            for (; first != last; ++first)
+                insert(*first, keepUnique);
+            return;
+        }
+
+        // Count the range and check whether it is in order
+        size_t num = 0;
+        bool isSorted = true;
+        Iterator itPrev = first;
+        for (Iterator it = first; it != last; ++it, ++num)
+        {
+            if (num != 0 && isSorted)
+                isSorted = (keepUnique ? *itPrev < *it : !(*it < *itPrev));
+            itPrev = it;
+        }
+
+        if (root == nullptr && isSorted)
+        {
+            buildSorted(first, num);
+            return;
+        }
+
+        for (Iterator it = first; it != last; ++it)
+            insert(*it, keepUnique);
+    }
+
+    /*****************************************************
+     * BST :: BUILD SORTED
+     * Replace the tree with the num sorted elements from first. The
+     * result is perfectly balanced and colored so that it is a valid
+     * red-black tree. The caller guarantees the order
+     ****************************************************/
+    template <typename T, typename A>
+    template <class Iterator>
+    void BST <T, A> ::buildSorted(Iterator first, size_t num)
+    {
+        clear();
+        root = buildBalanced(first, num, 0, findDepthRed(num));
+        numElements = num;
+    }
+
+    /*****************************************************
+     * BST :: BUILD BALANCED
+     * Build a subtree from the next num elements of it, in order.
+     * Every node is black except those at depthRed
+     ****************************************************/
+    template <typename T, typename A>
+    template <class Iterator>
+    typename BST <T, A> ::BNode* BST <T, A> ::buildBalanced(Iterator& it, size_t num, int depth, int depthRed)
+    {
+        if (num == 0)
+            return nullptr;
+
+        // The left half comes first in order, then us, then the right half
+        size_t numLeft = num / 2;
+        BNode* pLeft = buildBalanced(it, numLeft, depth + 1, depthRed);
+
+        BNode* pNode = nullptr;
+        try
+        {
+            pNode = createNode(*it);
+        }
+        catch (...)
+        {
+            deleteBinaryTree(pLeft);
+            throw "ERROR: Unable to allocate a node";
+        }
+        ++it;
+        pNode->isRed = (depth == depthRed);
+        pNode->addLeft(pLeft);
+
+        try
+        {
+            pNode->addRight(buildBalanced(it, num - numLeft - 1, depth + 1, depthRed));
+        }
+        catch (...)
+        {
+            deleteBinaryTree(pNode);
+            throw;
+        }
+        return pNode;
+    }
+
+    /*****************************************************
+     * BST :: FIND DEPTH RED
+     * A balanced tree of num nodes is full down to some depth. Any
+     * nodes on the partial level below that are red, which keeps the
+     * black depth the same on every path. Returns -1 if there are none
+     ****************************************************/
+    template <typename T, typename A>
+    int BST <T, A> ::findDepthRed(size_t num)
+    {
+        int depth = -1;
+        size_t numFull = 0;
+        while (numFull * 2 + 1 <= num)
+        {
+            numFull = numFull * 2 + 1;
+            depth++;
+        }
+        return (numFull == num ? -1 : depth + 1);
+    }
+
     /*************************************************
      * BST :: ERASE
      * Remove a given node as specified by the iterator
      ************************************************/
-    template <typename T>
-    typename BST <T> ::iterator BST <T> ::erase(iterator& it)
+    template <typename T, typename A>
+    typename BST <T, A> ::iterator BST <T, A> ::erase(iterator& it)
     {
         if (it == end())
         {
@@ -566,10 +826,17 @@ namespace custom
         iterator itNext = it; // Iterator to return the next node
         BNode* pDelete = it.pNode; // Node to delete
 
+        // Red-black bookkeeping: the color taken out of the tree, the node
+        // that moved into its place (possibly nullptr), and that spot's parent
+        bool removedRed = pDelete->isRed;
+        BNode* pFix = nullptr;
+        BNode* pFixParent = pDelete->pParent;
+
         // Case 1: Node has no left child
         if (pDelete->pLeft == nullptr)
         {
             itNext++; // Move to next node
+            pFix = pDelete->pRight;
             if (pDelete->pParent)
             {
                 // Reattach the parent's pointer to the right child
@@ -601,6 +868,7 @@ namespace custom
         else if (pDelete->pRight == nullptr)
         {
             itNext++; // Move to next node
+            pFix = pDelete->pLeft;
             if (pDelete->pParent)
             {
                 // Reattach the parent's pointer to the left child
@@ -637,6 +905,12 @@ namespace custom
                 pIOS = pIOS->pLeft;
             }
 
+            // The successor leaves its old spot and inherits our color
+            removedRed = pIOS->isRed;
+            pIOS->isRed = pDelete->isRed;
+            pFix = pIOS->pRight;
+            pFixParent = (pIOS->pParent == pDelete ? pIOS : pIOS->pParent);
+
             if (pIOS->pParent != pDelete)
             {
                 // Reattach the in-order successor's parent to its right child
@@ -683,9 +957,13 @@ namespace custom
             itNext = iterator(pIOS); // Set iterator to the in-order successor
         }
 
-        delete pDelete; // Delete the node
+        destroyNode(pDelete); // Delete the node
         numElements--; // Decrement the number of elements
 
+        // Removing a black node shortens one path; restore the black depth
+        if (!removedRed)
+            balanceErase(pFix, pFixParent);
+
         return itNext; // Return the iterator to the next node
     }
 
@@ -693,12 +971,16 @@ namespace custom
      * BST :: CLEAR
      * Removes all the BNodes from a tree
      ****************************************************/
-    template <typename T>
-    void BST <T> ::clear() noexcept
+    template <typename T, typename A>
+    void BST <T, A> ::clear() noexcept
     {
         if (root)
         {
-            deleteBinaryTree(root); // Delete all nodes recursively
+            // Nodes with nothing to destroy can go back to a private pool all at once
+            if (std::is_trivially_destructible<BNode>::value && releaseAll(alloc))
+                root = nullptr;
+            else
+                deleteBinaryTree(root); // Delete all nodes recursively
         }
         numElements = 0; // Reset the number of elements
     }
@@ -707,8 +989,8 @@ namespace custom
      * BST :: BEGIN
      * Return the first node (left-most) in a binary search tree
      ****************************************************/
-    template <typename T>
-    typename BST <T> ::iterator custom::BST <T> ::begin() const noexcept
+    template <typename T, typename A>
+    typename BST <T, A> ::iterator custom::BST <T, A> ::begin() const noexcept
     {
         if (root == nullptr)
             return end(); // If tree is empty, return end iterator
@@ -725,8 +1007,8 @@ namespace custom
      * BST :: FIND
      * Return the node corresponding to a given value
      ****************************************************/
-    template <typename T>
-    typename BST <T> ::iterator BST<T> ::find(const T& t)
+    template <typename T, typename A>
+    typename BST <T, A> ::iterator BST <T, A> ::find(const T& t)
     {
         // Start the search from the root node
         for (BNode* p = root; p != nullptr; p = (t < p->data ? p->pLeft : p->pRight))
@@ -743,6 +1025,149 @@ namespace custom
 
     }
 
+    /****************************************************
+     * BST :: FIND KEY
+     * Return the node matching a key, where the key is anything
+     * that compares against T (such as the key of a pair)
+     ****************************************************/
+    template <typename T, typename A>
+    template <class Key>
+    typename BST <T, A> ::iterator BST <T, A> ::findKey(const Key& key) const
+    {
+        for (BNode* p = root; p != nullptr; p = (key < p->data ? p->pLeft : p->pRight))
+        {
+            if (p->data == key)
+                return iterator(p);
+        }
+
+        return end();
+    }
+
+    /*****************************************************
+     * BST :: BALANCE ERASE
+     * A black node was removed from above pNode (which may be nullptr)
+     * so every path through pNode is one black node short. Push the
+     * shortage up the tree or fix it with a rotation.
+     ****************************************************/
+    template <typename T, typename A>
+    void BST <T, A> ::balanceErase(BNode* pNode, BNode* pParent)
+    {
+        while (pNode != root && isBlack(pNode))
+        {
+            assert(pParent != nullptr);
+            if (pParent->pLeft == pNode)
+            {
+                BNode* pSibling = pParent->pRight;
+                assert(pSibling != nullptr);
+
+                // Case 1: red sibling. Rotate so our sibling is black
+                if (pSibling->isRed)
+                {
+                    pSibling->isRed = false;
+                    pParent->isRed = true;
+                    pParent->rotateLeft();
+                    if (root == pParent)
+                        root = pSibling;
+                    pSibling = pParent->pRight;
+                }
+
+                // Case 2: black sibling with black children. Recolor and move up
+                if (isBlack(pSibling->pLeft) && isBlack(pSibling->pRight))
+                {
+                    pSibling->isRed = true;
+                    pNode = pParent;
+                    pParent = pNode->pParent;
+                }
+                else
+                {
+                    // Case 3: the sibling's far child is black. Turn it into case 4
+                    if (isBlack(pSibling->pRight))
+                    {
+                        pSibling->pLeft->isRed = false;
+                        pSibling->isRed = true;
+                        pSibling->rotateRight();
+                        pSibling = pParent->pRight;
+                    }
+
+                    // Case 4: the sibling's far child is red. One rotation finishes
+                    pSibling->isRed = pParent->isRed;
+                    pParent->isRed = false;
+                    pSibling->pRight->isRed = false;
+                    pParent->rotateLeft();
+                    if (root == pParent)
+                        root = pSibling;
+                    pNode = root;
+                }
+            }
+            else
+            {
+                BNode* pSibling = pParent->pLeft;
+                assert(pSibling != nullptr);
+
+                // Case 1: red sibling. Rotate so our sibling is black
+                if (pSibling->isRed)
+                {
+                    pSibling->isRed = false;
+                    pParent->isRed = true;
+                    pParent->rotateRight();
+                    if (root == pParent)
+                        root = pSibling;
+                    pSibling = pParent->pLeft;
+                }
+
+                // Case 2: black sibling with black children. Recolor and move up
+                if (isBlack(pSibling->pLeft) && isBlack(pSibling->pRight))
+                {
+                    pSibling->isRed = true;
+                    pNode = pParent;
+                    pParent = pNode->pParent;
+                }
+                else
+                {
+                    // Case 3: the sibling's far child is black. Turn it into case 4
+                    if (isBlack(pSibling->pLeft))
+                    {
+                        pSibling->pRight->isRed = false;
+                        pSibling->isRed = true;
+                        pSibling->rotateLeft();
+                        pSibling = pParent->pLeft;
+                    }
+
+                    // Case 4: the sibling's far child is red. One rotation finishes
+                    pSibling->isRed = pParent->isRed;
+                    pParent->isRed = false;
+                    pSibling->pLeft->isRed = false;
+                    pParent->rotateRight();
+                    if (root == pParent)
+                        root = pSibling;
+                    pNode = root;
+                }
+            }
+        }
+
+        if (pNode)
+            pNode->isRed = false;
+    }
+
+#ifdef DEBUG
+    /*****************************************************
+     * BST :: VERIFY RED BLACK
+     * The root is black, no red node has a red child, every path
+     * has the same number of black nodes, and the size is right
+     ****************************************************/
+    template <typename T, typename A>
+    bool BST <T, A> ::verifyRedBlack() const
+    {
+        if (root == nullptr)
+            return numElements == 0;
+
+        return !root->isRed &&
+               root->pParent == nullptr &&
+               root->verifyRedBlack(root->findBlackDepth()) &&
+               root->computeSize() == numElements;
+    }
+#endif // DEBUG
+
     /******************************************************
      ******************************************************
      ******************************************************
@@ -756,8 +1181,8 @@ namespace custom
       * BINARY NODE :: ADD LEFT
       * Add a node to the left of the current node
       ******************************************************/
-    template <typename T>
-    void BST <T> ::BNode::addLeft(BNode* pNode)
+    template <typename T, typename A>
+    void BST <T, A> ::BNode::addLeft(BNode* pNode)
     {
         pLeft = pNode;
         if (pNode)
@@ -768,118 +1193,259 @@ namespace custom
      * BINARY NODE :: ADD RIGHT
      * Add a node to the right of the current node
      ******************************************************/
-    template <typename T>
-    void BST <T> ::BNode::addRight(BNode* pNode)
+    template <typename T, typename A>
+    void BST <T, A> ::BNode::addRight(BNode* pNode)
     {
         pRight = pNode;
         if (pNode)
             pNode->pParent = this;
     }
 
+
+
     /******************************************************
-     * BINARY NODE :: ADD LEFT
-     * Add a node to the left of the current node
+     * BINARY NODE :: BALANCE
+     * This node was just inserted red. Fix any red-red violation
+     * with the parent by recoloring or rotating.
      ******************************************************/
-    template <typename T>
-    void BST<T> ::BNode::addLeft(const T& t)
+    template <typename T, typename A>
+    void BST <T, A> ::BNode::balance()
     {
-        assert(pLeft == nullptr);
+        // Case 1: we are the root. Color ourselves black and call it a day
+        if (pParent == nullptr)
+        {
+            isRed = false;
+            return;
+        }
 
-        try
+        // Case 2: our parent is black. Nothing to do
+        if (!pParent->isRed)
+            return;
+
+        // A red parent without a parent of its own is a red root
+        BNode* pGranny = pParent->pParent;
+        if (pGranny == nullptr)
         {
-            BNode* pNode = new BNode(t);
-            addLeft(pNode);
+            pParent->isRed = false;
+            return;
         }
-        catch (...)
+        BNode* pAunt = (pGranny->isLeftChild(pParent) ? pGranny->pRight : pGranny->pLeft);
+
+        // Case 3: parent and aunt are red. Push the red up to granny
+        if (pAunt != nullptr && pAunt->isRed)
         {
-            throw "ERROR: Unable to allocate a node";
+            pParent->isRed = false;
+            pAunt->isRed = false;
+            pGranny->isRed = true;
+            pGranny->balance();
+            return;
         }
+
+        // Case 4: black aunt. An inner grandchild is first rotated outside...
+        BNode* pNode = this;
+        if (pGranny->isLeftChild(pParent) && pParent->isRightChild(this))
+        {
+            pParent->rotateLeft();
+            pNode = pLeft;
+        }
+        else if (pGranny->isRightChild(pParent) && pParent->isLeftChild(this))
+        {
+            pParent->rotateRight();
+            pNode = pRight;
+        }
+
+        // ...then granny rotates down under the parent and they swap colors
+        BNode* pTop = pNode->pParent;
+        if (pGranny->isLeftChild(pTop))
+            pGranny->rotateRight();
+        else
+            pGranny->rotateLeft();
+        pTop->isRed = false;
+        pGranny->isRed = true;
     }
 
     /******************************************************
-     * BINARY NODE :: ADD LEFT
-     * Add a node to the left of the current node
+     * BINARY NODE :: ROTATE LEFT
+     * Our right child takes our place and we become its left child
      ******************************************************/
-    template <typename T>
-    void BST<T> ::BNode::addLeft(T&& t)
+    template <typename T, typename A>
+    void BST <T, A> ::BNode::rotateLeft()
     {
-        assert(pLeft == nullptr);
+        BNode* pPivot = pRight;
+        assert(pPivot != nullptr);
 
-        try
-        {
-            BNode* pNode = new BNode(std::move(t));
-            addLeft(pNode);
-        }
-        catch (...)
+        // Our parent adopts the pivot in our place
+        if (pParent)
         {
-            throw "ERROR: Unable to allocate a node";
+            if (pParent->isLeftChild(this))
+                pParent->pLeft = pPivot;
+            else
+                pParent->pRight = pPivot;
         }
+        pPivot->pParent = pParent;
+
+        // The pivot's left subtree moves over to us
+        addRight(pPivot->pLeft);
+        pPivot->addLeft(this);
     }
 
     /******************************************************
-     * BINARY NODE :: ADD RIGHT
-     * Add a node to the right of the current node
+     * BINARY NODE :: ROTATE RIGHT
+     * Our left child takes our place and we become its right child
      ******************************************************/
-    template <typename T>
-    void BST <T> ::BNode::addRight(const T& t)
+    template <typename T, typename A>
+    void BST <T, A> ::BNode::rotateRight()
     {
-        assert(pRight == nullptr);
+        BNode* pPivot = pLeft;
+        assert(pPivot != nullptr);
 
-        try
-        {
-            BNode* pNode = new BNode(t);
-            addRight(pNode);
-        }
-        catch (...)
+        // Our parent adopts the pivot in our place
+        if (pParent)
         {
-            throw "ERROR: Unable to allocate a node";
+            if (pParent->isLeftChild(this))
+                pParent->pLeft = pPivot;
+            else
+                pParent->pRight = pPivot;
         }
+        pPivot->pParent = pParent;
+
+        // The pivot's right subtree moves over to us
+        addLeft(pPivot->pRight);
+        pPivot->addRight(this);
     }
 
+#ifdef DEBUG
     /******************************************************
-     * BINARY NODE :: ADD RIGHT
-     * Add a node to the right of the current node
+     * BINARY NODE :: FIND HEIGHT
+     * The number of nodes on the longest path down from here
      ******************************************************/
-    template <typename T>
-    void BST <T> ::BNode::addRight(T&& t)
+    template <typename T, typename A>
+    int BST <T, A> ::BNode::findHeight() const
     {
-        assert(pRight == nullptr);
+        int heightLeft = (pLeft ? pLeft->findHeight() : 0);
+        int heightRight = (pRight ? pRight->findHeight() : 0);
+        return 1 + (heightLeft > heightRight ? heightLeft : heightRight);
+    }
+
+    /******************************************************
+     * BINARY NODE :: FIND BLACK DEPTH
+     * The number of black nodes down the left-most path
+     ******************************************************/
+    template <typename T, typename A>
+    int BST <T, A> ::BNode::findBlackDepth() const
+    {
+        int depth = 0;
+        for (const BNode* p = this; p; p = p->pLeft)
+            if (!p->isRed)
+                depth++;
+        return depth;
+    }
+
+    /******************************************************
+     * BINARY NODE :: VERIFY RED BLACK
+     * Every path below must have depth black nodes, no red node may
+     * have a red child, and the parent pointers must be consistent
+     ******************************************************/
+    template <typename T, typename A>
+    bool BST <T, A> ::BNode::verifyRedBlack(int depth) const
+    {
+        if (!isRed)
+            depth--;
+
+        // Red nodes cannot have red children
+        if (isRed && ((pLeft && pLeft->isRed) || (pRight && pRight->isRed)))
+            return false;
 
+        // The children must point back to us
+        if ((pLeft && pLeft->pParent != this) || (pRight && pRight->pParent != this))
+            return false;
+
+        // A missing child ends a path: all black nodes must be used up
+        if ((!pLeft || !pRight) && depth != 0)
+            return false;
+
+        return (!pLeft  || pLeft->verifyRedBlack(depth)) &&
+               (!pRight || pRight->verifyRedBlack(depth));
+    }
+
+    /******************************************************
+     * BINARY NODE :: COMPUTE SIZE
+     * The number of nodes in this subtree
+     ******************************************************/
+    template <typename T, typename A>
+    size_t BST <T, A> ::BNode::computeSize() const
+    {
+        return 1 + (pLeft ? pLeft->computeSize() : 0) + (pRight ? pRight->computeSize() : 0);
+    }
+#endif // DEBUG
+
+    /**************************************************
+     * BST :: CREATE NODE
+     * Allocate a node and build it from args
+     *************************************************/
+    template <typename T, typename A>
+    template <class ... Args>
+    typename BST <T, A> ::BNode* BST <T, A> ::createNode(Args&& ... args)
+    {
+        BNode* pNode = NodeTraits::allocate(alloc, 1);
         try
         {
-            BNode* pNode = new BNode(std::move(t));
-            addRight(pNode);
+            ::new (static_cast<void*>(pNode)) BNode(std::forward<Args>(args)...);
         }
         catch (...)
         {
-            throw "ERROR: Unable to allocate a node";
+            NodeTraits::deallocate(alloc, pNode, 1);
+            throw;
         }
+        return pNode;
     }
 
-
+    /**************************************************
+     * BST :: DESTROY NODE
+     * Destroy a node and give its memory back
+     *************************************************/
+    template <typename T, typename A>
+    void BST <T, A> ::destroyNode(BNode* pNode) noexcept
+    {
+        pNode->~BNode();
+        NodeTraits::deallocate(alloc, pNode, 1);
+    }
 
     /**************************************************
        * BST node :: deletebinary tree
-       *
+       * Rotate each left child up into pDelete's place until
+       * it has none, then delete pDelete and go right. No
+       * recursion and no extra memory, however tall the tree.
        *************************************************/
-    template <typename T>
-    void BST <T> ::deleteBinaryTree(BNode*& pDelete) noexcept
+    template <typename T, typename A>
+    void BST <T, A> ::deleteBinaryTree(BNode*& pDelete) noexcept
     {
-        if (pDelete == nullptr)
-            return;
-        deleteBinaryTree(pDelete->pLeft);
-        deleteBinaryTree(pDelete->pRight);
-
-        delete pDelete;
-        pDelete = nullptr;
+        while (pDelete != nullptr)
+        {
+            if (pDelete->pLeft != nullptr)
+            {
+                BNode* pLeft = pDelete->pLeft;
+                pDelete->pLeft = pLeft->pRight;
+                pLeft->pRight = pDelete;
+                pDelete = pLeft;
+            }
+            else
+            {
+                BNode* pDead = pDelete;
+                pDelete = pDelete->pRight;
+                destroyNode(pDead);
+            }
+        }
     }
 
     /**************************************************
      * BST node :: copy binary tree
-     *
+     * Walk pSrc and pDest in step, reusing the nodes pDest
+     * already has. Down the left side, then the right, then
+     * up the parent pointers until we leave a left child.
      *************************************************/
-    template <typename T>
-    void BST <T> ::copyBinaryTree(const BNode* pSrc, BNode*& pDest)
+    template <typename T, typename A>
+    void BST <T, A> ::copyBinaryTree(const BNode* pSrc, BNode*& pDest)
     {
         if (pSrc == nullptr)
         {
@@ -887,36 +1453,180 @@ namespace custom
             return;
         }
 
-        assert(pSrc);
         try
         {
             if (nullptr == pDest)
-                pDest = new BST::BNode(pSrc->data);
-
+                pDest = createNode(pSrc->data);
             else
                 pDest->data = pSrc->data;
+            pDest->isRed = pSrc->isRed;
+
+            const BNode* pS = pSrc;
+            BNode* pD = pDest;
+            bool leftDone = false;
+            while (true)
+            {
+                // the left side first
+                if (!leftDone)
+                {
+                    if (pS->pLeft)
+                    {
+                        if (nullptr == pD->pLeft)
+                            pD->addLeft(createNode(pS->pLeft->data));
+                        else
+                        {
+                            pD->pLeft->data = pS->pLeft->data;
+                            pD->pLeft->pParent = pD;
+                        }
+                        pD->pLeft->isRed = pS->pLeft->isRed;
+                        pS = pS->pLeft;
+                        pD = pD->pLeft;
+                        continue;
+                    }
+                    deleteBinaryTree(pD->pLeft);
+                }
+
+                // then the right side
+                if (pS->pRight)
+                {
+                    if (nullptr == pD->pRight)
+                        pD->addRight(createNode(pS->pRight->data));
+                    else
+                    {
+                        pD->pRight->data = pS->pRight->data;
+                        pD->pRight->pParent = pD;
+                    }
+                    pD->pRight->isRed = pS->pRight->isRed;
+                    pS = pS->pRight;
+                    pD = pD->pRight;
+                    leftDone = false;
+                    continue;
+                }
+                deleteBinaryTree(pD->pRight);
+
+                // both done: climb past every node whose right side is done
+                bool fromLeft = false;
+                while (!fromLeft)
+                {
+                    if (pS == pSrc)
+                        return;
+                    fromLeft = (pS->pParent->pLeft == pS);
+                    pS = pS->pParent;
+                    pD = pD->pParent;
+                }
+                leftDone = true;
+            }
+        }
+        catch (...)
+        {
+            throw "ERROR: Unable to allocate a node";
+        }
+    }
+
+    /**************************************************
+     * BST node :: copy parallel
+     * Copy pSrc into a new tree. Above depthFork levels the left
+     * subtree goes to another thread while this one does the
+     * right; below that each thread runs copyBinaryTree. The
+     * red-black tree keeps the pieces within a factor of two
+     *************************************************/
+    template <typename T, typename A>
+    typename BST <T, A> ::BNode* BST <T, A> ::copyParallel(const BNode* pSrc, int depthFork)
+    {
+        BNode* pDest = nullptr;
+        if (depthFork <= 0 || nullptr == pSrc)
+        {
+            // copyBinaryTree leaves what it built in pDest when it throws
+            try
+            {
+                copyBinaryTree(pSrc, pDest);
+            }
+            catch (...)
+            {
+                deleteBinaryTree(pDest);
+                throw;
+            }
+            return pDest;
+        }
+
+        try
+        {
+            pDest = createNode(pSrc->data);
         }
         catch (...)
         {
             throw "ERROR: Unable to allocate a node";
         }
-        assert(pDest != nullptr);
+        pDest->isRed = pSrc->isRed;
 
-        copyBinaryTree(pSrc->pLeft, pDest->pLeft);
-        if (pSrc->pLeft)
-            pDest->pLeft->pParent = pDest;
+        // no thread to spare? Then the left side waits for get()
+        auto copyLeft = [this, pSrc, depthFork]() { return copyParallel(pSrc->pLeft, depthFork - 1); };
+        std::future<BNode*> futureLeft;
+        try
+        {
+            futureLeft = std::async(std::launch::async, copyLeft);
+        }
+        catch (const std::system_error&)
+        {
+            futureLeft = std::async(std::launch::deferred, copyLeft);
+        }
 
-        copyBinaryTree(pSrc->pRight, pDest->pRight);
-        if (pSrc->pRight)
-            pDest->pRight->pParent = pDest;
+        BNode* pLeft = nullptr;
+        BNode* pRight = nullptr;
+        try
+        {
+            pRight = copyParallel(pSrc->pRight, depthFork - 1);
+        }
+        catch (...)
+        {
+            try
+            {
+                pLeft = futureLeft.get();
+            }
+            catch (...)
+            {
+            }
+            deleteBinaryTree(pLeft);
+            destroyNode(pDest);
+            throw;
+        }
+
+        try
+        {
+            pLeft = futureLeft.get();
+        }
+        catch (...)
+        {
+            deleteBinaryTree(pRight);
+            destroyNode(pDest);
+            throw;
+        }
+
+        pDest->addLeft(pLeft);
+        pDest->addRight(pRight);
+        return pDest;
+    }
+
+    /**************************************************
+     * BST node :: find depth fork
+     * Fork until there is a subtree for every core
+     *************************************************/
+    template <typename T, typename A>
+    int BST <T, A> ::findDepthFork()
+    {
+        unsigned int numCores = std::thread::hardware_concurrency();
+        int depth = 0;
+        while ((1u << depth) < numCores && depth < 6)
+            depth++;
+        return depth;
     }
 
     /**************************************************
      * BST node :: delete node
      *
      *************************************************/
-    template <typename T>
-    void BST <T> ::deleteNode(BNode*& pDelete, bool toRight)
+    template <typename T, typename A>
+    void BST <T, A> ::deleteNode(BNode*& pDelete, bool toRight)
     {
         BNode* pNext = (toRight ? pDelete->pRight : pDelete->pLeft);
 
@@ -957,8 +1667,8 @@ namespace custom
       * BST ITERATOR :: INCREMENT PREFIX
       * advance by one
       *************************************************/
-    template <typename T>
-    typename BST <T> ::iterator& BST <T> ::iterator :: operator ++ ()
+    template <typename T, typename A>
+    typename BST <T, A> ::iterator& BST <T, A> ::iterator :: operator ++ ()
     {
         if (pNode == nullptr) return *this; // If at end, do nothing
         if (pNode->pRight)
@@ -987,8 +1697,8 @@ namespace custom
      * BST ITERATOR :: DECREMENT PREFIX
      * advance by one
      *************************************************/
-    template <typename T>
-    typename BST <T> ::iterator& BST <T> ::iterator :: operator -- ()
+    template <typename T, typename A>
+    typename BST <T, A> ::iterator& BST <T, A> ::iterator :: operator -- ()
     {
         if (pNode == nullptr) return *this; // If at end, do nothing
         if (pNode->pLeft)
@@ -0,0 +1,455 @@
+/***********************************************************************
+ * Header:
+ *    flat map
+ * Summary:
+ *    A map kept as a sorted vector of pairs rather than a tree
+ *      __       ____       ____         __
+ *     /  |    .'    '.   .'    '.   _  / /
+ *     `| |   |  .--.  | |  .--.  | (_)/ /
+ *      | |   | |    | | | |    | |   / / _
+ *     _| |_  |  `--'  | |  `--'  |  / / (_)
+ *    |_____|  '.____.'   '.____.'  /_/
+ *
+ *    This will contain the class definition of:
+ *        flat_map            : A map stored as a sorted custom::vector
+ *        flat_map::iterator  : An iterator through a flat_map
+ * Author
+ *    <Noah, Josh, Steve>
+ ************************************************************************/
+
+#pragma once
+
+#include <algorithm>  // for std::stable_sort and std::inplace_merge
+#include <cassert>
+#include <cstddef>    // for size_t
+#include <stdexcept>  // for std::out_of_range
+#include <utility>    // for std::move
+#include "pair.h"     // for pair
+#include "vector.h"   // for vector
+
+class TestFlatMap; // forward declaration for unit tests
+
+namespace custom
+{
+
+    /*****************************************************************
+     * FLAT MAP
+     * The same interface as map, but the pairs sit in one vector
+     * sorted by key. A lookup is a binary search over contiguous
+     * memory, and there are no nodes and no per-element pointers.
+     * Build it in bulk and read it often. An insert or erase shifts
+     * everything after it, and any change can invalidate every
+     * iterator.
+     *****************************************************************/
+    template <class K, class V>
+    class flat_map
+    {
+        friend ::TestFlatMap; // give unit tests access to the privates
+    public:
+        using Pairs = custom::pair<K, V>;
+
+        //
+        // Construct
+        //
+        flat_map() {}
+
+        flat_map(const flat_map& rhs) : elements(rhs.elements) {}
+
+        flat_map(flat_map&& rhs) noexcept : elements(std::move(rhs.elements)) {}
+
+        template <class Iterator>
+        flat_map(Iterator first, Iterator last)
+        {
+            insert(first, last);
+        }
+
+        flat_map(const std::initializer_list<Pairs>& il)
+        {
+            insert(il);
+        }
+
+        ~flat_map() {}
+
+        //
+        // Assign
+        //
+        flat_map& operator = (const flat_map& rhs)
+        {
+            elements = rhs.elements;
+            return *this;
+        }
+
+        flat_map& operator = (flat_map&& rhs)
+        {
+            elements = std::move(rhs.elements);
+            return *this;
+        }
+
+        flat_map& operator = (const std::initializer_list<Pairs>& il)
+        {
+            clear();
+            insert(il);
+            return *this;
+        }
+
+        void swap(flat_map& rhs) noexcept
+        {
+            elements.swap(rhs.elements);
+        }
+
+        //
+        // Iterator
+        //
+        class iterator;
+        iterator begin() const { return iterator(base());          }
+        iterator end()   const { return iterator(base() + size()); }
+
+        //
+        // Access
+        //
+        const V& operator [] (const K& k) const;
+        V& operator [] (const K& k);
+        const V& at(const K& k) const;
+        V& at(const K& k);
+        iterator find(const K& k) const
+        {
+            size_t index = lowerBound(k);
+            return iterator(base() + (isAt(index, k) ? index : size()));
+        }
+
+        //
+        // Insert
+        //
+        custom::pair<iterator, bool> insert(const Pairs& rhs)
+        {
+            return emplaceAt(rhs.first, rhs);
+        }
+
+        custom::pair<iterator, bool> insert(Pairs&& rhs)
+        {
+            return emplaceAt(rhs.first, std::move(rhs));
+        }
+
+        template <class ... Args>
+        custom::pair<iterator, bool> try_emplace(const K& k, Args&& ... args)
+        {
+            return emplaceAt(k, k, in_place, std::forward<Args>(args)...);
+        }
+
+        template <class Iterator>
+        void insert(Iterator first, Iterator last);
+
+        void insert(const std::initializer_list<Pairs>& il)
+        {
+            insert(il.begin(), il.end());
+        }
+
+        void reserve(size_t num) { elements.reserve(num); }
+
+        //
+        // Remove
+        //
+        void clear() noexcept
+        {
+            elements.clear();
+        }
+        size_t erase(const K& k);
+        iterator erase(iterator it);
+        iterator erase(iterator first, iterator last);
+
+        //
+        // Status
+        //
+        bool empty() const noexcept { return elements.empty(); }
+        size_t size() const noexcept { return elements.size(); }
+
+    private:
+
+        // the start of the pairs, or nullptr when there are none
+        const Pairs* base() const
+        {
+            return elements.empty() ? nullptr : &elements[0];
+        }
+
+        // is k the key at index?
+        bool isAt(size_t index, const K& k) const
+        {
+            return index < size() && !(k < elements[index].first);
+        }
+
+        size_t lowerBound(const K& k) const;
+        template <class ... Args>
+        custom::pair<iterator, bool> emplaceAt(const K& k, Args&& ... args);
+        void eraseRange(size_t indexBegin, size_t indexEnd);
+
+        custom::vector <Pairs> elements;   // sorted by key, no two keys equal
+    };
+
+
+    /**********************************************************
+     * FLAT MAP ITERATOR
+     * Forward and reverse iterator through a flat map. A
+     * pointer into the vector
+     *********************************************************/
+    template <typename K, typename V>
+    class flat_map <K, V> ::iterator
+    {
+        friend class ::TestFlatMap; // give unit tests access to the privates
+        template <class KK, class VV>
+        friend class custom::flat_map;
+    public:
+        //
+        // Construct
+        //
+        iterator() : p(nullptr) {}
+        iterator(const pair<K, V>* p) : p(p) {}
+        iterator(const iterator& rhs) = default;
+
+        //
+        // Assign
+        //
+        iterator& operator = (const iterator& rhs) = default;
+
+        //
+        // Compare
+        //
+        bool operator == (const iterator& rhs) const { return p == rhs.p; }
+        bool operator != (const iterator& rhs) const { return p != rhs.p; }
+
+        //
+        // Access
+        //
+        const pair <K, V>& operator * () const
+        {
+            return *p;
+        }
+
+        //
+        // Increment
+        //
+        iterator& operator++()
+        {
+            ++p;
+            return *this;
+        }
+
+        iterator operator++(int postfix)
+        {
+            iterator tmp = *this;
+            ++p;
+            return tmp;
+        }
+
+        iterator& operator--()
+        {
+            --p;
+            return *this;
+        }
+
+        iterator operator--(int postfix)
+        {
+            iterator tmp = *this;
+            --p;
+            return tmp;
+        }
+
+    private:
+
+        // Member variable
+        const pair <K, V>* p;
+    };
+
+
+    /*****************************************************
+     * FLAT MAP :: LOWER BOUND
+     * The index of the first key not less than k. Each step
+     * halves the range without a data-dependent branch, so the
+     * compiler can use a conditional move and the loop never
+     * mispredicts
+     ****************************************************/
+    template <typename K, typename V>
+    size_t flat_map <K, V> ::lowerBound(const K& k) const
+    {
+        size_t num = size();
+        if (num == 0)
+            return 0;
+
+        const Pairs* pBase = base();
+        while (num > 1)
+        {
+            size_t half = num / 2;
+            pBase = (pBase[half].first < k) ? pBase + half : pBase;
+            num -= half;
+        }
+        return (pBase - base()) + (pBase->first < k ? 1 : 0);
+    }
+
+    /*****************************************************
+     * FLAT MAP :: EMPLACE AT
+     * Build a pair from args where k belongs, unless k is
+     * already there. Nothing is built for a key we have
+     ****************************************************/
+    template <typename K, typename V>
+    template <class ... Args>
+    custom::pair<typename flat_map <K, V> ::iterator, bool> flat_map <K, V> ::emplaceAt(const K& k, Args&& ... args)
+    {
+        size_t index = lowerBound(k);
+        if (isAt(index, k))
+            return custom::pair<iterator, bool>(iterator(base() + index), false);
+
+        typename custom::vector<Pairs>::iterator it = (index == size() ? elements.end() :
+                                                       typename custom::vector<Pairs>::iterator(index, elements));
+        elements.emplace(it, std::forward<Args>(args)...);
+        return custom::pair<iterator, bool>(iterator(base() + index), true);
+    }
+
+    /*****************************************************
+     * FLAT MAP :: INSERT RANGE
+     * Append the lot, sort only the new part by key, merge it
+     * into the old part and drop the repeated keys. Pairs with
+     * equal keys keep their order, so the one already in the
+     * map (or the first new one) wins, as with map
+     ****************************************************/
+    template <typename K, typename V>
+    template <class Iterator>
+    void flat_map <K, V> ::insert(Iterator itFirst, Iterator itLast)
+    {
+        size_t numOld = size();
+        for (Iterator it = itFirst; it != itLast; ++it)
+            elements.push_back(*it);
+        if (size() == numOld)
+            return;
+
+        Pairs* pBegin = &elements[0];
+        Pairs* pMiddle = pBegin + numOld;
+        Pairs* pEnd = pBegin + size();
+        std::stable_sort(pMiddle, pEnd);
+        std::inplace_merge(pBegin, pMiddle, pEnd);
+
+        // slide each first-of-its-key down over the repeats
+        size_t numKeep = 1;
+        for (size_t i = 1; i < size(); i++)
+            if (elements[numKeep - 1].first < elements[i].first)
+            {
+                if (numKeep != i)
+                    elements[numKeep] = std::move(elements[i]);
+                numKeep++;
+            }
+        while (size() > numKeep)
+            elements.pop_back();
+    }
+
+    /*****************************************************
+     * FLAT MAP :: ERASE RANGE
+     * Slide the tail down over [indexBegin, indexEnd)
+     ****************************************************/
+    template <typename K, typename V>
+    void flat_map <K, V> ::eraseRange(size_t indexBegin, size_t indexEnd)
+    {
+        assert(indexBegin <= indexEnd && indexEnd <= size());
+        size_t numErase = indexEnd - indexBegin;
+        if (numErase == 0)
+            return;
+        for (size_t i = indexEnd; i < size(); i++)
+            elements[i - numErase] = std::move(elements[i]);
+        for (size_t i = 0; i < numErase; i++)
+            elements.pop_back();
+    }
+
+    /*****************************************************
+     * FLAT MAP :: SUBSCRIPT
+     * Retrieve an element, adding a default value if the
+     * key is not there yet
+     ****************************************************/
+    template <typename K, typename V>
+    V& flat_map <K, V> :: operator [] (const K& key)
+    {
+        iterator it = emplaceAt(key, key).first;
+        return elements[it.p - base()].second;
+    }
+
+    /*****************************************************
+     * FLAT MAP :: SUBSCRIPT
+     * Retrieve an element from the map
+     ****************************************************/
+    template <typename K, typename V>
+    const V& flat_map <K, V> :: operator [] (const K& key) const
+    {
+        return at(key);
+    }
+
+    /*****************************************************
+     * FLAT MAP :: AT
+     * Retrieve an element from the map
+     ****************************************************/
+    template <typename K, typename V>
+    V& flat_map <K, V> ::at(const K& key)
+    {
+        size_t index = lowerBound(key);
+        if (!isAt(index, key))
+            throw std::out_of_range("invalid map<K, T> key");
+        return elements[index].second;
+    }
+
+    /*****************************************************
+     * FLAT MAP :: AT
+     * Retrieve an element from the map
+     ****************************************************/
+    template <typename K, typename V>
+    const V& flat_map <K, V> ::at(const K& key) const
+    {
+        size_t index = lowerBound(key);
+        if (!isAt(index, key))
+            throw std::out_of_range("invalid map<K, T> key");
+        return elements[index].second;
+    }
+
+    /*****************************************************
+     * SWAP
+     * Swap two flat maps
+     ****************************************************/
+    template <typename K, typename V>
+    void swap(flat_map <K, V>& lhs, flat_map <K, V>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    /*****************************************************
+     * ERASE
+     * Erase one element
+     ****************************************************/
+    template <typename K, typename V>
+    size_t flat_map <K, V>::erase(const K& k)
+    {
+        size_t index = lowerBound(k);
+        if (!isAt(index, k))
+            return 0;
+        eraseRange(index, index + 1);
+        return 1;
+    }
+
+    /*****************************************************
+     * ERASE
+     * Erase several elements
+     ****************************************************/
+    template <typename K, typename V>
+    typename flat_map <K, V>::iterator flat_map <K, V>::erase(iterator itFirst, iterator itLast)
+    {
+        size_t index = itFirst.p - base();
+        eraseRange(index, itLast.p - base());
+        return iterator(base() + index);
+    }
+
+    /*****************************************************
+     * ERASE
+     * Erase one element
+     ****************************************************/
+    template <typename K, typename V>
+    typename flat_map <K, V>::iterator flat_map <K, V>::erase(iterator it)
+    {
+        size_t index = it.p - base();
+        eraseRange(index, index + 1);
+        return iterator(base() + index);
+    }
+
+}; //  namespace custom
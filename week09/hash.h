@@ -0,0 +1,534 @@
+/***********************************************************************
+ * Header:
+ *    hash
+ * Summary:
+ *    The open-addressing table under unordered_set and unordered_map
+ *      __       ____       ____         __
+ *     /  |    .'    '.   .'    '.   _  / /
+ *     `| |   |  .--.  | |  .--.  | (_)/ /
+ *      | |   | |    | | | |    | |   / / _
+ *     _| |_  |  `--'  | |  `--'  |  / / (_)
+ *    |_____|  '.____.'   '.____.'  /_/
+ *
+ *    This will contain the class definition of:
+ *        hash_table            : Robin Hood hashing over a flat slot array
+ *        hash_table::iterator  : An iterator through the occupied slots
+ *        string_hash           : A hash for strings and char*
+ *        key_of_self           : The key of a set element
+ *        key_of_pair           : The key of a map pair
+ * Author
+ *    <Noah, Josh, Steve>
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint8_t and uint64_t
+#include <cstring>      // for strlen
+#include <functional>   // for std::hash and std::equal_to
+#include <new>          // for placement new
+#include <string>       // for std::string
+#include <utility>      // for std::move, std::forward and std::swap
+
+class TestHash; // forward declaration for unit tests
+
+namespace custom
+{
+
+    /*****************************************************************
+     * STRING HASH
+     * Hashes a std::string and a char* with the same bytes the same
+     * way, so a table of std::string can be searched with a char*
+     * without building a std::string first. FNV-1a over the bytes
+     *****************************************************************/
+    struct string_hash
+    {
+        using is_transparent = void;
+        size_t operator () (const std::string& s) const { return hashBytes(s.data(), s.size()); }
+        size_t operator () (const char* s)        const { return hashBytes(s, std::strlen(s));   }
+
+    private:
+        static size_t hashBytes(const char* p, size_t num)
+        {
+            uint64_t hash = 14695981039346656037ull;
+            for (size_t i = 0; i < num; i++)
+            {
+                hash ^= uint8_t(p[i]);
+                hash *= 1099511628211ull;
+            }
+            return size_t(hash);
+        }
+    };
+
+    /*****************************************************************
+     * KEY OF SELF, KEY OF PAIR
+     * How a table finds the key in what it stores: a set's key is
+     * the whole element, a map's is the first of the pair
+     *****************************************************************/
+    template <class T>
+    struct key_of_self
+    {
+        const T& operator () (const T& t) const { return t; }
+    };
+
+    template <class K, class P>
+    struct key_of_pair
+    {
+        const K& operator () (const P& rhs) const { return rhs.first; }
+    };
+
+    /*****************************************************************
+     * HASH TABLE
+     * Open addressing with linear probing over one flat array of
+     * slots. Beside each slot is one byte: 0 for empty, otherwise
+     * how far the element sits from its home slot, plus one.
+     *
+     * Robin Hood: an insert takes the slot of the first element that
+     * is closer to home than the newcomer would be, and shifts the
+     * rest of the run along one. Runs stay sorted by home slot, so a
+     * search stops as soon as it passes where the key would be. An
+     * erase shifts the rest of the run back, so there are no
+     * tombstones.
+     *
+     * Homes are a power of two; past them is a tail of overflow slots
+     * instead of wrapping around to the front. Elements only ever
+     * shift towards the end on insert and towards the front on
+     * erase, so erasing while walking the table never shows an
+     * element twice. The last slot is always empty, so every probe
+     * ends without a bounds check.
+     *
+     * KeyOf pulls the key out of a Value: the value itself for a
+     * set, the first of the pair for a map.
+     *****************************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    class hash_table
+    {
+        friend class ::TestHash; // give unit tests access to the privates
+    public:
+
+        //
+        // Construct
+        //
+        hash_table() : slots(nullptr), probes(nullptr), numCapacity(0), numSlots(0),
+                       numElements(0), maxLoad(0.8f), shift(sizeof(size_t) * 8) {}
+        hash_table(const hash_table& rhs);
+        hash_table(hash_table&& rhs) noexcept : hash_table()
+        {
+            swap(rhs);
+        }
+        ~hash_table()
+        {
+            clear();
+            release();
+        }
+
+        //
+        // Assign
+        //
+        hash_table& operator = (const hash_table& rhs)
+        {
+            hash_table copy(rhs);
+            swap(copy);
+            return *this;
+        }
+        hash_table& operator = (hash_table&& rhs) noexcept
+        {
+            clear();
+            swap(rhs);
+            return *this;
+        }
+        void swap(hash_table& rhs) noexcept
+        {
+            std::swap(slots, rhs.slots);
+            std::swap(probes, rhs.probes);
+            std::swap(numCapacity, rhs.numCapacity);
+            std::swap(numSlots, rhs.numSlots);
+            std::swap(numElements, rhs.numElements);
+            std::swap(maxLoad, rhs.maxLoad);
+            std::swap(shift, rhs.shift);
+        }
+
+        //
+        // Iterator
+        //
+        class iterator;
+        iterator begin() const { return iterator(this, next(0)); }
+        iterator end()   const { return iterator(this, numSlots); }
+
+        //
+        // Access
+        //
+        template <class Q>
+        size_t findIndex(const Q& key) const;
+        template <class Q, class ... Args>
+        std::pair<size_t, bool> emplaceKey(const Q& key, Args&& ... args);
+        Value& at(size_t index) const
+        {
+            assert(index < numSlots && probes[index] != 0);
+            return slots[index];
+        }
+
+        //
+        // Remove
+        //
+        size_t eraseIndex(size_t index);
+        void clear() noexcept;
+
+        //
+        // Status
+        //
+        size_t size()         const { return numElements; }
+        bool   empty()        const { return numElements == 0; }
+        size_t bucket_count() const { return numCapacity; }
+        float  load_factor()  const { return numCapacity == 0 ? 0.0f : float(numElements) / float(numCapacity); }
+        float  max_load_factor() const { return maxLoad; }
+        void   max_load_factor(float load);
+        void   reserve(size_t num);
+        void   rehash(size_t num);
+
+        // the first occupied slot at or after index, or end
+        size_t next(size_t index) const
+        {
+            while (index < numSlots && probes[index] == 0)
+                index++;
+            return index;
+        }
+
+    private:
+
+        static const unsigned probeMax = 255;   // furthest a probe byte can say
+
+        // where a hash wants to live. Fibonacci hashing mixes the high
+        // bits in, so a weak hash such as the identity still spreads
+        size_t home(size_t hash) const
+        {
+            return size_t(hash * size_t(0x9E3779B97F4A7C15ull)) >> shift;
+        }
+
+        void closeGap(size_t index);
+        void allocate(size_t num);
+        void release() noexcept;
+        bool fits(size_t num) const { return float(num) <= maxLoad * float(numCapacity); }
+
+        Value*   slots;          // raw storage, alive where probes[i] != 0
+        uint8_t* probes;         // 0 for empty, else distance from home + 1
+        size_t   numCapacity;    // home slots: a power of two, or 0
+        size_t   numSlots;       // home slots plus the overflow tail
+        size_t   numElements;
+        float    maxLoad;        // grow past this fraction of numCapacity
+        unsigned shift;          // bits to drop from a mixed hash to get home
+    };
+
+    /**************************************************
+     * HASH TABLE ITERATOR
+     * Walks the slots in order, skipping the empty ones
+     *************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    class hash_table <Key, Value, KeyOf, Hash, Equal> ::iterator
+    {
+        friend class ::TestHash; // give unit tests access to the privates
+    public:
+        //
+        // Construct
+        //
+        iterator() : pTable(nullptr), index(0) {}
+        iterator(const hash_table* pTable, size_t index) : pTable(pTable), index(index) {}
+        iterator(const iterator& rhs) = default;
+
+        //
+        // Assign
+        //
+        iterator& operator = (const iterator& rhs) = default;
+
+        //
+        // Compare
+        //
+        bool operator == (const iterator& rhs) const { return index == rhs.index && pTable == rhs.pTable; }
+        bool operator != (const iterator& rhs) const { return !(*this == rhs); }
+
+        //
+        // Access
+        //
+        const Value& operator * () const { return pTable->at(index); }
+        size_t getIndex() const { return index; }
+
+        //
+        // Increment
+        //
+        iterator& operator ++ ()
+        {
+            index = pTable->next(index + 1);
+            return *this;
+        }
+
+        iterator operator ++ (int postfix)
+        {
+            iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+    private:
+        const hash_table* pTable;
+        size_t index;
+    };
+
+    /*****************************************************
+     * HASH TABLE :: COPY CONSTRUCTOR
+     * Same capacity, and every element in the same slot,
+     * so there is nothing to rehash
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    hash_table <Key, Value, KeyOf, Hash, Equal> ::hash_table(const hash_table& rhs) : hash_table()
+    {
+        maxLoad = rhs.maxLoad;
+        if (rhs.numCapacity == 0)
+            return;
+        allocate(rhs.numCapacity);
+        try
+        {
+            for (size_t i = 0; i < numSlots; i++)
+                if (rhs.probes[i] != 0)
+                {
+                    new (slots + i) Value(rhs.slots[i]);
+                    probes[i] = rhs.probes[i];
+                    numElements++;
+                }
+        }
+        catch (...)
+        {
+            clear();
+            release();
+            throw;
+        }
+    }
+
+    /*****************************************************
+     * HASH TABLE :: FIND INDEX
+     * The slot holding key, or end if there is none. Stop
+     * once we reach a slot that is closer to home than key
+     * would be: Robin Hood would have put key before it
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    template <class Q>
+    size_t hash_table <Key, Value, KeyOf, Hash, Equal> ::findIndex(const Q& key) const
+    {
+        if (numElements == 0)
+            return numSlots;
+
+        size_t index = home(Hash()(key));
+        for (unsigned probe = 1; probes[index] >= probe; probe++, index++)
+            if (probes[index] == probe && Equal()(KeyOf()(slots[index]), key))
+                return index;
+        return numSlots;
+    }
+
+    /*****************************************************
+     * HASH TABLE :: EMPLACE KEY
+     * Find key, or build a Value from args in its place. The
+     * search finds the slot the newcomer belongs in; the run
+     * from there to the next empty slot moves along one, and
+     * the Value is built straight into the gap. Nothing is
+     * built when key is already there
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    template <class Q, class ... Args>
+    std::pair<size_t, bool> hash_table <Key, Value, KeyOf, Hash, Equal> ::emplaceKey(const Q& key, Args&& ... args)
+    {
+        size_t index = 0;
+        unsigned probe = 1;
+        if (numCapacity != 0)
+            for (index = home(Hash()(key)); probes[index] >= probe; probe++, index++)
+                if (probes[index] == probe && Equal()(KeyOf()(slots[index]), key))
+                    return std::pair<size_t, bool>(index, false);
+
+        // grow when too full, when the run would spill into the last
+        // slot, or when a probe byte would overflow. Every element in
+        // the run is no further from home than the newcomer would be
+        // at the empty slot, so that one distance covers them all
+        size_t indexEmpty = index;
+        if (numCapacity != 0)
+            while (probes[indexEmpty] != 0)
+                indexEmpty++;
+        if (!fits(numElements + 1) || indexEmpty + 1 >= numSlots ||
+            probe + (indexEmpty - index) >= probeMax)
+        {
+            rehash(numCapacity == 0 ? 8 : numCapacity * 2);
+            return emplaceKey(key, std::forward<Args>(args)...);
+        }
+
+        // slide the run [index, indexEmpty) along one
+        for (size_t i = indexEmpty; i != index; i--)
+        {
+            new (slots + i) Value(std::move(slots[i - 1]));
+            slots[i - 1].~Value();
+            probes[i] = uint8_t(probes[i - 1] + 1);
+            probes[i - 1] = 0;
+        }
+
+        try
+        {
+            new (slots + index) Value(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            closeGap(index);
+            throw;
+        }
+        probes[index] = uint8_t(probe);
+        numElements++;
+        return std::pair<size_t, bool>(index, true);
+    }
+
+    /*****************************************************
+     * HASH TABLE :: ERASE INDEX
+     * Destroy the element and close the gap it leaves. The
+     * slot of the next element in iteration order is returned
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    size_t hash_table <Key, Value, KeyOf, Hash, Equal> ::eraseIndex(size_t index)
+    {
+        assert(index < numSlots && probes[index] != 0);
+        slots[index].~Value();
+        probes[index] = 0;
+        numElements--;
+        closeGap(index);
+        return next(index);
+    }
+
+    /*****************************************************
+     * HASH TABLE :: CLOSE GAP
+     * Pull the run after an empty slot back one, until an
+     * empty slot or an element already home
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    void hash_table <Key, Value, KeyOf, Hash, Equal> ::closeGap(size_t index)
+    {
+        assert(probes[index] == 0);
+        for (; probes[index + 1] > 1; index++)
+        {
+            new (slots + index) Value(std::move(slots[index + 1]));
+            slots[index + 1].~Value();
+            probes[index] = uint8_t(probes[index + 1] - 1);
+            probes[index + 1] = 0;
+        }
+    }
+
+    /*****************************************************
+     * HASH TABLE :: CLEAR
+     * Destroy every element but keep the slots
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    void hash_table <Key, Value, KeyOf, Hash, Equal> ::clear() noexcept
+    {
+        for (size_t i = 0; i < numSlots && numElements != 0; i++)
+            if (probes[i] != 0)
+            {
+                slots[i].~Value();
+                probes[i] = 0;
+                numElements--;
+            }
+        assert(numElements == 0);
+    }
+
+    /*****************************************************
+     * HASH TABLE :: MAX LOAD FACTOR
+     * Grow straight away if we are already past the new limit
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    void hash_table <Key, Value, KeyOf, Hash, Equal> ::max_load_factor(float load)
+    {
+        assert(load > 0.0f && load <= 1.0f);
+        maxLoad = load;
+        if (!fits(numElements))
+            reserve(numElements);
+    }
+
+    /*****************************************************
+     * HASH TABLE :: RESERVE
+     * Make room for num elements without growing again
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    void hash_table <Key, Value, KeyOf, Hash, Equal> ::reserve(size_t num)
+    {
+        size_t numHomes = 8;
+        while (float(num) > maxLoad * float(numHomes))
+            numHomes *= 2;
+        if (numHomes > numCapacity)
+            rehash(numHomes);
+    }
+
+    /*****************************************************
+     * HASH TABLE :: REHASH
+     * Move every element into a new array of at least num
+     * homes, rounded up to a power of two and never too few
+     * for what we hold
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    void hash_table <Key, Value, KeyOf, Hash, Equal> ::rehash(size_t num)
+    {
+        size_t numHomes = 8;
+        while (numHomes < num || float(numElements) > maxLoad * float(numHomes))
+            numHomes *= 2;
+
+        hash_table old;
+        swap(old);
+        maxLoad = old.maxLoad;
+        allocate(numHomes);
+
+        for (size_t i = 0; i < old.numSlots; i++)
+            if (old.probes[i] != 0)
+            {
+                Value& value = old.slots[i];
+                emplaceKey(KeyOf()(value), std::move(value));
+            }
+    }
+
+    /*****************************************************
+     * HASH TABLE :: ALLOCATE
+     * Empty arrays for num homes, a power of two, and the
+     * overflow tail after them
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    void hash_table <Key, Value, KeyOf, Hash, Equal> ::allocate(size_t num)
+    {
+        assert(slots == nullptr && probes == nullptr);
+        assert(num != 0 && (num & (num - 1)) == 0);
+        size_t numTotal = num + (num < probeMax ? num : probeMax);
+        probes = new uint8_t[numTotal]();
+        try
+        {
+            slots = static_cast<Value*>(::operator new(numTotal * sizeof(Value)));
+        }
+        catch (...)
+        {
+            delete [] probes;
+            probes = nullptr;
+            throw;
+        }
+        numCapacity = num;
+        numSlots = numTotal;
+        shift = sizeof(size_t) * 8;
+        for (size_t n = num; n > 1; n /= 2)
+            shift--;
+    }
+
+    /*****************************************************
+     * HASH TABLE :: RELEASE
+     * Give the arrays back. Any elements must be gone
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    void hash_table <Key, Value, KeyOf, Hash, Equal> ::release() noexcept
+    {
+        assert(numElements == 0);
+        ::operator delete(slots);
+        delete [] probes;
+        slots = nullptr;
+        probes = nullptr;
+        numCapacity = 0;
+        numSlots = 0;
+        shift = sizeof(size_t) * 8;
+    }
+
+}; // namespace custom
@@ -30,6 +30,15 @@
 #endif // DEBUG
 #endif // !debug
 
+// Define MAP_TRACE to log every subscript; it costs a flush per call
+#ifndef mapTrace
+#ifdef MAP_TRACE
+#define mapTrace(x) x
+#else
+#define mapTrace(x)
+#endif // MAP_TRACE
+#endif // !mapTrace
+
 class TestMap; // forward declaration for unit tests
 
 namespace custom
@@ -37,14 +46,15 @@ namespace custom
 
     /*****************************************************************
      * MAP
-     * Create a Map, similar to a Binary Search Tree
+     * Create a Map, similar to a Binary Search Tree. The nodes of
+     * the tree come from A
      *****************************************************************/
-    template <class K, class V>
+    template <class K, class V, class A = std::allocator<custom::pair<K, V>>>
     class map
     {
         friend ::TestMap; // give unit tests access to the privates
-        template <class KK, class VV>
-        friend void swap(map<KK, VV>& lhs, map<KK, VV>& rhs);
+        template <class KK, class VV, class AA>
+        friend void swap(map<KK, VV, AA>& lhs, map<KK, VV, AA>& rhs);
     public:
         using Pairs = custom::pair<K, V>;
 
@@ -53,6 +63,8 @@ namespace custom
         //
         map() : bst() {}
 
+        explicit map(const A& a) : bst(a) {}
+
         map(const map& rhs) : bst(rhs.bst) {}
 
         map(map&& rhs) noexcept : bst(std::move(rhs.bst))
@@ -132,7 +144,7 @@ namespace custom
         V& at(const K& k);
         iterator    find(const K& k)
         {
-            return iterator(bst.find(Pairs(k, V()))); //Find it by key
+            return iterator(bst.findKey(k)); //Find it by key
         }
 
         //
@@ -150,11 +162,13 @@ namespace custom
             return custom::pair<iterator, bool>(iterator(result.first), result.second);
         }
 
+        template <class ... Args>
+        custom::pair<typename map::iterator, bool> try_emplace(const K& k, Args&& ... args);
+
         template <class Iterator>
         void insert(Iterator first, Iterator last) // Insert range of elements
         {
-            for (auto it = first; it != last; ++it)
-                bst.insert(*it);
+            bst.insert(first, last, true /* keepUnique */); // Linear time if sorted
         }
 
         void insert(const std::initializer_list<Pairs>& il) // Insert elements from initializer list
@@ -183,7 +197,7 @@ namespace custom
     private:
 
         // the students DO NOT need to use a nested class
-        BST < pair <K, V >> bst;
+        BST < pair <K, V >, A > bst;
     };
 
 
@@ -192,11 +206,11 @@ namespace custom
      * Forward and reverse iterator through a Map, just call
      * through to BSTIterator
      *********************************************************/
-    template <typename K, typename V>
-    class map <K, V> ::iterator
+    template <typename K, typename V, typename A>
+    class map <K, V, A> ::iterator
     {
         friend class ::TestMap; // give unit tests access to the privates
-        template <class KK, class VV>
+        template <class KK, class VV, class AA>
         friend class custom::map;
     public:
         //
@@ -205,7 +219,7 @@ namespace custom
         iterator()
         {
         }
-        iterator(const typename BST<pair<K, V>>::iterator& rhs) : it(rhs) {} // Initialize
+        iterator(const typename BST<pair<K, V>, A>::iterator& rhs) : it(rhs) {} // Initialize
         iterator(const iterator& rhs) = default;
 
         //
@@ -264,7 +278,7 @@ namespace custom
     private:
 
         // Member variable
-        typename BST < pair <K, V >>  ::iterator it;
+        typename BST < pair <K, V >, A >  ::iterator it;
     };
 
 
@@ -272,31 +286,24 @@ namespace custom
      * MAP :: SUBSCRIPT
      * Retrieve an element from the map
      ****************************************************/
-    template <typename K, typename V>
-    V& map <K, V> :: operator [] (const K& key)
+    template <typename K, typename V, typename A>
+    V& map <K, V, A> :: operator [] (const K& key)
     {
-        std::cout << "Inserting/Accessing key: " << key << std::endl;
-        auto it = bst.find(Pairs(key, V()));
-        if (it != bst.end()) {
-            // Key already exists, return the existing value
-            return (*it).second;
-        }
-        else {
-            // Key does not exist, insert a new pair with the default value
-            auto result = bst.insert(Pairs(key, V()));
-            std::cout << "Insert result: " << result.second << "; Value: " << (*result.first).second << std::endl;
-            return (*result.first).second;
-        }
+        // One walk down the tree either finds the key or adds it
+        auto result = bst.insertKey(key, key);
+        mapTrace(std::cout << "Inserting/Accessing key: " << key
+                           << "; inserted: " << result.second << std::endl);
+        return (*result.first).second;
     }
 
     /*****************************************************
      * MAP :: SUBSCRIPT
      * Retrieve an element from the map
      ****************************************************/
-    template <typename K, typename V>
-    const V& map <K, V> :: operator [] (const K& key) const
+    template <typename K, typename V, typename A>
+    const V& map <K, V, A> :: operator [] (const K& key) const
     {
-        auto it = bst.find(Pairs(key, V())); // Find the key in the BST
+        auto it = bst.findKey(key); // Find the key in the BST
         if (it == bst.end())
             throw std::out_of_range("invalid map key"); // Throw exception if key is not found
         return it->second;
@@ -306,10 +313,10 @@ namespace custom
      * MAP :: AT
      * Retrieve an element from the map
      ****************************************************/
-    template <typename K, typename V>
-    V& map <K, V> ::at(const K& key)
+    template <typename K, typename V, typename A>
+    V& map <K, V, A> ::at(const K& key)
     {
-        auto it = bst.find(Pairs(key, V())); // Find the key in the BST
+        auto it = bst.findKey(key); // Find the key in the BST
         if (it == bst.end())
             throw std::out_of_range("invalid map<K, T> key"); // Throw exception if key is not found
         return (*it).second;
@@ -319,21 +326,35 @@ namespace custom
      * MAP :: AT
      * Retrieve an element from the map
      ****************************************************/
-    template <typename K, typename V>
-    const V& map <K, V> ::at(const K& key) const
+    template <typename K, typename V, typename A>
+    const V& map <K, V, A> ::at(const K& key) const
     {
-        auto it = bst.find(Pairs(key, V())); // Find the key in the BST
+        auto it = bst.findKey(key); // Find the key in the BST
         if (it == bst.end())
             throw std::out_of_range("invalid map<K, T> key"); // Throw exception if key is not found
         return (*it).second;
     }
 
+    /*****************************************************
+     * MAP :: TRY EMPLACE
+     * Insert a value built from args under key k unless k is
+     * already in the map. Either way it takes one walk down the tree
+     * and the value is only constructed if it is inserted
+     ****************************************************/
+    template <typename K, typename V, typename A>
+    template <class ... Args>
+    custom::pair<typename map <K, V, A> ::iterator, bool> map <K, V, A> ::try_emplace(const K& k, Args&& ... args)
+    {
+        auto result = bst.insertKey(k, k, in_place, std::forward<Args>(args)...);
+        return custom::pair<iterator, bool>(iterator(result.first), result.second);
+    }
+
     /*****************************************************
      * SWAP
      * Swap two maps
      ****************************************************/
-    template <typename K, typename V>
-    void swap(map <K, V>& lhs, map <K, V>& rhs)
+    template <typename K, typename V, typename A>
+    void swap(map <K, V, A>& lhs, map <K, V, A>& rhs)
     {
         using std::swap; // Use the standard swap function
         swap(lhs.bst, rhs.bst); // Swap the BSTs of the two maps
@@ -343,10 +364,10 @@ namespace custom
      * ERASE
      * Erase one element
      ****************************************************/
-    template <typename K, typename V>
-    size_t map<K, V>::erase(const K& k)
+    template <typename K, typename V, typename A>
+    size_t map <K, V, A>::erase(const K& k)
     {
-        auto it = bst.find(Pairs(k, V())); // Find the key in the BST
+        auto it = bst.findKey(k); // Find the key in the BST
         if (it != bst.end())
         {
             bst.erase(it); // Erase the element if found
@@ -360,8 +381,8 @@ namespace custom
      * ERASE
      * Erase several elements
      ****************************************************/
-    template <typename K, typename V>
-    typename map<K, V>::iterator map<K, V>::erase(map<K, V>::iterator first, map<K, V>::iterator last)
+    template <typename K, typename V, typename A>
+    typename map <K, V, A>::iterator map <K, V, A>::erase(map <K, V, A>::iterator first, map <K, V, A>::iterator last)
     {
         while (first != last)
         {
@@ -374,8 +395,8 @@ namespace custom
      * ERASE
      * Erase one element
      ****************************************************/
-    template <typename K, typename V>
-    typename map<K, V>::iterator map<K, V>::erase(map<K, V>::iterator it)
+    template <typename K, typename V, typename A>
+    typename map <K, V, A>::iterator map <K, V, A>::erase(map <K, V, A>::iterator it)
     {
         return iterator(bst.erase(it.it)); // Erase the element and return the new iterator
     }
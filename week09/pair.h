@@ -10,10 +10,19 @@
 #pragma once
 
 #include <iostream>  // for ISTREAM and OSTREAM
+#include <utility>   // for std::move and std::forward
 
 namespace custom
 {
 
+/**********************************************
+ * IN PLACE
+ * A tag asking pair to build second from the arguments
+ * that follow. Ours, because std::in_place needs C++17
+ ***********************************************/
+struct in_place_t {};
+constexpr in_place_t in_place{};
+
 /**********************************************
  * PAIR
  * This class couples together a pair of values, which may be of
@@ -50,6 +59,10 @@ public:
    // Move Constructor: call the T1, T2 move constructors
    pair(pair <T1, T2> && rhs, const C& c = C())
        : first(std::move(rhs.first)), second(std::move(rhs.second)), compare(c) {}
+   // In-place Constructor: build second directly from args
+   template <class ... Args>
+   pair(const T1& first, in_place_t, Args&& ... args)
+      : first(first), second(std::forward<Args>(args)...), compare() {}
 
    //
    // Assignment Operators
@@ -114,6 +127,22 @@ public:
 };
 
 
+/*****************************************************
+ * PAIR KEY COMPARISON
+ * Compare a bare key against a pair without building a pair
+ ****************************************************/
+template <class T1, class T2, typename C>
+inline bool operator == (const pair <T1, T2, C> & lhs, const T1 & key)
+{
+   return lhs.first == key;
+}
+
+template <class T1, class T2, typename C>
+inline bool operator < (const T1 & key, const pair <T1, T2, C> & rhs)
+{
+   return rhs.compare(key, rhs.first);
+}
+
 /*****************************************************
  * PAIR SWAP
  * Stand-alone swap function
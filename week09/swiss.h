@@ -0,0 +1,613 @@
+/***********************************************************************
+ * Header:
+ *    swiss
+ * Summary:
+ *    A group-probing hash table with one control byte per slot
+ *      __       ____       ____         __
+ *     /  |    .'    '.   .'    '.   _  / /
+ *     `| |   |  .--.  | |  .--.  | (_)/ /
+ *      | |   | |    | | | |    | |   / / _
+ *     _| |_  |  `--'  | |  `--'  |  / / (_)
+ *    |_____|  '.____.'   '.____.'  /_/
+ *
+ *    This will contain the class definition of:
+ *        swiss_table            : Swiss-table hashing over a flat slot array
+ *        swiss_table::iterator  : An iterator through the full slots
+ *        swiss_set              : unordered_set over a swiss_table
+ *        swiss_map              : unordered_map over a swiss_table
+ * Author
+ *    <Noah, Josh, Steve>
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int8_t and uint32_t
+#include <cstring>      // for memset
+#include <functional>   // for std::hash and std::equal_to
+#include <new>          // for placement new
+#include <utility>      // for std::move, std::forward and std::swap
+#include "hash.h"       // for key_of_self and key_of_pair
+#include "pair.h"       // for pair
+#include "unordered_map.h"
+#include "unordered_set.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CUSTOM_SWISS_SSE2
+#include <emmintrin.h>  // for the 16-byte compares
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>     // for _BitScanForward
+#endif
+
+class TestHash; // forward declaration for unit tests
+
+namespace custom
+{
+
+    /*****************************************************************
+     * SWISS GROUP
+     * Sixteen control bytes looked at together. Each match returns
+     * a bit mask with bit i set when byte i matches, one compare
+     * and one movemask with SSE2, or a plain loop without it.
+     *
+     * A control byte is empty (-128), deleted (-2), or full: the
+     * 7-bit fingerprint of the key in the slot. Only the empty and
+     * deleted bytes have the high bit set.
+     *****************************************************************/
+    class swiss_group
+    {
+    public:
+        static const size_t size = 16;
+        static const int8_t ctrlEmpty = -128;
+        static const int8_t ctrlDeleted = -2;
+
+        explicit swiss_group(const int8_t* pCtrl)
+#ifdef CUSTOM_SWISS_SSE2
+            : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pCtrl))) {}
+#else
+            : pCtrl(pCtrl) {}
+#endif
+
+        // the slots whose fingerprint is h2
+        uint32_t match(int8_t h2) const
+        {
+#ifdef CUSTOM_SWISS_SSE2
+            return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)));
+#else
+            uint32_t mask = 0;
+            for (size_t i = 0; i < size; i++)
+                mask |= uint32_t(pCtrl[i] == h2) << i;
+            return mask;
+#endif
+        }
+
+        // the empty slots
+        uint32_t matchEmpty() const
+        {
+            return match(ctrlEmpty);
+        }
+
+        // the empty or deleted slots: those with the high bit set
+        uint32_t matchFree() const
+        {
+#ifdef CUSTOM_SWISS_SSE2
+            return uint32_t(_mm_movemask_epi8(ctrl));
+#else
+            uint32_t mask = 0;
+            for (size_t i = 0; i < size; i++)
+                mask |= uint32_t(pCtrl[i] < 0) << i;
+            return mask;
+#endif
+        }
+
+        // the position of the lowest bit set in a non-zero mask
+        static unsigned lowest(uint32_t mask)
+        {
+            assert(mask != 0);
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return unsigned(index);
+#else
+            return unsigned(__builtin_ctz(mask));
+#endif
+        }
+
+    private:
+#ifdef CUSTOM_SWISS_SSE2
+        __m128i ctrl;
+#else
+        const int8_t* pCtrl;
+#endif
+    };
+
+    /*****************************************************************
+     * SWISS TABLE
+     * The same interface as hash_table, laid out the Swiss-table way.
+     * The slots come in aligned groups of sixteen, each with sixteen
+     * control bytes kept apart from the slots. A lookup splits the
+     * mixed hash in two: the high bits pick the first group, the
+     * next seven are the fingerprint. Each group visited costs one
+     * 16-byte compare of control bytes, and a full key is compared
+     * only where the fingerprint matches, so a miss rarely touches a
+     * slot at all. Groups are visited in triangular steps, which
+     * reaches every group when there is a power of two of them. The
+     * search stops at the first group with an empty slot.
+     *
+     * An erase leaves the slot empty when its group already has an
+     * empty slot, since every search through that group stops there
+     * anyway. Only in a full group does it leave a tombstone, which
+     * the next insert along that path reuses; a rehash clears them.
+     *****************************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    class swiss_table
+    {
+        friend class ::TestHash; // give unit tests access to the privates
+    public:
+
+        //
+        // Construct
+        //
+        swiss_table() : slots(nullptr), ctrl(nullptr), numCapacity(0), numElements(0),
+                        numDeleted(0), maxLoad(0.875f), shift(sizeof(size_t) * 8) {}
+        swiss_table(const swiss_table& rhs);
+        swiss_table(swiss_table&& rhs) noexcept : swiss_table()
+        {
+            swap(rhs);
+        }
+        ~swiss_table()
+        {
+            clear();
+            release();
+        }
+
+        //
+        // Assign
+        //
+        swiss_table& operator = (const swiss_table& rhs)
+        {
+            swiss_table copy(rhs);
+            swap(copy);
+            return *this;
+        }
+        swiss_table& operator = (swiss_table&& rhs) noexcept
+        {
+            clear();
+            swap(rhs);
+            return *this;
+        }
+        void swap(swiss_table& rhs) noexcept
+        {
+            std::swap(slots, rhs.slots);
+            std::swap(ctrl, rhs.ctrl);
+            std::swap(numCapacity, rhs.numCapacity);
+            std::swap(numElements, rhs.numElements);
+            std::swap(numDeleted, rhs.numDeleted);
+            std::swap(maxLoad, rhs.maxLoad);
+            std::swap(shift, rhs.shift);
+        }
+
+        //
+        // Iterator
+        //
+        class iterator;
+        iterator begin() const { return iterator(this, next(0)); }
+        iterator end()   const { return iterator(this, numCapacity); }
+
+        //
+        // Access
+        //
+        template <class Q>
+        size_t findIndex(const Q& key) const
+        {
+            return findMixed(key, mix(Hash()(key)));
+        }
+        template <class Q, class ... Args>
+        std::pair<size_t, bool> emplaceKey(const Q& key, Args&& ... args);
+        Value& at(size_t index) const
+        {
+            assert(index < numCapacity && ctrl[index] >= 0);
+            return slots[index];
+        }
+
+        //
+        // Remove
+        //
+        size_t eraseIndex(size_t index);
+        void clear() noexcept;
+
+        //
+        // Status
+        //
+        size_t size()         const { return numElements; }
+        bool   empty()        const { return numElements == 0; }
+        size_t bucket_count() const { return numCapacity; }
+        float  load_factor()  const { return numCapacity == 0 ? 0.0f : float(numElements) / float(numCapacity); }
+        float  max_load_factor() const { return maxLoad; }
+        void   max_load_factor(float load);
+        void   reserve(size_t num);
+        void   rehash(size_t num);
+
+        // the first full slot at or after index, or end
+        size_t next(size_t index) const
+        {
+            while (index < numCapacity && ctrl[index] < 0)
+                index++;
+            return index;
+        }
+
+    private:
+
+        // Fibonacci hashing, as in hash_table. The top bits pick the
+        // first group and the seven below them are the fingerprint
+        size_t mix(size_t hash) const
+        {
+            return size_t(hash * size_t(0x9E3779B97F4A7C15ull));
+        }
+        size_t firstGroup(size_t mixed) const
+        {
+            return (mixed >> shift) / swiss_group::size;
+        }
+        int8_t fingerprint(size_t mixed) const
+        {
+            return int8_t((mixed >> (shift - 7)) & 0x7F);
+        }
+        size_t groupMask() const { return numCapacity / swiss_group::size - 1; }
+
+        template <class Q>
+        size_t findMixed(const Q& key, size_t mixed) const;
+        size_t findFree(size_t mixed) const;
+        void insertUnique(size_t mixed, Value&& value);
+        void allocate(size_t num);
+        void release() noexcept;
+        bool fits(size_t num) const
+        {
+            return num < numCapacity && float(num) <= maxLoad * float(numCapacity);
+        }
+
+        Value*  slots;          // raw storage, alive where ctrl[i] >= 0
+        int8_t* ctrl;           // one control byte per slot
+        size_t  numCapacity;    // a power of two, at least one group, or 0
+        size_t  numElements;
+        size_t  numDeleted;     // tombstones, which count towards the load
+        float   maxLoad;        // grow past this fraction of numCapacity
+        unsigned shift;         // bits to drop from a mixed hash to get a slot
+    };
+
+    /**************************************************
+     * SWISS TABLE ITERATOR
+     * Walks the slots in order, skipping the ones not full
+     *************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    class swiss_table <Key, Value, KeyOf, Hash, Equal> ::iterator
+    {
+        friend class ::TestHash; // give unit tests access to the privates
+    public:
+        //
+        // Construct
+        //
+        iterator() : pTable(nullptr), index(0) {}
+        iterator(const swiss_table* pTable, size_t index) : pTable(pTable), index(index) {}
+        iterator(const iterator& rhs) = default;
+
+        //
+        // Assign
+        //
+        iterator& operator = (const iterator& rhs) = default;
+
+        //
+        // Compare
+        //
+        bool operator == (const iterator& rhs) const { return index == rhs.index && pTable == rhs.pTable; }
+        bool operator != (const iterator& rhs) const { return !(*this == rhs); }
+
+        //
+        // Access
+        //
+        const Value& operator * () const { return pTable->at(index); }
+        size_t getIndex() const { return index; }
+
+        //
+        // Increment
+        //
+        iterator& operator ++ ()
+        {
+            index = pTable->next(index + 1);
+            return *this;
+        }
+
+        iterator operator ++ (int postfix)
+        {
+            iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+    private:
+        const swiss_table* pTable;
+        size_t index;
+    };
+
+    /*****************************************************
+     * SWISS TABLE :: COPY CONSTRUCTOR
+     * Same capacity and the same control bytes, so every
+     * element goes in the same slot
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    swiss_table <Key, Value, KeyOf, Hash, Equal> ::swiss_table(const swiss_table& rhs) : swiss_table()
+    {
+        maxLoad = rhs.maxLoad;
+        if (rhs.numCapacity == 0)
+            return;
+        allocate(rhs.numCapacity);
+        try
+        {
+            for (size_t i = 0; i < numCapacity; i++)
+                if (rhs.ctrl[i] >= 0)
+                {
+                    new (slots + i) Value(rhs.slots[i]);
+                    ctrl[i] = rhs.ctrl[i];
+                    numElements++;
+                }
+        }
+        catch (...)
+        {
+            clear();
+            release();
+            throw;
+        }
+        for (size_t i = 0; i < numCapacity; i++)
+            if (rhs.ctrl[i] == swiss_group::ctrlDeleted)
+                ctrl[i] = swiss_group::ctrlDeleted;
+        numDeleted = rhs.numDeleted;
+    }
+
+    /*****************************************************
+     * SWISS TABLE :: FIND MIXED
+     * The slot holding key, whose mixed hash we already have,
+     * or end if there is none. Only slots whose fingerprint
+     * matches have their key compared
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    template <class Q>
+    size_t swiss_table <Key, Value, KeyOf, Hash, Equal> ::findMixed(const Q& key, size_t mixed) const
+    {
+        if (numElements == 0)
+            return numCapacity;
+
+        int8_t h2 = fingerprint(mixed);
+        size_t iGroup = firstGroup(mixed);
+        for (size_t step = 1; ; step++)
+        {
+            size_t indexGroup = iGroup * swiss_group::size;
+            swiss_group group(ctrl + indexGroup);
+            for (uint32_t mask = group.match(h2); mask != 0; mask &= mask - 1)
+            {
+                size_t index = indexGroup + swiss_group::lowest(mask);
+                if (Equal()(KeyOf()(slots[index]), key))
+                    return index;
+            }
+            if (group.matchEmpty() != 0)
+                return numCapacity;
+            iGroup = (iGroup + step) & groupMask();
+        }
+    }
+
+    /*****************************************************
+     * SWISS TABLE :: FIND FREE
+     * The first empty or deleted slot on the path of a hash
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    size_t swiss_table <Key, Value, KeyOf, Hash, Equal> ::findFree(size_t mixed) const
+    {
+        size_t iGroup = firstGroup(mixed);
+        for (size_t step = 1; ; step++)
+        {
+            size_t indexGroup = iGroup * swiss_group::size;
+            uint32_t mask = swiss_group(ctrl + indexGroup).matchFree();
+            if (mask != 0)
+                return indexGroup + swiss_group::lowest(mask);
+            iGroup = (iGroup + step) & groupMask();
+        }
+    }
+
+    /*****************************************************
+     * SWISS TABLE :: EMPLACE KEY
+     * Find key, or build a Value from args in the first free
+     * slot on its path. Reusing a tombstone never needs a
+     * grow; taking an empty slot might
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    template <class Q, class ... Args>
+    std::pair<size_t, bool> swiss_table <Key, Value, KeyOf, Hash, Equal> ::emplaceKey(const Q& key, Args&& ... args)
+    {
+        size_t mixed = mix(Hash()(key));
+        size_t index = findMixed(key, mixed);
+        if (index != numCapacity)
+            return std::pair<size_t, bool>(index, false);
+
+        if (numCapacity != 0)
+            index = findFree(mixed);
+        if (numCapacity == 0 ||
+            (ctrl[index] == swiss_group::ctrlEmpty && !fits(numElements + numDeleted + 1)))
+        {
+            // mostly tombstones: sweep them out at the same size
+            rehash(fits(2 * (numElements + 1)) ? numCapacity : numCapacity * 2);
+            index = findFree(mixed);
+        }
+
+        new (slots + index) Value(std::forward<Args>(args)...);
+        if (ctrl[index] == swiss_group::ctrlDeleted)
+            numDeleted--;
+        ctrl[index] = fingerprint(mixed);
+        numElements++;
+        return std::pair<size_t, bool>(index, true);
+    }
+
+    /*****************************************************
+     * SWISS TABLE :: INSERT UNIQUE
+     * Move value into the first free slot on its path. The
+     * key is known to be new and there is known to be room
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    void swiss_table <Key, Value, KeyOf, Hash, Equal> ::insertUnique(size_t mixed, Value&& value)
+    {
+        size_t index = findFree(mixed);
+        new (slots + index) Value(std::move(value));
+        ctrl[index] = fingerprint(mixed);
+        numElements++;
+    }
+
+    /*****************************************************
+     * SWISS TABLE :: ERASE INDEX
+     * Destroy the element. Nothing moves, so the next element
+     * in iteration order is simply the next full slot
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    size_t swiss_table <Key, Value, KeyOf, Hash, Equal> ::eraseIndex(size_t index)
+    {
+        assert(index < numCapacity && ctrl[index] >= 0);
+        slots[index].~Value();
+        numElements--;
+
+        size_t indexGroup = index - index % swiss_group::size;
+        if (swiss_group(ctrl + indexGroup).matchEmpty() != 0)
+            ctrl[index] = swiss_group::ctrlEmpty;
+        else
+        {
+            ctrl[index] = swiss_group::ctrlDeleted;
+            numDeleted++;
+        }
+        return next(index);
+    }
+
+    /*****************************************************
+     * SWISS TABLE :: CLEAR
+     * Destroy every element but keep the slots
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    void swiss_table <Key, Value, KeyOf, Hash, Equal> ::clear() noexcept
+    {
+        for (size_t i = 0; i < numCapacity && numElements != 0; i++)
+            if (ctrl[i] >= 0)
+            {
+                slots[i].~Value();
+                numElements--;
+            }
+        assert(numElements == 0);
+        if (ctrl)
+            memset(ctrl, swiss_group::ctrlEmpty, numCapacity);
+        numDeleted = 0;
+    }
+
+    /*****************************************************
+     * SWISS TABLE :: MAX LOAD FACTOR
+     * Grow straight away if we are already past the new limit
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    void swiss_table <Key, Value, KeyOf, Hash, Equal> ::max_load_factor(float load)
+    {
+        assert(load > 0.0f && load <= 1.0f);
+        maxLoad = load;
+        if (!fits(numElements + numDeleted))
+            reserve(numElements);
+    }
+
+    /*****************************************************
+     * SWISS TABLE :: RESERVE
+     * Make room for num elements without growing again
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    void swiss_table <Key, Value, KeyOf, Hash, Equal> ::reserve(size_t num)
+    {
+        size_t numSlots = swiss_group::size;
+        while (num >= numSlots || float(num) > maxLoad * float(numSlots))
+            numSlots *= 2;
+        if (numSlots > numCapacity)
+            rehash(numSlots);
+    }
+
+    /*****************************************************
+     * SWISS TABLE :: REHASH
+     * Move every element into a new array of at least num
+     * slots, rounded up to a power of two and never too few
+     * for what we hold. The tombstones are left behind
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    void swiss_table <Key, Value, KeyOf, Hash, Equal> ::rehash(size_t num)
+    {
+        size_t numSlots = swiss_group::size;
+        while (numSlots < num || numElements >= numSlots ||
+               float(numElements) > maxLoad * float(numSlots))
+            numSlots *= 2;
+
+        swiss_table old;
+        swap(old);
+        maxLoad = old.maxLoad;
+        allocate(numSlots);
+
+        for (size_t i = 0; i < old.numCapacity; i++)
+            if (old.ctrl[i] >= 0)
+                insertUnique(mix(Hash()(KeyOf()(old.slots[i]))), std::move(old.slots[i]));
+    }
+
+    /*****************************************************
+     * SWISS TABLE :: ALLOCATE
+     * Empty arrays of num slots, a power of two of at least
+     * one group
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    void swiss_table <Key, Value, KeyOf, Hash, Equal> ::allocate(size_t num)
+    {
+        assert(slots == nullptr && ctrl == nullptr);
+        assert(num >= swiss_group::size && (num & (num - 1)) == 0);
+        ctrl = new int8_t[num];
+        memset(ctrl, swiss_group::ctrlEmpty, num);
+        try
+        {
+            slots = static_cast<Value*>(::operator new(num * sizeof(Value)));
+        }
+        catch (...)
+        {
+            delete [] ctrl;
+            ctrl = nullptr;
+            throw;
+        }
+        numCapacity = num;
+        shift = sizeof(size_t) * 8;
+        for (size_t n = num; n > 1; n /= 2)
+            shift--;
+    }
+
+    /*****************************************************
+     * SWISS TABLE :: RELEASE
+     * Give the arrays back. Any elements must be gone
+     ****************************************************/
+    template <class Key, class Value, class KeyOf, class Hash, class Equal>
+    void swiss_table <Key, Value, KeyOf, Hash, Equal> ::release() noexcept
+    {
+        assert(numElements == 0);
+        ::operator delete(slots);
+        delete [] ctrl;
+        slots = nullptr;
+        ctrl = nullptr;
+        numCapacity = 0;
+        numDeleted = 0;
+        shift = sizeof(size_t) * 8;
+    }
+
+    /*****************************************************
+     * SWISS SET, SWISS MAP
+     * unordered_set and unordered_map over a swiss_table
+     ****************************************************/
+    template <class T, class Hash = std::hash<T>, class Equal = std::equal_to<T>>
+    using swiss_set = unordered_set<T, Hash, Equal,
+                                    swiss_table<T, T, key_of_self<T>, Hash, Equal>>;
+
+    template <class K, class V, class Hash = std::hash<K>, class Equal = std::equal_to<K>>
+    using swiss_map = unordered_map<K, V, Hash, Equal,
+                                    swiss_table<K, custom::pair<K, V>, key_of_pair<K, custom::pair<K, V>>, Hash, Equal>>;
+
+}; // namespace custom
@@ -0,0 +1,377 @@
+/***********************************************************************
+ * Header:
+ *    TEST FLAT MAP
+ * Summary:
+ *    Unit tests for flat_map
+ * Author
+ *    <Noah, Josh, Steve>
+ ************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG
+
+#include "flat_map.h"
+#include "unitTest.h"
+#include "spy.h"
+
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+class TestFlatMap : public UnitTest
+{
+
+public:
+   void run()
+   {
+      reset();
+
+      // Construct
+      test_construct_default();
+      test_constructInit_unsorted();
+      test_constructRange_duplicates();
+      test_constructCopy_standard();
+      test_constructMove_standard();
+
+      // Access
+      test_find_standard();
+      test_find_missing();
+      test_squareBracket_read();
+      test_squareBracket_add();
+      test_at_missing();
+      test_atConst_standard();
+
+      // Insert
+      test_insert_middle();
+      test_insert_duplicate();
+      test_tryEmplace_spyNoCopy();
+      test_tryEmplace_existing();
+      test_insertRange_oldWins();
+
+      // Remove
+      test_erase_key();
+      test_erase_iterator();
+      test_erase_range();
+
+      // Iterator
+      test_iterator_walk();
+
+      report("FlatMap");
+   }
+
+   /***************************************
+    * CONSTRUCTOR
+    ***************************************/
+
+   void test_construct_default()
+   {  // setup
+      // exercise
+      custom::flat_map<int, std::string> m;
+      // verify
+      assertUnit(m.empty());
+      assertUnit(m.size() == 0);
+      assertUnit(m.begin() == m.end());
+   }  // teardown
+
+   // the pairs are sorted by key
+   void test_constructInit_unsorted()
+   {  // setup
+      // exercise
+      custom::flat_map<int, std::string> m{ { 60, "60" }, { 20, "20" }, { 80, "80" }, { 40, "40" },
+                                            { 50, "50" }, { 70, "70" }, { 30, "30" } };
+      // verify
+      assertStandardFixture(m);
+   }  // teardown
+
+   // the first pair with a key wins
+   void test_constructRange_duplicates()
+   {  // setup
+      custom::pair<int, std::string> pairs[] =
+      {
+         { 50, "50" }, { 30, "30" }, { 50, "xx" }, { 20, "20" }, { 80, "80" },
+         { 60, "60" }, { 40, "40" }, { 70, "70" }, { 20, "xx" }
+      };
+      // exercise
+      custom::flat_map<int, std::string> m(pairs, pairs + 9);
+      // verify
+      assertStandardFixture(m);
+   }  // teardown
+
+   void test_constructCopy_standard()
+   {  // setup
+      custom::flat_map<int, std::string> mSrc;
+      setupStandardFixture(mSrc);
+      // exercise
+      custom::flat_map<int, std::string> mDest(mSrc);
+      // verify
+      assertStandardFixture(mSrc);
+      assertStandardFixture(mDest);
+      assertUnit(mSrc.begin() != mDest.begin());
+   }  // teardown
+
+   void test_constructMove_standard()
+   {  // setup
+      custom::flat_map<int, std::string> mSrc;
+      setupStandardFixture(mSrc);
+      // exercise
+      custom::flat_map<int, std::string> mDest(std::move(mSrc));
+      // verify
+      assertStandardFixture(mDest);
+      assertUnit(mSrc.empty());
+   }  // teardown
+
+   /***************************************
+    * ACCESS
+    ***************************************/
+
+   void test_find_standard()
+   {  // setup
+      custom::flat_map<int, std::string> m;
+      setupStandardFixture(m);
+      // exercise
+      custom::flat_map<int, std::string>::iterator it = m.find(30);
+      // verify
+      assertUnit(it != m.end());
+      assertUnit((*it).first == 30);
+      assertUnit((*it).second == "30");
+      assertUnit(it.p == &m.elements[1]);
+   }  // teardown
+
+   void test_find_missing()
+   {  // setup
+      custom::flat_map<int, std::string> m;
+      setupStandardFixture(m);
+      // exercise and verify
+      assertUnit(m.find(10) == m.end());
+      assertUnit(m.find(55) == m.end());
+      assertUnit(m.find(99) == m.end());
+   }  // teardown
+
+   void test_squareBracket_read()
+   {  // setup
+      custom::flat_map<int, std::string> m;
+      setupStandardFixture(m);
+      // exercise
+      std::string s = m[70];
+      // verify
+      assertUnit(s == "70");
+      assertStandardFixture(m);
+   }  // teardown
+
+   // a missing key is added in order with a default value
+   void test_squareBracket_add()
+   {  // setup
+      custom::flat_map<int, std::string> m{ { 20, "20" }, { 30, "30" }, { 40, "40" },
+                                            { 60, "60" }, { 70, "70" }, { 80, "80" } };
+      // exercise
+      m[50] = "50";
+      // verify
+      assertStandardFixture(m);
+   }  // teardown
+
+   void test_at_missing()
+   {  // setup
+      custom::flat_map<int, std::string> m;
+      setupStandardFixture(m);
+      bool thrown = false;
+      // exercise
+      try
+      {
+         m.at(55);
+      }
+      catch (const std::out_of_range&)
+      {
+         thrown = true;
+      }
+      // verify
+      assertUnit(thrown);
+      assertStandardFixture(m);
+   }  // teardown
+
+   void test_atConst_standard()
+   {  // setup
+      custom::flat_map<int, std::string> m;
+      setupStandardFixture(m);
+      const custom::flat_map<int, std::string>& mConst = m;
+      // exercise
+      const std::string& s = mConst.at(80);
+      // verify
+      assertUnit(s == "80");
+      assertUnit(mConst[20] == "20");
+   }  // teardown
+
+   /***************************************
+    * INSERT
+    ***************************************/
+
+   void test_insert_middle()
+   {  // setup
+      custom::flat_map<int, std::string> m{ { 20, "20" }, { 30, "30" }, { 50, "50" },
+                                            { 60, "60" }, { 70, "70" }, { 80, "80" } };
+      custom::pair<int, std::string> p(40, "40");
+      // exercise
+      custom::pair<custom::flat_map<int, std::string>::iterator, bool> result = m.insert(p);
+      // verify
+      assertUnit(result.second);
+      assertUnit((*result.first).first == 40);
+      assertStandardFixture(m);
+   }  // teardown
+
+   // inserting a key that is there leaves its value alone
+   void test_insert_duplicate()
+   {  // setup
+      custom::flat_map<int, std::string> m;
+      setupStandardFixture(m);
+      // exercise
+      custom::pair<custom::flat_map<int, std::string>::iterator, bool> result =
+         m.insert(custom::pair<int, std::string>(60, "xx"));
+      // verify
+      assertUnit(!result.second);
+      assertUnit(result.first.p == &m.elements[4]);
+      assertStandardFixture(m);
+   }  // teardown
+
+   // the value is built in place
+   void test_tryEmplace_spyNoCopy()
+   {  // setup
+      custom::flat_map<int, Spy> m;
+      m.reserve(2);
+      Spy::reset();
+      // exercise
+      m.try_emplace(50, 5);
+      m.try_emplace(30, 3);
+      // verify
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numNondefault() == 2);
+      assertUnit(m.size() == 2);
+      assertUnit(m.elements[0].first == 30);
+      assertUnit(m.elements[0].second.get() == 3);
+      assertUnit(m.elements[1].second.get() == 5);
+   }  // teardown
+
+   // nothing is built for a key we already have
+   void test_tryEmplace_existing()
+   {  // setup
+      custom::flat_map<int, Spy> m;
+      m.try_emplace(50, 5);
+      Spy::reset();
+      // exercise
+      custom::pair<custom::flat_map<int, Spy>::iterator, bool> result = m.try_emplace(50, 9);
+      // verify
+      assertUnit(!result.second);
+      assertUnit(Spy::numNondefault() == 0);
+      assertUnit(m.elements[0].second.get() == 5);
+   }  // teardown
+
+   // a range is merged in and the pair already there wins
+   void test_insertRange_oldWins()
+   {  // setup
+      custom::flat_map<int, std::string> m{ { 20, "20" }, { 50, "50" }, { 80, "80" } };
+      custom::pair<int, std::string> pairs[] =
+      {
+         { 70, "70" }, { 30, "30" }, { 50, "xx" }, { 60, "60" }, { 40, "40" }
+      };
+      // exercise
+      m.insert(pairs, pairs + 5);
+      // verify
+      assertStandardFixture(m);
+   }  // teardown
+
+   /***************************************
+    * REMOVE
+    ***************************************/
+
+   void test_erase_key()
+   {  // setup
+      custom::flat_map<int, std::string> m;
+      setupStandardFixture(m);
+      m[45] = "45";
+      // exercise
+      size_t numMissing = m.erase(99);
+      size_t numErased = m.erase(45);
+      // verify
+      assertUnit(numMissing == 0);
+      assertUnit(numErased == 1);
+      assertStandardFixture(m);
+   }  // teardown
+
+   // erasing returns the pair after
+   void test_erase_iterator()
+   {  // setup
+      custom::flat_map<int, std::string> m;
+      setupStandardFixture(m);
+      m[90] = "90";
+      // exercise
+      custom::flat_map<int, std::string>::iterator it = m.erase(m.find(90));
+      // verify
+      assertUnit(it == m.end());
+      assertStandardFixture(m);
+   }  // teardown
+
+   void test_erase_range()
+   {  // setup
+      custom::flat_map<int, std::string> m;
+      setupStandardFixture(m);
+      // exercise
+      custom::flat_map<int, std::string>::iterator it = m.erase(m.find(30), m.find(70));
+      // verify
+      assertUnit(m.size() == 3);
+      assertUnit((*it).first == 70);
+      assertUnit(m.elements[0].first == 20);
+      assertUnit(m.elements[1].first == 70);
+      assertUnit(m.elements[2].second == "80");
+   }  // teardown
+
+   /***************************************
+    * ITERATOR
+    ***************************************/
+
+   // forward through every pair, then back again
+   void test_iterator_walk()
+   {  // setup
+      custom::flat_map<int, std::string> m;
+      setupStandardFixture(m);
+      bool inOrder = true;
+      int key = 20;
+      // exercise
+      for (custom::flat_map<int, std::string>::iterator it = m.begin(); it != m.end(); ++it, key += 10)
+         inOrder = inOrder && (*it).first == key;
+      custom::flat_map<int, std::string>::iterator it = m.end();
+      it--;
+      // verify
+      assertUnit(inOrder);
+      assertUnit(key == 90);
+      assertUnit((*it).first == 80);
+   }  // teardown
+
+   /***************************************************
+    * SETUP STANDARD FIXTURE
+    *    20:"20" 30:"30" 40:"40" 50:"50" 60:"60" 70:"70" 80:"80"
+    ***************************************************/
+   void setupStandardFixture(custom::flat_map<int, std::string>& m)
+   {
+      for (int i = 20; i <= 80; i += 10)
+         m.elements.push_back(custom::pair<int, std::string>(i, std::to_string(i)));
+   }
+
+   /***************************************************
+    * VERIFY STANDARD FIXTURE
+    *    20:"20" 30:"30" 40:"40" 50:"50" 60:"60" 70:"70" 80:"80"
+    ***************************************************/
+   void assertStandardFixtureParameters(const custom::flat_map<int, std::string>& m, int line, const char* function)
+   {
+      assertIndirect(m.size() == 7);
+      if (m.size() != 7)
+         return;
+      for (size_t i = 0; i < 7; i++)
+      {
+         assertIndirect(m.elements[i].first == int(20 + 10 * i));
+         assertIndirect(m.elements[i].second == std::to_string(20 + 10 * i));
+      }
+   }
+};
+
+#endif // DEBUG
@@ -0,0 +1,661 @@
+/***********************************************************************
+ * Header:
+ *    TEST HASH
+ * Summary:
+ *    Unit tests for hash_table, swiss_table, unordered_set and unordered_map
+ * Author
+ *    <Noah, Josh, Steve>
+ ************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG
+
+#include "unordered_set.h"
+#include "unordered_map.h"
+#include "swiss.h"
+#include "unitTest.h"
+#include "spy.h"
+
+#include <cassert>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#define assertRobinHood(x) assertRobinHoodParameters(x, __LINE__, __FUNCTION__)
+#define assertSwiss(x)     assertSwissParameters(x, __LINE__, __FUNCTION__)
+
+class TestHash : public UnitTest
+{
+
+public:
+   void run()
+   {
+      reset();
+
+      // Construct
+      test_construct_default();
+      test_constructInit_standard();
+      test_constructCopy_standard();
+      test_constructMove_standard();
+
+      // Access
+      test_find_standard();
+      test_find_missing();
+      test_findTransparent_string();
+
+      // Insert
+      test_insert_duplicate();
+      test_insertMove_spyNoCopy();
+      test_insert_grow();
+      test_reserve_noRehash();
+      test_insert_robinHood();
+
+      // Remove
+      test_erase_value();
+      test_erase_whileIterating();
+      test_erase_robinHood();
+
+      // Map
+      test_mapSquareBracket_add();
+      test_mapSquareBracket_read();
+      test_mapAt_missing();
+      test_mapAtTransparent_string();
+      test_mapTryEmplace_spyNoCopy();
+      test_mapInsert_duplicate();
+      test_mapErase_key();
+
+      // Swiss
+      test_swissGroup_match();
+      test_swiss_grow();
+      test_swissFindTransparent_string();
+      test_swissErase_noTombstone();
+      test_swissErase_tombstone();
+      test_swissErase_whileIterating();
+      test_swissMapTryEmplace_spyNoCopy();
+
+      report("Hash");
+   }
+
+   /***************************************
+    * CONSTRUCTOR
+    ***************************************/
+
+   void test_construct_default()
+   {  // setup
+      // exercise
+      custom::unordered_set<int> s;
+      // verify
+      assertUnit(s.empty());
+      assertUnit(s.size() == 0);
+      assertUnit(s.bucket_count() == 0);
+      assertUnit(s.begin() == s.end());
+      assertUnit(s.find(50) == s.end());
+   }  // teardown
+
+   void test_constructInit_standard()
+   {  // setup
+      // exercise
+      custom::unordered_set<int> s{ 60, 20, 80, 40, 50, 70, 30, 40 };
+      // verify
+      assertStandardFixture(s);
+   }  // teardown
+
+   // the copy has the same slots, so nothing is rehashed
+   void test_constructCopy_standard()
+   {  // setup
+      custom::unordered_set<int> sSrc;
+      setupStandardFixture(sSrc);
+      // exercise
+      custom::unordered_set<int> sDest(sSrc);
+      // verify
+      assertStandardFixture(sSrc);
+      assertStandardFixture(sDest);
+      assertUnit(sDest.table.slots != sSrc.table.slots);
+      assertUnit(sDest.bucket_count() == sSrc.bucket_count());
+      for (size_t i = 0; i < sSrc.table.numSlots; i++)
+         assertUnit(sDest.table.probes[i] == sSrc.table.probes[i]);
+   }  // teardown
+
+   void test_constructMove_standard()
+   {  // setup
+      custom::unordered_set<int> sSrc;
+      setupStandardFixture(sSrc);
+      // exercise
+      custom::unordered_set<int> sDest(std::move(sSrc));
+      // verify
+      assertStandardFixture(sDest);
+      assertUnit(sSrc.empty());
+      assertUnit(sSrc.bucket_count() == 0);
+   }  // teardown
+
+   /***************************************
+    * ACCESS
+    ***************************************/
+
+   void test_find_standard()
+   {  // setup
+      custom::unordered_set<int> s;
+      setupStandardFixture(s);
+      // exercise
+      custom::unordered_set<int>::iterator it = s.find(70);
+      // verify
+      assertUnit(it != s.end());
+      assertUnit(*it == 70);
+      assertUnit(&*it == &s.table.slots[it.getIndex()]);
+   }  // teardown
+
+   void test_find_missing()
+   {  // setup
+      custom::unordered_set<int> s;
+      setupStandardFixture(s);
+      // exercise and verify
+      assertUnit(s.find(10) == s.end());
+      assertUnit(s.find(55) == s.end());
+      assertUnit(s.count(99) == 0);
+      assertUnit(s.count(20) == 1);
+   }  // teardown
+
+   // a set of strings searched with a char* and a std::string
+   void test_findTransparent_string()
+   {  // setup
+      custom::unordered_set<std::string, custom::string_hash, std::equal_to<>> s{ "alpha", "beta", "gamma" };
+      std::string str("gamma");
+      // exercise
+      auto itChar = s.find("beta");
+      auto itString = s.find(str);
+      // verify
+      assertUnit(custom::string_hash()("gamma") == custom::string_hash()(str));
+      assertUnit(itChar != s.end());
+      assertUnit(*itChar == "beta");
+      assertUnit(itString != s.end());
+      assertUnit(*itString == "gamma");
+      assertUnit(s.find("delta") == s.end());
+      assertUnit(s.count("alpha") == 1);
+   }  // teardown
+
+   /***************************************
+    * INSERT
+    ***************************************/
+
+   void test_insert_duplicate()
+   {  // setup
+      custom::unordered_set<int> s;
+      setupStandardFixture(s);
+      size_t indexOld = s.find(40).getIndex();
+      // exercise
+      std::pair<custom::unordered_set<int>::iterator, bool> result = s.insert(40);
+      // verify
+      assertUnit(!result.second);
+      assertUnit(*result.first == 40);
+      assertUnit(result.first.getIndex() == indexOld);
+      assertStandardFixture(s);
+   }  // teardown
+
+   // moving in moves, and a duplicate is neither copied nor moved
+   void test_insertMove_spyNoCopy()
+   {  // setup
+      custom::unordered_set<Spy, SpyHash> s;
+      s.reserve(4);
+      Spy s50(50);
+      Spy s30(30);
+      Spy again(50);
+      Spy::reset();
+      // exercise
+      s.insert(std::move(s50));
+      s.insert(std::move(s30));
+      s.insert(std::move(again));
+      // verify
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(s.size() == 2);
+      assertUnit(again.get() == 50);
+      assertUnit(s.find(Spy(30)) != s.end());
+   }  // teardown
+
+   // the table doubles to stay under the load factor
+   void test_insert_grow()
+   {  // setup
+      custom::unordered_set<int> s;
+      bool allFound = true;
+      // exercise
+      for (int i = 0; i < 10000; i++)
+         s.insert(i * 7);
+      // verify
+      for (int i = 0; i < 10000; i++)
+         allFound = allFound && s.find(i * 7) != s.end() && s.find(i * 7 + 1) == s.end();
+      assertUnit(allFound);
+      assertUnit(s.size() == 10000);
+      assertUnit(s.load_factor() <= s.max_load_factor());
+      assertUnit((s.bucket_count() & (s.bucket_count() - 1)) == 0);
+      assertRobinHood(s);
+   }  // teardown
+
+   // after reserve, nothing moves to a new array
+   void test_reserve_noRehash()
+   {  // setup
+      custom::unordered_set<int> s;
+      s.reserve(1000);
+      const int* pSlots = s.table.slots;
+      size_t numBuckets = s.bucket_count();
+      // exercise
+      for (int i = 0; i < 1000; i++)
+         s.insert(i);
+      // verify
+      assertUnit(s.size() == 1000);
+      assertUnit(s.table.slots == pSlots);
+      assertUnit(s.bucket_count() == numBuckets);
+   }  // teardown
+
+   // keys that share a home stay together, in probe order
+   void test_insert_robinHood()
+   {  // setup
+      custom::unordered_set<int, SameHash> s;
+      s.reserve(20);
+      // exercise
+      for (int i = 0; i < 10; i++)
+         s.insert(i);
+      // verify
+      assertUnit(s.size() == 10);
+      assertRobinHood(s);
+      for (int i = 0; i < 10; i++)
+         assertUnit(s.table.probes[i] == i + 1);
+      assertUnit(s.table.probes[10] == 0);
+   }  // teardown
+
+   /***************************************
+    * REMOVE
+    ***************************************/
+
+   void test_erase_value()
+   {  // setup
+      custom::unordered_set<int> s{ 20, 30, 40, 45, 50, 60, 70, 80 };
+      // exercise
+      size_t numMissing = s.erase(99);
+      size_t numErased = s.erase(45);
+      // verify
+      assertUnit(numMissing == 0);
+      assertUnit(numErased == 1);
+      assertStandardFixture(s);
+      assertRobinHood(s);
+   }  // teardown
+
+   // erasing while walking sees every element exactly once
+   void test_erase_whileIterating()
+   {  // setup
+      custom::unordered_set<int> s;
+      for (int i = 0; i < 1000; i++)
+         s.insert(i);
+      int numVisited = 0;
+      // exercise
+      for (custom::unordered_set<int>::iterator it = s.begin(); it != s.end(); numVisited++)
+         if (*it % 2 == 0)
+            it = s.erase(it);
+         else
+            ++it;
+      // verify
+      assertUnit(numVisited == 1000);
+      assertUnit(s.size() == 500);
+      for (int i = 0; i < 1000; i++)
+         assertUnit(s.count(i) == size_t(i % 2));
+      assertRobinHood(s);
+   }  // teardown
+
+   // the run closes up behind an erase, with no tombstones
+   void test_erase_robinHood()
+   {  // setup
+      custom::unordered_set<int, SameHash> s;
+      s.reserve(20);
+      for (int i = 0; i < 10; i++)
+         s.insert(i);
+      // exercise
+      s.erase(3);
+      s.erase(0);
+      // verify
+      assertUnit(s.size() == 8);
+      assertRobinHood(s);
+      for (int i = 0; i < 8; i++)
+         assertUnit(s.table.probes[i] == i + 1);
+      assertUnit(s.table.probes[8] == 0);
+      assertUnit(s.find(3) == s.end());
+      assertUnit(s.find(9) != s.end());
+   }  // teardown
+
+   /***************************************
+    * MAP
+    ***************************************/
+
+   // a missing key is added with a default value
+   void test_mapSquareBracket_add()
+   {  // setup
+      custom::unordered_map<int, std::string> m;
+      // exercise
+      m[50] = "50";
+      std::string& s = m[30];
+      // verify
+      assertUnit(m.size() == 2);
+      assertUnit(s.empty());
+      assertUnit(m.at(50) == "50");
+   }  // teardown
+
+   void test_mapSquareBracket_read()
+   {  // setup
+      custom::unordered_map<int, std::string> m{ { 20, "20" }, { 50, "50" }, { 80, "80" } };
+      const custom::unordered_map<int, std::string>& mConst = m;
+      // exercise
+      std::string s = m[50];
+      // verify
+      assertUnit(s == "50");
+      assertUnit(mConst[80] == "80");
+      assertUnit(m.size() == 3);
+   }  // teardown
+
+   void test_mapAt_missing()
+   {  // setup
+      custom::unordered_map<int, std::string> m{ { 20, "20" }, { 50, "50" } };
+      bool thrown = false;
+      // exercise
+      try
+      {
+         m.at(55);
+      }
+      catch (const std::out_of_range&)
+      {
+         thrown = true;
+      }
+      // verify
+      assertUnit(thrown);
+      assertUnit(m.size() == 2);
+   }  // teardown
+
+   void test_mapAtTransparent_string()
+   {  // setup
+      custom::unordered_map<std::string, int, custom::string_hash, std::equal_to<>> m;
+      m["one"] = 1;
+      m["two"] = 2;
+      // exercise
+      int two = m.at("two");
+      // verify
+      assertUnit(two == 2);
+      assertUnit(m.find("one") != m.end());
+      assertUnit(m.erase("one") == 1);
+      assertUnit(m.size() == 1);
+   }  // teardown
+
+   // the value is built in place, and only once
+   void test_mapTryEmplace_spyNoCopy()
+   {  // setup
+      custom::unordered_map<int, Spy> m;
+      m.reserve(2);
+      Spy::reset();
+      // exercise
+      m.try_emplace(50, 5);
+      m.try_emplace(30, 3);
+      m.try_emplace(50, 9);
+      // verify
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numNondefault() == 2);
+      assertUnit(m.size() == 2);
+      assertUnit(m.at(50).get() == 5);
+      assertUnit(m.at(30).get() == 3);
+   }  // teardown
+
+   // inserting a key that is there leaves its value alone
+   void test_mapInsert_duplicate()
+   {  // setup
+      custom::unordered_map<int, std::string> m{ { 20, "20" }, { 50, "50" } };
+      // exercise
+      custom::pair<custom::unordered_map<int, std::string>::iterator, bool> result =
+         m.insert(custom::pair<int, std::string>(50, "xx"));
+      // verify
+      assertUnit(!result.second);
+      assertUnit((*result.first).second == "50");
+      assertUnit(m.size() == 2);
+   }  // teardown
+
+   void test_mapErase_key()
+   {  // setup
+      custom::unordered_map<int, std::string> m{ { 20, "20" }, { 50, "50" }, { 80, "80" } };
+      // exercise
+      size_t numMissing = m.erase(99);
+      size_t numErased = m.erase(50);
+      // verify
+      assertUnit(numMissing == 0);
+      assertUnit(numErased == 1);
+      assertUnit(m.size() == 2);
+      assertUnit(m.count(50) == 0);
+      assertUnit(m.at(80) == "80");
+   }  // teardown
+
+   /***************************************
+    * SWISS
+    ***************************************/
+
+   // one bit per matching control byte
+   void test_swissGroup_match()
+   {  // setup
+      int8_t ctrl[16];
+      for (int i = 0; i < 16; i++)
+         ctrl[i] = custom::swiss_group::ctrlEmpty;
+      ctrl[1] = 5;
+      ctrl[4] = 5;
+      ctrl[7] = custom::swiss_group::ctrlDeleted;
+      ctrl[15] = 9;
+      // exercise
+      custom::swiss_group group(ctrl);
+      // verify
+      assertUnit(group.match(5) == ((1u << 1) | (1u << 4)));
+      assertUnit(group.match(9) == (1u << 15));
+      assertUnit(group.match(0) == 0);
+      assertUnit(group.matchEmpty() == (0xFFFFu & ~((1u << 1) | (1u << 4) | (1u << 7) | (1u << 15))));
+      assertUnit(group.matchFree() == (0xFFFFu & ~((1u << 1) | (1u << 4) | (1u << 15))));
+      assertUnit(custom::swiss_group::lowest(1u << 4 | 1u << 9) == 4);
+   }  // teardown
+
+   // every key is found, every full slot holds its fingerprint
+   void test_swiss_grow()
+   {  // setup
+      custom::swiss_set<int> s;
+      bool allFound = true;
+      // exercise
+      for (int i = 0; i < 10000; i++)
+         s.insert(i * 7);
+      // verify
+      for (int i = 0; i < 10000; i++)
+         allFound = allFound && s.find(i * 7) != s.end() && s.find(i * 7 + 1) == s.end();
+      assertUnit(allFound);
+      assertUnit(s.size() == 10000);
+      assertUnit(s.load_factor() <= s.max_load_factor());
+      assertSwiss(s);
+   }  // teardown
+
+   void test_swissFindTransparent_string()
+   {  // setup
+      custom::swiss_set<std::string, custom::string_hash, std::equal_to<>> s{ "alpha", "beta", "gamma" };
+      // exercise
+      auto it = s.find("beta");
+      // verify
+      assertUnit(it != s.end());
+      assertUnit(*it == "beta");
+      assertUnit(s.find("delta") == s.end());
+      assertUnit(s.erase("gamma") == 1);
+      assertUnit(s.size() == 2);
+   }  // teardown
+
+   // a group with an empty slot needs no tombstone
+   void test_swissErase_noTombstone()
+   {  // setup
+      custom::swiss_set<int> s{ 20, 30, 40, 50 };
+      size_t index = s.find(30).getIndex();
+      // exercise
+      s.erase(30);
+      // verify
+      assertUnit(s.size() == 3);
+      assertUnit(s.table.numDeleted == 0);
+      assertUnit(s.table.ctrl[index] == custom::swiss_group::ctrlEmpty);
+      assertUnit(s.find(30) == s.end());
+      assertSwiss(s);
+   }  // teardown
+
+   // a full group leaves a tombstone, and the next insert reuses it
+   void test_swissErase_tombstone()
+   {  // setup
+      custom::swiss_set<int, SameHash> s;
+      s.reserve(40);
+      for (int i = 0; i < 20; i++)
+         s.insert(i);
+      size_t index = s.find(5).getIndex();
+      // exercise
+      s.erase(5);
+      s.erase(18);
+      // verify
+      assertUnit(index < 16);
+      assertUnit(s.table.ctrl[index] == custom::swiss_group::ctrlDeleted);
+      assertUnit(s.table.numDeleted == 1);
+      assertUnit(s.find(17) != s.end());
+      assertUnit(s.find(19) != s.end());
+      s.insert(99);
+      assertUnit(s.find(99).getIndex() == index);
+      assertUnit(s.table.numDeleted == 0);
+      assertSwiss(s);
+   }  // teardown
+
+   // erasing while walking sees every element exactly once
+   void test_swissErase_whileIterating()
+   {  // setup
+      custom::swiss_set<int> s;
+      for (int i = 0; i < 1000; i++)
+         s.insert(i);
+      int numVisited = 0;
+      // exercise
+      for (custom::swiss_set<int>::iterator it = s.begin(); it != s.end(); numVisited++)
+         if (*it % 2 == 0)
+            it = s.erase(it);
+         else
+            ++it;
+      // verify
+      assertUnit(numVisited == 1000);
+      assertUnit(s.size() == 500);
+      for (int i = 0; i < 1000; i++)
+         assertUnit(s.count(i) == size_t(i % 2));
+      assertSwiss(s);
+   }  // teardown
+
+   // pairs are custom::pair, built in place
+   void test_swissMapTryEmplace_spyNoCopy()
+   {  // setup
+      custom::swiss_map<int, Spy> m;
+      m.reserve(2);
+      Spy::reset();
+      // exercise
+      m.try_emplace(50, 5);
+      m.try_emplace(30, 3);
+      m.try_emplace(50, 9);
+      // verify
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numNondefault() == 2);
+      assertUnit(m.size() == 2);
+      assertUnit(m.at(50).get() == 5);
+      assertUnit(m[30].get() == 3);
+   }  // teardown
+
+   /***************************************************
+    * HASHES FOR THE TESTS
+    *    SpyHash:  hash a Spy by its value
+    *    SameHash: every key has the same home
+    ***************************************************/
+   struct SpyHash
+   {
+      size_t operator () (const Spy& s) const { return std::hash<int>()(s.get()); }
+   };
+   struct SameHash
+   {
+      size_t operator () (int) const { return 0; }
+   };
+
+   /***************************************************
+    * SETUP STANDARD FIXTURE
+    *    20 30 40 50 60 70 80
+    ***************************************************/
+   void setupStandardFixture(custom::unordered_set<int>& s)
+   {
+      for (int i = 20; i <= 80; i += 10)
+         s.insert(i);
+   }
+
+   /***************************************************
+    * VERIFY STANDARD FIXTURE
+    *    20 30 40 50 60 70 80, each once
+    ***************************************************/
+   void assertStandardFixtureParameters(const custom::unordered_set<int>& s, int line, const char* function)
+   {
+      assertIndirect(s.size() == 7);
+      int numSeen[7] = {};
+      for (custom::unordered_set<int>::iterator it = s.begin(); it != s.end(); ++it)
+      {
+         int i = (*it - 20) / 10;
+         assertIndirect(*it % 10 == 0 && i >= 0 && i < 7);
+         if (*it % 10 == 0 && i >= 0 && i < 7)
+            numSeen[i]++;
+      }
+      for (int i = 0; i < 7; i++)
+         assertIndirect(numSeen[i] == 1);
+   }
+
+   /***************************************************
+    * VERIFY ROBIN HOOD
+    *    each probe byte says how far the element is from
+    *    home, no element is further from home than the
+    *    one before it is plus one, and the last slot is empty
+    ***************************************************/
+   template <class T, class H, class E>
+   void assertRobinHoodParameters(const custom::unordered_set<T, H, E>& s, int line, const char* function)
+   {
+      const auto& table = s.table;
+      size_t numFound = 0;
+      for (size_t i = 0; i < table.numSlots; i++)
+      {
+         if (table.probes[i] == 0)
+            continue;
+         numFound++;
+         assertIndirect(table.home(H()(table.slots[i])) + table.probes[i] - 1 == i);
+         if (table.probes[i] > 1)
+            assertIndirect(i > 0 && table.probes[i - 1] + 1 >= table.probes[i]);
+      }
+      assertIndirect(numFound == s.size());
+      assertIndirect(table.numSlots == 0 || table.probes[table.numSlots - 1] == 0);
+   }
+
+   /***************************************************
+    * VERIFY SWISS
+    *    each full control byte is the fingerprint of its
+    *    key, the tombstone count is right, and there is
+    *    always an empty slot to end a search
+    ***************************************************/
+   template <class T, class H, class E>
+   void assertSwissParameters(const custom::swiss_set<T, H, E>& s, int line, const char* function)
+   {
+      const auto& table = s.table;
+      size_t numFull = 0;
+      size_t numDeleted = 0;
+      size_t numEmpty = 0;
+      for (size_t i = 0; i < table.numCapacity; i++)
+         if (table.ctrl[i] >= 0)
+         {
+            numFull++;
+            assertIndirect(table.ctrl[i] == table.fingerprint(table.mix(H()(table.slots[i]))));
+         }
+         else if (table.ctrl[i] == custom::swiss_group::ctrlDeleted)
+            numDeleted++;
+         else
+            numEmpty++;
+      assertIndirect(numFull == s.size());
+      assertIndirect(numDeleted == table.numDeleted);
+      assertIndirect(table.numCapacity == 0 || numEmpty > 0);
+   }
+};
+
+#endif // DEBUG
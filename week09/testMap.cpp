@@ -14,8 +14,11 @@
 
 #include "testSpy.h"       // for the spy unit tests
 #include "testPair.h"      // for the pair unit tests
+#include "testPool.h"      // for the pool allocator unit tests
 #include "testBST.h"       // for the BST unit tests
 #include "testMap.h"       // for the map unit tests
+#include "testFlatMap.h"   // for the flat map unit tests
+#include "testHash.h"      // for the unordered set and map unit tests
 int Spy::counters[] = {};
 
 /**********************************************************************
@@ -28,8 +31,11 @@ int main()
    // unit tests
    TestSpy().run();
    TestPair().run();
+   TestPool().run();
    TestBST().run();
    TestMap().run();
+   TestFlatMap().run();
+   TestHash().run();
 #endif // DEBUG
    
    return 0;
@@ -12,10 +12,12 @@
 
 #include "map.h"        // class under test
 #include "unitTest.h"   // unit test baseclass
+#include "spy.h"        // for counting value constructions
 
 
 #include <map>
 #include <vector>
+#include <sstream>
 
 /***********************************************
  * TEST MAP
@@ -81,6 +83,7 @@ public:
       test_access_emptyWrite();
       test_access_standardFrontInsert();
       test_access_standardMiddleInsert();
+      test_access_silent();
       test_at_standardRootRead();
       test_at_standardLeftRead();
       test_at_standardRightRead();
@@ -94,6 +97,8 @@ public:
       test_find_standardLeft();
       test_find_standardRight();
       test_find_standardMissing();
+      test_find_spyValue();
+      test_access_spyValue();
 
       // Insert
       test_insertCopy_empty();
@@ -101,6 +106,8 @@ public:
       test_insertCopy_standardMiddle();
       test_insertMove_empty();
       test_insertMove_standard();
+      test_tryEmplace_empty();
+      test_tryEmplace_standardExisting();
 
       // Remove
       test_clear_empty();
@@ -1287,6 +1294,59 @@ public:
       teardownStandardFixture(m);
    }
 
+   // looking up a key never builds a value
+   void test_find_spyValue()
+   {  // setup
+      custom::map<int, Spy> m;
+      m.insert(custom::pair<int, Spy>(50, Spy(50)));
+      m.insert(custom::pair<int, Spy>(30, Spy(30)));
+      m.insert(custom::pair<int, Spy>(70, Spy(70)));
+      Spy::reset();
+      // exercise
+      auto itFound = m.find(30);
+      auto itMissing = m.find(60);
+      const Spy& s = m.at(70);
+      size_t numErased = m.erase(40);
+      auto result = m.try_emplace(50, 99);
+      // verify
+      assertUnit(Spy::numDefault() == 0);
+      assertUnit(Spy::numNondefault() == 0);
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numCopyMove() == 0);
+      assertUnit(Spy::numAlloc() == 0);
+      assertUnit(Spy::numDestructor() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numAssignMove() == 0);
+      assertUnit(itFound != m.end());
+      assertUnit(itMissing == m.end());
+      assertUnit(s.get() == 70);
+      assertUnit(numErased == 0);
+      assertUnit(result.second == false);
+      assertUnit(m.size() == 3);
+   }  // teardown
+
+   // the square bracket operator only builds a value when it inserts
+   void test_access_spyValue()
+   {  // setup
+      custom::map<int, Spy> m;
+      m.insert(custom::pair<int, Spy>(50, Spy(50)));
+      Spy::reset();
+      // exercise
+      int existing = m[50].get();
+      Spy& added = m[60];
+      // verify
+      assertUnit(Spy::numDefault() == 1);     // default-create [60]
+      assertUnit(Spy::numNondefault() == 0);
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numCopyMove() == 0);
+      assertUnit(Spy::numDestructor() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numAssignMove() == 0);
+      assertUnit(existing == 50);
+      assertUnit(added.empty());
+      assertUnit(m.size() == 2);
+   }  // teardown
+
    /***************************************
     * INSERT
     *    map::insert(const T &)
@@ -1557,6 +1617,47 @@ public:
    }
 
 
+   // try_emplace on an empty map adds the element
+   void test_tryEmplace_empty()
+   {  // setup
+      custom::map<std::string, int> m;
+      // exercise
+      auto result = m.try_emplace(std::string("50"), 50);
+      // verify
+      assertUnit(result.second == true);
+      assertUnit(result.first != m.end());
+      assertUnit(m.bst.numElements == 1);
+      assertUnit(m.bst.root != nullptr);
+      if (m.bst.root)
+      {
+         assertUnit(m.bst.root->data.first == std::string("50"));
+         assertUnit(m.bst.root->data.second == int(50));
+      }
+      // teardown
+      teardownStandardFixture(m);
+   }
+
+   // try_emplace leaves an existing element alone
+   void test_tryEmplace_standardExisting()
+   {  // setup
+      //    "30"     "50"     "70"   = m
+      //   +----+   +----+   +----+
+      //   | 30 | - | 50 | - | 70 |
+      //   +----+   +----+   +----+
+      custom::map<std::string, int> m;
+      setupStandardFixture(m);
+      // exercise
+      auto result = m.try_emplace(std::string("30"), 99);
+      // verify
+      assertUnit(result.second == false);
+      assertUnit(result.first != m.end());
+      if (result.first != m.end())
+         assertUnit((*result.first).second == int(30));
+      assertStandardFixture(m);
+      // teardown
+      teardownStandardFixture(m);
+   }
+
    /***************************************
     * SQUARE BRACKET
     *     map::operator[](const T &)
@@ -1877,6 +1978,25 @@ public:
    }
 
 
+   // the square bracket operator must not write to the console
+   void test_access_silent()
+   {  // setup
+      custom::map<std::string, int> m;
+      setupStandardFixture(m);
+      std::ostringstream sout;
+      std::streambuf* pSave = std::cout.rdbuf(sout.rdbuf());
+      // exercise
+      int read = m[std::string("50")];
+      m[std::string("60")] = 60;
+      // verify
+      std::cout.rdbuf(pSave);
+      assertUnit(sout.str().empty());
+      assertUnit(read == 50);
+      assertUnit(m.bst.numElements == 4);
+      // teardown
+      teardownStandardFixture(m);
+   }
+
    /***************************************
     * AT
     *     map::at(const T &)
@@ -0,0 +1,299 @@
+/***********************************************************************
+ * Header:
+ *    unordered map
+ * Summary:
+ *    A map kept in a hash table rather than a tree
+ *      __       ____       ____         __
+ *     /  |    .'    '.   .'    '.   _  / /
+ *     `| |   |  .--.  | |  .--.  | (_)/ /
+ *      | |   | |    | | | |    | |   / / _
+ *     _| |_  |  `--'  | |  `--'  |  / / (_)
+ *    |_____|  '.____.'   '.____.'  /_/
+ *
+ *    This will contain the class definition of:
+ *        unordered_map            : A map stored in an open-addressing table
+ *        unordered_map::iterator  : An iterator through unordered_map
+ * Author
+ *    <Noah, Josh, Steve>
+ ************************************************************************/
+
+#pragma once
+
+#include <cstddef>      // for size_t
+#include <functional>   // for std::hash and std::equal_to
+#include <initializer_list>
+#include <stdexcept>    // for std::out_of_range
+#include <utility>      // for std::move
+#include "hash.h"       // for hash_table
+#include "pair.h"       // for pair
+
+class TestHash; // forward declaration for unit tests
+
+namespace custom
+{
+
+    /*****************************************************************
+     * UNORDERED MAP
+     * The same interface as map, without the order. The pairs sit
+     * in the slots themselves, so a hit costs one hash and a short
+     * scan of neighboring memory instead of log n pointer chases.
+     * Any insert can move every pair, so it invalidates every
+     * iterator and every reference from [] or at.
+     *
+     * When Hash and Equal both declare is_transparent, find, count,
+     * at and erase take anything they accept.
+     *
+     * Table is the Robin Hood hash_table unless swiss.h picks another.
+     *****************************************************************/
+    template <class K, class V, class Hash = std::hash<K>, class Equal = std::equal_to<K>,
+              class Table = hash_table<K, custom::pair<K, V>, key_of_pair<K, custom::pair<K, V>>, Hash, Equal>>
+    class unordered_map
+    {
+        friend class ::TestHash; // give unit tests access to the privates
+    public:
+        using Pairs = custom::pair<K, V>;
+
+        //
+        // Construct
+        //
+        unordered_map() {}
+
+        explicit unordered_map(size_t numBuckets)
+        {
+            table.rehash(numBuckets);
+        }
+
+        unordered_map(const unordered_map& rhs) : table(rhs.table) {}
+
+        unordered_map(unordered_map&& rhs) noexcept : table(std::move(rhs.table)) {}
+
+        template <class Iterator>
+        unordered_map(Iterator first, Iterator last)
+        {
+            insert(first, last);
+        }
+
+        unordered_map(const std::initializer_list<Pairs>& il)
+        {
+            insert(il);
+        }
+
+        ~unordered_map() {}
+
+        //
+        // Assign
+        //
+        unordered_map& operator = (const unordered_map& rhs)
+        {
+            table = rhs.table;
+            return *this;
+        }
+
+        unordered_map& operator = (unordered_map&& rhs) noexcept
+        {
+            table = std::move(rhs.table);
+            return *this;
+        }
+
+        unordered_map& operator = (const std::initializer_list<Pairs>& il)
+        {
+            clear();
+            insert(il);
+            return *this;
+        }
+
+        void swap(unordered_map& rhs) noexcept
+        {
+            table.swap(rhs.table);
+        }
+
+        //
+        // Iterator
+        //
+        using iterator = typename Table::iterator;
+        iterator begin() const { return table.begin(); }
+        iterator end()   const { return table.end();   }
+
+        //
+        // Access
+        //
+        const V& operator [] (const K& k) const
+        {
+            return at(k);
+        }
+        V& operator [] (const K& k)
+        {
+            return table.at(table.emplaceKey(k, k).first).second;
+        }
+        const V& at(const K& k) const
+        {
+            return atKey(k);
+        }
+        V& at(const K& k)
+        {
+            return atKey(k);
+        }
+        template <class Q, class H = Hash, class E = Equal,
+                  class = typename H::is_transparent, class = typename E::is_transparent>
+        const V& at(const Q& q) const
+        {
+            return atKey(q);
+        }
+        template <class Q, class H = Hash, class E = Equal,
+                  class = typename H::is_transparent, class = typename E::is_transparent>
+        V& at(const Q& q)
+        {
+            return atKey(q);
+        }
+        iterator find(const K& k) const
+        {
+            return iterator(&table, table.findIndex(k));
+        }
+        template <class Q, class H = Hash, class E = Equal,
+                  class = typename H::is_transparent, class = typename E::is_transparent>
+        iterator find(const Q& q) const
+        {
+            return iterator(&table, table.findIndex(q));
+        }
+        size_t count(const K& k) const
+        {
+            return find(k) == end() ? 0 : 1;
+        }
+        template <class Q, class H = Hash, class E = Equal,
+                  class = typename H::is_transparent, class = typename E::is_transparent>
+        size_t count(const Q& q) const
+        {
+            return find(q) == end() ? 0 : 1;
+        }
+
+        //
+        // Insert
+        //
+        custom::pair<iterator, bool> insert(const Pairs& rhs)
+        {
+            return emplaceAt(rhs.first, rhs);
+        }
+
+        custom::pair<iterator, bool> insert(Pairs&& rhs)
+        {
+            return emplaceAt(rhs.first, std::move(rhs));
+        }
+
+        template <class ... Args>
+        custom::pair<iterator, bool> try_emplace(const K& k, Args&& ... args)
+        {
+            return emplaceAt(k, k, in_place, std::forward<Args>(args)...);
+        }
+
+        template <class Iterator>
+        void insert(Iterator first, Iterator last)
+        {
+            for (Iterator it = first; it != last; ++it)
+                insert(*it);
+        }
+
+        void insert(const std::initializer_list<Pairs>& il)
+        {
+            reserve(size() + il.size());
+            insert(il.begin(), il.end());
+        }
+
+        //
+        // Remove
+        //
+        void clear() noexcept
+        {
+            table.clear();
+        }
+        iterator erase(const iterator& it)
+        {
+            return iterator(&table, table.eraseIndex(it.getIndex()));
+        }
+        size_t erase(const K& k)
+        {
+            return eraseKey(k);
+        }
+        template <class Q, class H = Hash, class E = Equal,
+                  class = typename H::is_transparent, class = typename E::is_transparent>
+        size_t erase(const Q& q)
+        {
+            return eraseKey(q);
+        }
+
+        //
+        // Status
+        //
+        bool   empty()           const noexcept { return table.empty();           }
+        size_t size()            const noexcept { return table.size();            }
+        size_t bucket_count()    const noexcept { return table.bucket_count();    }
+        float  load_factor()     const noexcept { return table.load_factor();     }
+        float  max_load_factor() const noexcept { return table.max_load_factor(); }
+        void   max_load_factor(float load)      { table.max_load_factor(load);    }
+        void   reserve(size_t num)              { table.reserve(num);             }
+        void   rehash(size_t num)               { table.rehash(num);              }
+
+    private:
+
+        template <class ... Args>
+        custom::pair<iterator, bool> emplaceAt(const K& k, Args&& ... args);
+        template <class Q>
+        V& atKey(const Q& q) const;
+        template <class Q>
+        size_t eraseKey(const Q& q);
+
+        Table table;
+    };
+
+    /*****************************************************
+     * UNORDERED MAP :: EMPLACE AT
+     * Build a pair from args unless k is already there
+     ****************************************************/
+    template <class K, class V, class Hash, class Equal, class Table>
+    template <class ... Args>
+    custom::pair<typename unordered_map <K, V, Hash, Equal, Table> ::iterator, bool>
+        unordered_map <K, V, Hash, Equal, Table> ::emplaceAt(const K& k, Args&& ... args)
+    {
+        std::pair<size_t, bool> result = table.emplaceKey(k, std::forward<Args>(args)...);
+        return custom::pair<iterator, bool>(iterator(&table, result.first), result.second);
+    }
+
+    /*****************************************************
+     * UNORDERED MAP :: AT KEY
+     * Retrieve an element from the map
+     ****************************************************/
+    template <class K, class V, class Hash, class Equal, class Table>
+    template <class Q>
+    V& unordered_map <K, V, Hash, Equal, Table> ::atKey(const Q& q) const
+    {
+        size_t index = table.findIndex(q);
+        if (index == table.end().getIndex())
+            throw std::out_of_range("invalid unordered_map<K, T> key");
+        return table.at(index).second;
+    }
+
+    /*****************************************************
+     * UNORDERED MAP :: ERASE KEY
+     * Erase one element
+     ****************************************************/
+    template <class K, class V, class Hash, class Equal, class Table>
+    template <class Q>
+    size_t unordered_map <K, V, Hash, Equal, Table> ::eraseKey(const Q& q)
+    {
+        size_t index = table.findIndex(q);
+        if (index == table.end().getIndex())
+            return 0;
+        table.eraseIndex(index);
+        return 1;
+    }
+
+    /*****************************************************
+     * SWAP
+     * Swap two unordered maps
+     ****************************************************/
+    template <class K, class V, class Hash, class Equal, class Table>
+    void swap(unordered_map <K, V, Hash, Equal, Table>& lhs, unordered_map <K, V, Hash, Equal, Table>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+}; // namespace custom
@@ -0,0 +1,218 @@
+/***********************************************************************
+ * Header:
+ *    unordered set
+ * Summary:
+ *    A set kept in a hash table rather than a tree
+ *      __       ____       ____         __
+ *     /  |    .'    '.   .'    '.   _  / /
+ *     `| |   |  .--.  | |  .--.  | (_)/ /
+ *      | |   | |    | | | |    | |   / / _
+ *     _| |_  |  `--'  | |  `--'  |  / / (_)
+ *    |_____|  '.____.'   '.____.'  /_/
+ *
+ *    This will contain the class definition of:
+ *        unordered_set            : A set stored in an open-addressing table
+ *        unordered_set::iterator  : An iterator through unordered_set
+ * Author
+ *    <Noah, Josh, Steve>
+ ************************************************************************/
+
+#pragma once
+
+#include <cstddef>      // for size_t
+#include <functional>   // for std::hash and std::equal_to
+#include <initializer_list>
+#include <utility>      // for std::pair and std::move
+#include "hash.h"       // for hash_table
+
+class TestHash; // forward declaration for unit tests
+
+namespace custom
+{
+
+    /*****************************************************************
+     * UNORDERED SET
+     * The same interface as set, without the order. A lookup hashes
+     * once and reads a short run of neighboring slots, rather than
+     * following log n pointers down a tree. Any insert can move every
+     * element, so it invalidates every iterator.
+     *
+     * When Hash and Equal both declare is_transparent, find, count
+     * and erase take anything they accept: a set of std::string with
+     * string_hash and std::equal_to<> can be searched with a char*.
+     *
+     * Table is the Robin Hood hash_table unless swiss.h picks another.
+     *****************************************************************/
+    template <class T, class Hash = std::hash<T>, class Equal = std::equal_to<T>,
+              class Table = hash_table<T, T, key_of_self<T>, Hash, Equal>>
+    class unordered_set
+    {
+        friend class ::TestHash; // give unit tests access to the privates
+    public:
+
+        //
+        // Construct
+        //
+        unordered_set() {}
+        explicit unordered_set(size_t numBuckets)
+        {
+            table.rehash(numBuckets);
+        }
+        unordered_set(const unordered_set& rhs) : table(rhs.table) {}
+        unordered_set(unordered_set&& rhs) noexcept : table(std::move(rhs.table)) {}
+        unordered_set(const std::initializer_list<T>& il)
+        {
+            insert(il.begin(), il.end());
+        }
+        template <class Iterator>
+        unordered_set(Iterator first, Iterator last)
+        {
+            insert(first, last);
+        }
+        ~unordered_set() {}
+
+        //
+        // Assign
+        //
+        unordered_set& operator = (const unordered_set& rhs)
+        {
+            table = rhs.table;
+            return *this;
+        }
+        unordered_set& operator = (unordered_set&& rhs) noexcept
+        {
+            table = std::move(rhs.table);
+            return *this;
+        }
+        unordered_set& operator = (const std::initializer_list<T>& il)
+        {
+            clear();
+            insert(il.begin(), il.end());
+            return *this;
+        }
+        void swap(unordered_set& rhs) noexcept
+        {
+            table.swap(rhs.table);
+        }
+
+        //
+        // Iterator
+        //
+        using iterator = typename Table::iterator;
+        iterator begin() const { return table.begin(); }
+        iterator end()   const { return table.end();   }
+
+        //
+        // Access
+        //
+        iterator find(const T& t) const
+        {
+            return iterator(&table, table.findIndex(t));
+        }
+        template <class Q, class H = Hash, class E = Equal,
+                  class = typename H::is_transparent, class = typename E::is_transparent>
+        iterator find(const Q& q) const
+        {
+            return iterator(&table, table.findIndex(q));
+        }
+        size_t count(const T& t) const
+        {
+            return find(t) == end() ? 0 : 1;
+        }
+        template <class Q, class H = Hash, class E = Equal,
+                  class = typename H::is_transparent, class = typename E::is_transparent>
+        size_t count(const Q& q) const
+        {
+            return find(q) == end() ? 0 : 1;
+        }
+
+        //
+        // Insert
+        //
+        std::pair<iterator, bool> insert(const T& t)
+        {
+            return emplaceAt(t, t);
+        }
+        std::pair<iterator, bool> insert(T&& t)
+        {
+            return emplaceAt(t, std::move(t));
+        }
+        void insert(const std::initializer_list<T>& il)
+        {
+            reserve(size() + il.size());
+            insert(il.begin(), il.end());
+        }
+        template <class Iterator>
+        void insert(Iterator first, Iterator last)
+        {
+            for (Iterator it = first; it != last; ++it)
+                insert(*it);
+        }
+
+        //
+        // Remove
+        //
+        void clear() noexcept
+        {
+            table.clear();
+        }
+        iterator erase(const iterator& it)
+        {
+            return iterator(&table, table.eraseIndex(it.getIndex()));
+        }
+        size_t erase(const T& t)
+        {
+            return eraseKey(t);
+        }
+        template <class Q, class H = Hash, class E = Equal,
+                  class = typename H::is_transparent, class = typename E::is_transparent>
+        size_t erase(const Q& q)
+        {
+            return eraseKey(q);
+        }
+
+        //
+        // Status
+        //
+        bool   empty()           const noexcept { return table.empty();           }
+        size_t size()            const noexcept { return table.size();            }
+        size_t bucket_count()    const noexcept { return table.bucket_count();    }
+        float  load_factor()     const noexcept { return table.load_factor();     }
+        float  max_load_factor() const noexcept { return table.max_load_factor(); }
+        void   max_load_factor(float load)      { table.max_load_factor(load);    }
+        void   reserve(size_t num)              { table.reserve(num);             }
+        void   rehash(size_t num)               { table.rehash(num);              }
+
+    private:
+
+        template <class U>
+        std::pair<iterator, bool> emplaceAt(const T& t, U&& u)
+        {
+            std::pair<size_t, bool> result = table.emplaceKey(t, std::forward<U>(u));
+            return std::pair<iterator, bool>(iterator(&table, result.first), result.second);
+        }
+
+        template <class Q>
+        size_t eraseKey(const Q& q)
+        {
+            size_t index = table.findIndex(q);
+            if (index == table.end().getIndex())
+                return 0;
+            table.eraseIndex(index);
+            return 1;
+        }
+
+        Table table;
+    };
+
+    /*****************************************************
+     * SWAP
+     * Swap two unordered sets
+     ****************************************************/
+    template <class T, class Hash, class Equal, class Table>
+    void swap(unordered_set <T, Hash, Equal, Table>& lhs, unordered_set <T, Hash, Equal, Table>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+}; // namespace custom
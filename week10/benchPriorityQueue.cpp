@@ -0,0 +1,155 @@
+/***********************************************************************
+ * Source:
+ *    Bench Priority Queue
+ * Summary:
+ *    Time priority_queue against std::priority_queue. Each queue
+ *    is built from NUM_ELEMENTS values all at once (heapify), then
+ *    filled one push at a time and drained one pop at a time. Ours
+ *    is timed at several arities, holding ints and holding a whole
+ *    cache line per element. The report is nanoseconds per element.
+ *    Build the BenchPriorityQueue project in Release, or:
+ *       g++ -O2 -std=c++14 benchPriorityQueue.cpp
+ * Author
+ *    Noah Li, Steven Sellers, Josh Hamilton.
+ ************************************************************************/
+
+#include "priority_queue.h"   // for priority_queue
+
+#include <chrono>             // for steady_clock
+#include <cstddef>            // for size_t
+#include <iomanip>            // for setw and setprecision
+#include <iostream>           // for cout
+#include <queue>              // for std::priority_queue, the yardstick
+#include <vector>             // for the values to heapify
+
+const size_t NUM_ELEMENTS = 1000000;   // elements in every queue
+const int    NUM_PASSES   = 5;         // times each queue is filled and drained
+
+/**********************************************************************
+ * VALUE AT
+ * The i'th value. A fixed scramble of 0 .. NUM_ELEMENTS-1, so a
+ * push lands anywhere in the heap
+ ***********************************************************************/
+int valueAt(size_t i)
+{
+   return int((i * 7919) % NUM_ELEMENTS);
+}
+
+/**********************************************************************
+ * WIDE
+ * An int padded out to a cache line, so every element a percolate
+ * moves costs as much as the line it sits in
+ ***********************************************************************/
+struct Wide
+{
+   Wide(int key = 0) : key(key) {}
+   bool operator < (const Wide & rhs) const { return key < rhs.key; }
+   int key;
+   char padding[60];
+};
+
+// the priority of an element, for the sums
+int keyOf(int value)         { return value;    }
+int keyOf(const Wide & wide) { return wide.key; }
+
+/**********************************************************************
+ * REPORT
+ * One line: what was timed and what it cost per element
+ ***********************************************************************/
+void report(const char * name, const char * what,
+            std::chrono::steady_clock::duration elapsed, long long sum)
+{
+   double ns = std::chrono::duration<double, std::nano>(elapsed).count();
+   std::cout << std::left  << std::setw(28) << name
+             << std::setw(10) << what
+             << std::right << std::setw(8)  << std::fixed << std::setprecision(2)
+             << ns / (double(NUM_ELEMENTS) * NUM_PASSES) << " ns/element"
+             << "   (sum " << sum << ")\n";
+}
+
+/**********************************************************************
+ * TIME HEAPIFY
+ * Build a queue from every value at once. The sum of the tops is
+ * printed so the builds cannot be optimized away
+ ***********************************************************************/
+template <class Queue>
+void timeHeapify(const char * name, const std::vector<int> & values)
+{
+   long long sum = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (int pass = 0; pass < NUM_PASSES; pass++)
+   {
+      Queue q(values.begin(), values.end());
+      sum += keyOf(q.top());
+   }
+   report(name, "heapify", std::chrono::steady_clock::now() - start, sum);
+}
+
+/**********************************************************************
+ * TIME PUSH POP
+ * Push every value, then pop until empty. The two are timed apart:
+ * a push climbs from the bottom, a pop sinks from the top
+ ***********************************************************************/
+template <class Queue>
+void timePushPop(const char * name)
+{
+   long long sum = 0;
+   std::chrono::steady_clock::duration push{};
+   std::chrono::steady_clock::duration pop{};
+   for (int pass = 0; pass < NUM_PASSES; pass++)
+   {
+      Queue q;
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < NUM_ELEMENTS; i++)
+         q.push(valueAt(i));
+      auto middle = std::chrono::steady_clock::now();
+      while (!q.empty())
+      {
+         sum += keyOf(q.top());
+         q.pop();
+      }
+      auto finish = std::chrono::steady_clock::now();
+      push += middle - start;
+      pop  += finish - middle;
+   }
+   report(name, "push", push, sum);
+   report(name, "pop",  pop,  sum);
+}
+
+/**********************************************************************
+ * MAIN
+ * Time each queue on the same values
+ ***********************************************************************/
+int main()
+{
+   std::cout << NUM_ELEMENTS << " elements, " << NUM_PASSES << " passes\n";
+
+   std::vector<int> values;
+   values.reserve(NUM_ELEMENTS);
+   for (size_t i = 0; i < NUM_ELEMENTS; i++)
+      values.push_back(valueAt(i));
+
+   // an int per element: a node's children share a cache line
+   timeHeapify<std::priority_queue<int>>("std::priority_queue<int>", values);
+   timeHeapify<custom::priority_queue<int, 2>>("priority_queue<int, 2>", values);
+   timeHeapify<custom::priority_queue<int, 4>>("priority_queue<int, 4>", values);
+   timeHeapify<custom::priority_queue<int, 8>>("priority_queue<int, 8>", values);
+
+   timePushPop<std::priority_queue<int>>("std::priority_queue<int>");
+   timePushPop<custom::priority_queue<int, 2>>("priority_queue<int, 2>");
+   timePushPop<custom::priority_queue<int, 4>>("priority_queue<int, 4>");
+   timePushPop<custom::priority_queue<int, 8>>("priority_queue<int, 8>");
+
+   // a cache line per element: every child is a line of its own
+   timeHeapify<std::priority_queue<Wide>>("std::priority_queue<Wide>", values);
+   timeHeapify<custom::priority_queue<Wide, 2>>("priority_queue<Wide, 2>", values);
+   timeHeapify<custom::priority_queue<Wide, 4>>("priority_queue<Wide, 4>", values);
+   timeHeapify<custom::priority_queue<Wide, 8>>("priority_queue<Wide, 8>", values);
+
+   timePushPop<std::priority_queue<Wide>>("std::priority_queue<Wide>");
+   timePushPop<custom::priority_queue<Wide, 2>>("priority_queue<Wide, 2>");
+   timePushPop<custom::priority_queue<Wide, 4>>("priority_queue<Wide, 4>");
+   timePushPop<custom::priority_queue<Wide, 8>>("priority_queue<Wide, 8>");
+
+   return 0;
+}
@@ -0,0 +1,405 @@
+/***********************************************************************
+ * Header:
+ *    INDEXED PRIORITY QUEUE
+ * Summary:
+ *    A priority queue whose items can be found again by handle
+ *      __       ____       ____         __
+ *     /  |    .'    '.   .'    '.   _  / /
+ *     `| |   |  .--.  | |  .--.  | (_)/ /
+ *      | |   | |    | | | |    | |   / / _
+ *     _| |_  |  `--'  | |  `--'  |  / / (_)
+ *    |_____|  '.____.'   '.____.'  /_/
+ *
+ *    This will contain the class definition of:
+ *        indexed_priority_queue  : A priority queue with update and erase
+ * Author
+ *    Noah Li, Josh Hamilton & Steven Sellers
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>     // for size_t
+#include <cstdint>     // for std::uint64_t
+#include <stdexcept>   // for std::out_of_range
+#include <utility>     // for std::move
+#include "vector.h"
+
+class TestIndexedPQueue;    // forward declaration for unit test class
+
+namespace custom
+{
+
+/*************************************************
+ * INDEXED P QUEUE
+ * A heap like priority_queue, but push hands back a handle
+ * that names the item until it is popped or erased. The items
+ * sit packed together in keys, and the heap holds their
+ * indices rather than the items. A position map from key index
+ * to heap index is kept in step with every move, so an item
+ * can be changed or removed in O(log n).
+ * A handle is a slot plus the generation of that slot. Slots
+ * are reused by later pushes, but each reuse bumps the
+ * generation, so a handle whose item is gone stays dead.
+ *************************************************/
+template<class T, size_t Arity = 2>
+class indexed_priority_queue
+{
+   static_assert(Arity >= 2, "a heap node needs at least two children");
+
+   friend class ::TestIndexedPQueue; // give the unit test class access to the privates
+public:
+   using handle = std::uint64_t;
+
+   //
+   // Access
+   //
+   const T & top() const;
+   handle topHandle() const;
+   const T & operator [] (handle h) const;
+
+   //
+   // Insert
+   //
+   handle push(const T& t) { return pushKey(t);            }
+   handle push(T&& t)      { return pushKey(std::move(t)); }
+   void   update(handle h, const T& t);
+   void   update(handle h, T&& t);
+
+   //
+   // Remove
+   //
+   void  pop();
+   void  erase(handle h);
+
+   //
+   // Status
+   //
+   size_t size()  const { return heap.size();  }
+   bool   empty() const { return heap.empty(); }
+   bool   contains(handle h) const
+   {
+      size_t slot = slotIndex(h);
+      return slot < slots.size() && slots[slot].key != noKey &&
+             slots[slot].generation == generationOf(h);
+   }
+
+private:
+
+   // what a handle names: the key of a live item, and how often it was reused
+   struct Slot
+   {
+      size_t        key;          // index into keys, or noKey when free
+      std::uint32_t generation;   // bumped each time the slot is freed
+   };
+   static constexpr size_t noKey = size_t(-1);
+
+   // a handle is the generation in the high half and the slot in the low half
+   static handle makeHandle(size_t slot, std::uint32_t generation)
+   {
+      return (handle(generation) << 32) | handle(slot);
+   }
+   static size_t        slotIndex(handle h)    { return size_t(h & 0xFFFFFFFFu); }
+   static std::uint32_t generationOf(handle h) { return std::uint32_t(h >> 32);  }
+
+   template <class U>
+   handle pushKey(U&& t);                     // add an item at the bottom of the heap
+   size_t newSlot(size_t key);                // a free slot naming key, growing if needed
+   size_t keyOf(handle h) const;              // the key index of a queued handle, else throw
+   void   fix(size_t indexHeap);              // restore heap order after a key changed
+   void   removeAt(size_t indexHeap);         // take an item out of the heap
+   bool   percolateDown(size_t indexHeap);    // fix heap from index down. This is a heap index!
+   bool   percolateUp(size_t indexHeap);      // fix heap from index up. Also a heap index
+
+   // heap index math: the same layout as priority_queue
+   static size_t firstChild(size_t indexHeap) { return Arity * (indexHeap - 1) + 2; }
+   static size_t parent(size_t indexHeap)     { return (indexHeap - 2) / Arity + 1; }
+   size_t largestChild(size_t indexHeap) const;
+
+   // is the item at heap index lhs smaller than the one at rhs?
+   bool less(size_t indexLHS, size_t indexRHS) const
+   {
+      return keys[heap[indexLHS - 1]] < keys[heap[indexRHS - 1]];
+   }
+
+   custom::vector<T>      keys;          // the queued items, packed in no order
+   custom::vector<size_t> position;      // heap index of each key
+   custom::vector<size_t> slotOfKey;     // the slot naming each key
+   custom::vector<size_t> heap;          // key indices in heap order
+   custom::vector<Slot>   slots;         // the key and generation behind each handle
+   custom::vector<size_t> handlesFree;   // slots ready for reuse
+};
+
+/************************************************
+ * INDEXED P QUEUE :: TOP
+ * Get the maximum item from the heap: the top item.
+ ***********************************************/
+template <class T, size_t Arity>
+const T & indexed_priority_queue <T, Arity> :: top() const
+{
+   if (heap.empty())
+      throw std::out_of_range("std:out_of_range");
+   return keys[heap.front()];
+}
+
+template <class T, size_t Arity>
+typename indexed_priority_queue <T, Arity> ::handle indexed_priority_queue <T, Arity> :: topHandle() const
+{
+   if (heap.empty())
+      throw std::out_of_range("std:out_of_range");
+   size_t slot = slotOfKey[heap.front()];
+   return makeHandle(slot, slots[slot].generation);
+}
+
+/************************************************
+ * INDEXED P QUEUE :: SUBSCRIPT
+ * Look at the item of a queued handle
+ ***********************************************/
+template <class T, size_t Arity>
+const T & indexed_priority_queue <T, Arity> :: operator [] (handle h) const
+{
+   return keys[keyOf(h)];
+}
+
+/*****************************************
+ * INDEXED P QUEUE :: PUSH KEY
+ * Build the new item in place, name it with a slot,
+ * and let it climb from the bottom of the heap
+ ****************************************/
+template <class T, size_t Arity>
+template <class U>
+typename indexed_priority_queue <T, Arity> ::handle indexed_priority_queue <T, Arity> :: pushKey(U && t)
+{
+   position.push_back(0);
+   slotOfKey.push_back(0);
+   try
+   {
+      keys.push_back(std::forward<U>(t));
+   }
+   catch (...)
+   {
+      position.pop_back();
+      slotOfKey.pop_back();
+      throw;
+   }
+
+   size_t key = keys.size() - 1;
+   size_t slot = newSlot(key);
+   slotOfKey[key] = slot;
+
+   heap.push_back(key);
+   position[key] = heap.size();
+   percolateUp(heap.size());
+   return makeHandle(slot, slots[slot].generation);
+}
+
+/*****************************************
+ * INDEXED P QUEUE :: UPDATE
+ * Give a queued item a new value. It moves
+ * up or down depending on which way it changed
+ ****************************************/
+template <class T, size_t Arity>
+void indexed_priority_queue <T, Arity> :: update(handle h, const T & t)
+{
+   size_t key = keyOf(h);
+   keys[key] = t;
+   fix(position[key]);
+}
+template <class T, size_t Arity>
+void indexed_priority_queue <T, Arity> :: update(handle h, T && t)
+{
+   size_t key = keyOf(h);
+   keys[key] = std::move(t);
+   fix(position[key]);
+}
+
+/**********************************************
+ * INDEXED P QUEUE :: POP
+ * Delete the top item from the heap.
+ **********************************************/
+template <class T, size_t Arity>
+void indexed_priority_queue <T, Arity> :: pop()
+{
+   if (!heap.empty())
+      removeAt(1);
+}
+
+/**********************************************
+ * INDEXED P QUEUE :: ERASE
+ * Delete an item wherever it is in the heap.
+ * A handle that is not queued is ignored.
+ **********************************************/
+template <class T, size_t Arity>
+void indexed_priority_queue <T, Arity> :: erase(handle h)
+{
+   if (contains(h))
+      removeAt(position[slots[slotIndex(h)].key]);
+}
+
+/**********************************************
+ * INDEXED P QUEUE :: KEY OF
+ * The key index a handle names, if it is still queued
+ **********************************************/
+template <class T, size_t Arity>
+size_t indexed_priority_queue <T, Arity> :: keyOf(handle h) const
+{
+   if (!contains(h))
+      throw std::out_of_range("std:out_of_range");
+   return slots[slotIndex(h)].key;
+}
+
+/**********************************************
+ * INDEXED P QUEUE :: NEW SLOT
+ * Reuse a slot that was given back, else make a new one
+ **********************************************/
+template <class T, size_t Arity>
+size_t indexed_priority_queue <T, Arity> :: newSlot(size_t key)
+{
+   if (!handlesFree.empty())
+   {
+      size_t slot = handlesFree.back();
+      handlesFree.pop_back();
+      slots[slot].key = key;
+      return slot;
+   }
+
+   slots.push_back(Slot{ key, 0 });
+   return slots.size() - 1;
+}
+
+/**********************************************
+ * INDEXED P QUEUE :: FIX
+ * The item at the passed index changed value. It only
+ * needs to move one way, so try down and then up
+ **********************************************/
+template <class T, size_t Arity>
+void indexed_priority_queue <T, Arity> :: fix(size_t indexHeap)
+{
+   if (!percolateDown(indexHeap))
+      percolateUp(indexHeap);
+}
+
+/**********************************************
+ * INDEXED P QUEUE :: REMOVE AT
+ * The last heap entry fills the hole in the heap, and the
+ * last key fills the hole in keys. The slot is freed with a
+ * new generation so old handles to it stop working.
+ **********************************************/
+template <class T, size_t Arity>
+void indexed_priority_queue <T, Arity> :: removeAt(size_t indexHeap)
+{
+   assert(indexHeap >= 1 && indexHeap <= heap.size());
+   size_t key = heap[indexHeap - 1];
+   size_t keyLast = heap.back();
+   heap.pop_back();
+   if (key != keyLast)
+   {
+      heap[indexHeap - 1] = keyLast;
+      position[keyLast] = indexHeap;
+   }
+
+   // free the slot
+   size_t slot = slotOfKey[key];
+   slots[slot].key = noKey;
+   slots[slot].generation++;
+   handlesFree.push_back(slot);
+
+   // the last key moves into the hole
+   size_t keyMoved = keys.size() - 1;
+   if (key != keyMoved)
+   {
+      keys[key] = std::move(keys[keyMoved]);
+      position[key] = position[keyMoved];
+      slotOfKey[key] = slotOfKey[keyMoved];
+      heap[position[key] - 1] = key;
+      slots[slotOfKey[key]].key = key;
+   }
+   keys.pop_back();
+   position.pop_back();
+   slotOfKey.pop_back();
+
+   if (key != keyLast)
+      fix(indexHeap);
+}
+
+/************************************************
+ * INDEXED P QUEUE :: LARGEST CHILD
+ * Find the largest child of a node that has at least one.
+ ************************************************/
+template <class T, size_t Arity>
+size_t indexed_priority_queue <T, Arity> :: largestChild(size_t indexHeap) const
+{
+   size_t indexFirst = firstChild(indexHeap);
+   size_t indexLast = indexFirst + Arity - 1;
+   if (indexLast > heap.size())
+      indexLast = heap.size();
+
+   size_t indexLargest = indexFirst;
+   for (size_t indexChild = indexFirst + 1; indexChild <= indexLast; indexChild++)
+      if (less(indexLargest, indexChild))
+         indexLargest = indexChild;
+   return indexLargest;
+}
+
+/************************************************
+ * INDEXED P QUEUE :: PERCOLATE DOWN
+ * Same hole walk as priority_queue, but only key indices
+ * move, and each one that moves has its position updated.
+ * Return TRUE if anything changed.
+ ************************************************/
+template <class T, size_t Arity>
+bool indexed_priority_queue <T, Arity> :: percolateDown(size_t indexHeap)
+{
+   size_t num = heap.size();
+   if (indexHeap == 0 || firstChild(indexHeap) > num)
+      return false;
+
+   size_t indexChild = largestChild(indexHeap);
+   if (!less(indexHeap, indexChild))
+      return false;
+
+   size_t key = heap[indexHeap - 1];
+   size_t indexHole = indexHeap;
+   do
+   {
+      heap[indexHole - 1] = heap[indexChild - 1];
+      position[heap[indexHole - 1]] = indexHole;
+      indexHole = indexChild;
+      if (firstChild(indexHole) > num)
+         break;
+      indexChild = largestChild(indexHole);
+   }
+   while (keys[key] < keys[heap[indexChild - 1]]);
+
+   heap[indexHole - 1] = key;
+   position[key] = indexHole;
+   return true;
+}
+
+/************************************************
+ * INDEXED P QUEUE :: PERCOLATE UP
+ * Smaller parents move down into the hole until
+ * the key finds its place. Return TRUE if it moved.
+ ************************************************/
+template <class T, size_t Arity>
+bool indexed_priority_queue <T, Arity> :: percolateUp(size_t indexHeap)
+{
+   if (indexHeap <= 1 || !less(parent(indexHeap), indexHeap))
+      return false;
+
+   size_t key = heap[indexHeap - 1];
+   size_t indexHole = indexHeap;
+   do
+   {
+      heap[indexHole - 1] = heap[parent(indexHole) - 1];
+      position[heap[indexHole - 1]] = indexHole;
+      indexHole = parent(indexHole);
+   }
+   while (indexHole > 1 && keys[heap[parent(indexHole) - 1]] < keys[key]);
+
+   heap[indexHole - 1] = key;
+   position[key] = indexHole;
+   return true;
+}
+
+};
@@ -13,12 +13,15 @@
  *    This will contain the class definition of:
  *        priority_queue          : A class that represents a Priority Queue
  * Author
- *    <your names here>
+ *    Noah Li, Josh Hamilton & Steven Sellers
  ************************************************************************/
 
 #pragma once
 
 #include <cassert>
+#include <cstddef>     // for size_t
+#include <stdexcept>   // for std::out_of_range
+#include <utility>     // for std::move and std::forward
 #include "vector.h"
 
 class TestPQueue;    // forward declaration for unit test class
@@ -28,14 +31,18 @@ namespace custom
 
 /*************************************************
  * P QUEUE
- * Create a priority queue.
+ * Create a priority queue. Each node has Arity children,
+ * so a wider heap is shallower and the children of a node
+ * sit next to each other in the container.
  *************************************************/
-template<class T>
+template<class T, size_t Arity = 2>
 class priority_queue
 {
+   static_assert(Arity >= 2, "a heap node needs at least two children");
+
    friend class ::TestPQueue; // give the unit test class access to the privates
-   template <class TT>
-   friend void swap(priority_queue<TT>& lhs, priority_queue<TT>& rhs);
+   template <class TT, size_t AA>
+   friend void swap(priority_queue<TT, AA>& lhs, priority_queue<TT, AA>& rhs);
 public:
 
    //
@@ -44,21 +51,30 @@ public:
    priority_queue() 
    {
    }
-   priority_queue(const priority_queue &  rhs)  
+   priority_queue(const priority_queue &  rhs) : container(rhs.container)
    { 
    }
-   priority_queue(priority_queue && rhs)  
+   priority_queue(priority_queue && rhs) : container(std::move(rhs.container))
    { 
    }
    template <class Iterator>
    priority_queue(Iterator first, Iterator last) 
    {
+      size_t num = 0;
+      for (Iterator it = first; it != last; ++it)
+         num++;
+      container.reserve(num);
+      for (Iterator it = first; it != last; ++it)
+         container.push_back(*it);
+      heapify();
    }
-   explicit priority_queue (custom::vector<T> && rhs) 
+   explicit priority_queue (custom::vector<T> && rhs) : container(std::move(rhs))
    {
+      heapify();
    }
-   explicit priority_queue (custom::vector<T>& rhs)
+   explicit priority_queue (custom::vector<T>& rhs) : container(rhs)
    {
+      heapify();
    }
   ~priority_queue() {}
 
@@ -72,6 +88,8 @@ public:
    //
    void  push(const T& t);
    void  push(T&& t);     
+   template <class ... Args>
+   void  emplace(Args&& ... args);
 
    //
    // Remove
@@ -83,17 +101,23 @@ public:
    //
    size_t size()  const 
    { 
-      return 99;   
+      return container.size();
    }
    bool empty() const 
    { 
-      return false;  
+      return container.empty();
    }
    
 private:
 
    void heapify();                            // convert the container in to a heap
    bool percolateDown(size_t indexHeap);      // fix heap from index down. This is a heap index!
+   void percolateUp(size_t indexHeap);        // fix heap from index up. Also a heap index
+
+   // heap index math: the root is 1, the children of i are firstChild(i) .. firstChild(i) + Arity - 1
+   static size_t firstChild(size_t indexHeap) { return Arity * (indexHeap - 1) + 2; }
+   static size_t parent(size_t indexHeap)     { return (indexHeap - 2) / Arity + 1; }
+   size_t largestChild(size_t indexHeap) const;
 
    custom::vector<T> container; 
 
@@ -103,64 +127,166 @@ private:
  * P QUEUE :: TOP
  * Get the maximum item from the heap: the top item.
  ***********************************************/
-template <class T>
-const T & priority_queue <T> :: top() const
+template <class T, size_t Arity>
+const T & priority_queue <T, Arity> :: top() const
 {
-   return *(new T);
+   if (container.empty())
+      throw std::out_of_range("std:out_of_range");
+   return container.front();
 }
 
 /**********************************************
  * P QUEUE :: POP
  * Delete the top item from the heap.
  **********************************************/
-template <class T>
-void priority_queue <T> :: pop()
+template <class T, size_t Arity>
+void priority_queue <T, Arity> :: pop()
 {
+   if (container.empty())
+      return;
+
+   // the last item fills the hole at the top, then sinks
+   if (container.size() > 1)
+      container.front() = std::move(container.back());
+   container.pop_back();
+   percolateDown(1);
 }
 
 /*****************************************
  * P QUEUE :: PUSH
  * Add a new element to the heap, reallocating as necessary
  ****************************************/
-template <class T>
-void priority_queue <T> :: push(const T & t)
+template <class T, size_t Arity>
+void priority_queue <T, Arity> :: push(const T & t)
+{
+   container.push_back(t);
+   percolateUp(container.size());
+}
+template <class T, size_t Arity>
+void priority_queue <T, Arity> :: push(T && t)
 {
+   container.push_back(std::move(t));
+   percolateUp(container.size());
 }
-template <class T>
-void priority_queue <T> :: push(T && t)
+
+/*****************************************
+ * P QUEUE :: EMPLACE
+ * Build a new element at the bottom of the heap
+ * from the constructor arguments, then let it climb
+ ****************************************/
+template <class T, size_t Arity>
+template <class ... Args>
+void priority_queue <T, Arity> :: emplace(Args&& ... args)
 {
+   container.emplace_back(std::forward<Args>(args)...);
+   percolateUp(container.size());
+}
+
+/************************************************
+ * P QUEUE :: LARGEST CHILD
+ * Find the largest child of a node that has at least one.
+ * All the children of a node are next to each other.
+ ************************************************/
+template <class T, size_t Arity>
+size_t priority_queue <T, Arity> :: largestChild(size_t indexHeap) const
+{
+   size_t indexFirst = firstChild(indexHeap);
+   size_t indexLast = indexFirst + Arity - 1;
+   if (indexLast > container.size())
+      indexLast = container.size();
+
+   size_t indexLargest = indexFirst;
+   for (size_t indexChild = indexFirst + 1; indexChild <= indexLast; indexChild++)
+      if (container[indexLargest - 1] < container[indexChild - 1])
+         indexLargest = indexChild;
+   return indexLargest;
 }
 
 /************************************************
  * P QUEUE :: PERCOLATE DOWN
  * The item at the passed index may be out of heap
  * order. Take care of that little detail!
+ * Rather than swapping at every level, the item is
+ * lifted out, the larger children move up into the
+ * hole, and the item is dropped in once at the end.
  * Return TRUE if anything changed.
  ************************************************/
-template <class T>
-bool priority_queue <T> :: percolateDown(size_t indexHeap)
+template <class T, size_t Arity>
+bool priority_queue <T, Arity> :: percolateDown(size_t indexHeap)
 {
-   return false;
+   size_t num = container.size();
+   if (indexHeap == 0 || firstChild(indexHeap) > num)
+      return false;
+
+   // leave early if the item is in place
+   size_t indexChild = largestChild(indexHeap);
+   if (!(container[indexHeap - 1] < container[indexChild - 1]))
+      return false;
+
+   // walk the hole down until the item is no smaller than any child
+   T value(std::move(container[indexHeap - 1]));
+   size_t indexHole = indexHeap;
+   do
+   {
+      container[indexHole - 1] = std::move(container[indexChild - 1]);
+      indexHole = indexChild;
+      if (firstChild(indexHole) > num)
+         break;
+      indexChild = largestChild(indexHole);
+   }
+   while (value < container[indexChild - 1]);
+
+   container[indexHole - 1] = std::move(value);
+   return true;
+}
+
+/************************************************
+ * P QUEUE :: PERCOLATE UP
+ * The item at the passed index may be larger than
+ * its parent. Smaller parents move down into the
+ * hole until the item finds its place.
+ ************************************************/
+template <class T, size_t Arity>
+void priority_queue <T, Arity> :: percolateUp(size_t indexHeap)
+{
+   if (indexHeap <= 1 || !(container[parent(indexHeap) - 1] < container[indexHeap - 1]))
+      return;
+
+   T value(std::move(container[indexHeap - 1]));
+   size_t indexHole = indexHeap;
+   do
+   {
+      container[indexHole - 1] = std::move(container[parent(indexHole) - 1]);
+      indexHole = parent(indexHole);
+   }
+   while (indexHole > 1 && container[parent(indexHole) - 1] < value);
+
+   container[indexHole - 1] = std::move(value);
 }
 
 /************************************************
  * P QUEUE :: HEAPIFY
- * Turn the container into a heap.
+ * Turn the container into a heap. Sinking every
+ * parent from the last one up to the root is O(n)
  ************************************************/
-template <class T>
-void priority_queue <T> ::heapify()
+template <class T, size_t Arity>
+void priority_queue <T, Arity> ::heapify()
 {
+   if (container.size() <= 1)
+      return;
+   for (size_t indexHeap = parent(container.size()); indexHeap >= 1; indexHeap--)
+      percolateDown(indexHeap);
 }
 
 /************************************************
  * SWAP
  * Swap the contents of two priority queues
  ************************************************/
-template <class T>
-inline void swap(custom::priority_queue <T>& lhs,
-                 custom::priority_queue <T>& rhs)
+template <class T, size_t Arity>
+inline void swap(custom::priority_queue <T, Arity>& lhs,
+                 custom::priority_queue <T, Arity>& rhs)
 {
+   lhs.container.swap(rhs.container);
 }
 
 };
-
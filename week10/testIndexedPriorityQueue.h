@@ -0,0 +1,401 @@
+/***********************************************************************
+ * Header:
+ *    TEST INDEXED PRIORITY QUEUE
+ * Summary:
+ *    Unit tests for the indexed priority queue
+ * Author
+ *    Noah Li, Josh Hamilton & Steven Sellers
+ ************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG
+
+#include "indexed_priority_queue.h"
+#include "unitTest.h"
+
+#include <cassert>
+#include <string>
+
+
+class TestIndexedPQueue : public UnitTest
+{
+
+public:
+   void run()
+   {
+      reset();
+
+      // Insert
+      test_push_empty();
+      test_push_standard();
+      test_push_reuseSlot();
+      test_push_noDefault();
+      test_update_increase();
+      test_update_decrease();
+      test_update_missing();
+
+      // Remove
+      test_pop_empty();
+      test_pop_standard();
+      test_erase_leaf();
+      test_erase_middle();
+      test_erase_missing();
+      test_erase_staleHandle();
+
+      // Status
+      test_contains_standard();
+      test_contains_staleHandle();
+
+      // Mixed
+      test_mixed_fourAry();
+
+      report("IndexedPQueue");
+   }
+
+   /***************************************
+    * PUSH
+    ***************************************/
+
+   // push onto an empty queue
+   void test_push_empty()
+   {  // setup
+      custom::indexed_priority_queue <int> pq;
+      // exercise
+      custom::indexed_priority_queue <int>::handle h = pq.push(50);
+      // verify
+      assertUnit(h == 0);
+      assertUnit(pq.size() == 1);
+      assertUnit(pq.top() == 50);
+      assertUnit(pq.topHandle() == h);
+      assertConsistent(pq);
+   }  // teardown
+
+   // push the standard fixture: handles count up in push order
+   void test_push_standard()
+   {  // setup
+      custom::indexed_priority_queue <int> pq;
+      // exercise
+      setupStandardFixture(pq);
+      // verify
+      //                10(2)
+      //          8(1)         9(4)
+      //       4(0)  3(5)   7(3)  5(6)
+      assertUnit(pq.size() == 7);
+      assertUnit(pq.top() == 10);
+      assertUnit(pq.topHandle() == 2);
+      assertUnit(pq[0] == 4);
+      assertUnit(pq[6] == 5);
+      assertConsistent(pq);
+   }  // teardown
+
+   // a popped slot is reused, under a new handle
+   void test_push_reuseSlot()
+   {  // setup
+      custom::indexed_priority_queue <int> pq;
+      setupStandardFixture(pq);
+      pq.pop();
+      // exercise
+      custom::indexed_priority_queue <int>::handle h = pq.push(1);
+      // verify
+      assertUnit(h != 2);
+      assertUnit((h & 0xFFFFFFFFu) == 2);   // the slot of the popped 10
+      assertUnit(pq.handlesFree.empty());
+      assertUnit(pq.contains(h));
+      assertUnit(!pq.contains(2));
+      assertUnit(pq[h] == 1);
+      assertUnit(pq.size() == 7);
+      assertConsistent(pq);
+   }  // teardown
+
+   // items need not be default-constructible
+   void test_push_noDefault()
+   {  // setup
+      struct Cost
+      {
+         explicit Cost(int value) : value(value) {}
+         bool operator < (const Cost& rhs) const { return value < rhs.value; }
+         int value;
+      };
+      custom::indexed_priority_queue <Cost> pq;
+      // exercise
+      pq.push(Cost(3));
+      auto h = pq.push(Cost(9));
+      pq.push(Cost(5));
+      pq.pop();
+      pq.update(pq.topHandle(), Cost(1));
+      // verify
+      assertUnit(!pq.contains(h));
+      assertUnit(pq.size() == 2);
+      assertUnit(pq.top().value == 3);
+   }  // teardown
+
+   /***************************************
+    * UPDATE
+    ***************************************/
+
+   // raise a leaf to the top
+   void test_update_increase()
+   {  // setup
+      custom::indexed_priority_queue <int> pq;
+      setupStandardFixture(pq);
+      // exercise
+      pq.update(0 /*handle of 4*/, 20);
+      // verify
+      assertUnit(pq.top() == 20);
+      assertUnit(pq.topHandle() == 0);
+      assertUnit(pq.size() == 7);
+      assertConsistent(pq);
+   }  // teardown
+
+   // sink the top to a leaf
+   void test_update_decrease()
+   {  // setup
+      custom::indexed_priority_queue <int> pq;
+      setupStandardFixture(pq);
+      // exercise
+      pq.update(2 /*handle of 10*/, 1);
+      // verify
+      assertUnit(pq.top() == 9);
+      assertUnit(pq[2] == 1);
+      assertUnit(pq.position[pq.slots[2].key] > 3);
+      assertConsistent(pq);
+   }  // teardown
+
+   // a handle that is not queued cannot be updated
+   void test_update_missing()
+   {  // setup
+      custom::indexed_priority_queue <int> pq;
+      setupStandardFixture(pq);
+      pq.erase(3);
+      // exercise
+      try
+      {
+         pq.update(3, 99);
+         assertUnit(false);
+      }
+      catch (const std::out_of_range& error)
+      {
+         assertUnit(error.what() == std::string("std:out_of_range"));
+      }
+      // verify
+      assertUnit(pq.size() == 6);
+      assertUnit(pq.top() == 10);
+      assertConsistent(pq);
+   }  // teardown
+
+   /***************************************
+    * POP
+    ***************************************/
+
+   // pop of an empty queue does nothing
+   void test_pop_empty()
+   {  // setup
+      custom::indexed_priority_queue <int> pq;
+      // exercise
+      pq.pop();
+      // verify
+      assertUnit(pq.empty());
+   }  // teardown
+
+   // pop of the standard fixture
+   void test_pop_standard()
+   {  // setup
+      custom::indexed_priority_queue <int> pq;
+      setupStandardFixture(pq);
+      // exercise
+      pq.pop();
+      // verify
+      assertUnit(pq.size() == 6);
+      assertUnit(pq.top() == 9);
+      assertUnit(!pq.contains(2));
+      assertUnit(pq.handlesFree.size() == 1);
+      assertConsistent(pq);
+   }  // teardown
+
+   /***************************************
+    * ERASE
+    ***************************************/
+
+   // erase the last leaf
+   void test_erase_leaf()
+   {  // setup
+      custom::indexed_priority_queue <int> pq;
+      setupStandardFixture(pq);
+      // exercise
+      pq.erase(6 /*handle of 5*/);
+      // verify
+      assertUnit(pq.size() == 6);
+      assertUnit(!pq.contains(6));
+      assertUnit(pq.top() == 10);
+      assertConsistent(pq);
+   }  // teardown
+
+   // erase an inner node; the last leaf takes its place
+   void test_erase_middle()
+   {  // setup
+      custom::indexed_priority_queue <int> pq;
+      setupStandardFixture(pq);
+      // exercise
+      pq.erase(4 /*handle of 9*/);
+      // verify
+      assertUnit(pq.size() == 6);
+      assertUnit(!pq.contains(4));
+      assertUnit(pq.contains(6));
+      assertUnit(pq.top() == 10);
+      assertConsistent(pq);
+   }  // teardown
+
+   // erase of a handle that is not queued does nothing
+   void test_erase_missing()
+   {  // setup
+      custom::indexed_priority_queue <int> pq;
+      setupStandardFixture(pq);
+      // exercise
+      pq.erase(99);
+      pq.erase(1);
+      pq.erase(1);
+      // verify
+      assertUnit(pq.size() == 6);
+      assertUnit(pq.handlesFree.size() == 1);
+      assertConsistent(pq);
+   }  // teardown
+
+   // a handle whose item was popped does not erase the item in its slot
+   void test_erase_staleHandle()
+   {  // setup
+      custom::indexed_priority_queue <int> pq;
+      setupStandardFixture(pq);
+      pq.pop();                                          // handle 2 is gone
+      custom::indexed_priority_queue <int>::handle h = pq.push(6);   // reuses slot 2
+      // exercise
+      pq.erase(2);
+      try
+      {
+         pq.update(2, 99);
+         assertUnit(false);
+      }
+      catch (const std::out_of_range& error)
+      {
+         assertUnit(error.what() == std::string("std:out_of_range"));
+      }
+      // verify
+      assertUnit(pq.size() == 7);
+      assertUnit(pq.contains(h));
+      assertUnit(pq[h] == 6);
+      assertUnit(pq.top() == 9);
+      assertConsistent(pq);
+   }  // teardown
+
+   /***************************************
+    * CONTAINS
+    ***************************************/
+
+   // only queued handles are contained
+   void test_contains_standard()
+   {  // setup
+      custom::indexed_priority_queue <int> pq;
+      setupStandardFixture(pq);
+      // exercise
+      pq.pop();
+      // verify
+      assertUnit(pq.contains(0));
+      assertUnit(!pq.contains(2));
+      assertUnit(pq.contains(6));
+      assertUnit(!pq.contains(7));
+   }  // teardown
+
+   // an old handle stays dead even after its slot is reused
+   void test_contains_staleHandle()
+   {  // setup
+      custom::indexed_priority_queue <int> pq;
+      custom::indexed_priority_queue <int>::handle hOld = pq.push(1);
+      pq.pop();
+      // exercise
+      custom::indexed_priority_queue <int>::handle hNew = pq.push(2);
+      // verify
+      assertUnit(hOld != hNew);
+      assertUnit(!pq.contains(hOld));
+      assertUnit(pq.contains(hNew));
+   }  // teardown
+
+   /***************************************
+    * MIXED
+    ***************************************/
+
+   // many updates and erases on a four-child heap, then drain it
+   void test_mixed_fourAry()
+   {  // setup
+      custom::indexed_priority_queue <int, 4> pq;
+      for (int i = 0; i < 100; i++)
+         pq.push((i * 37) % 100);
+      // exercise
+      for (size_t h = 0; h < 100; h += 3)
+         pq.update(h, int((h * 53) % 101));
+      for (size_t h = 1; h < 100; h += 5)
+         pq.erase(h);
+      assertConsistent(pq);
+      bool sorted = true;
+      int previous = pq.top();
+      size_t count = 0;
+      while (!pq.empty())
+      {
+         if (previous < pq.top())
+            sorted = false;
+         previous = pq.top();
+         pq.pop();
+         count++;
+      }
+      // verify
+      assertUnit(sorted);
+      assertUnit(count == 80);
+      assertUnit(pq.handlesFree.size() == 100);
+   }  // teardown
+
+   /****************************************************************
+    * SETUP STANDARD FIXTURE
+    * Push 4, 8, 10, 7, 9, 3, 5 so handle i holds the i-th value
+    *                 10(2)
+    *           8(1)         9(4)
+    *        4(0)  3(5)   7(3)  5(6)
+    ***************************************************/
+   template <size_t Arity>
+   void setupStandardFixture(custom::indexed_priority_queue <int, Arity>& pq)
+   {
+      for (int value : {4, 8, 10, 7, 9, 3, 5})
+         pq.push(value);
+   }
+
+   /***************************************************
+    * VERIFY CONSISTENT
+    * Every parent is at least as big as its children and
+    * the position, key and slot maps all agree
+    ***************************************************/
+   template <size_t Arity>
+   void assertConsistentParameters(const custom::indexed_priority_queue <int, Arity>& pq,
+                                   int line, const char* function)
+   {
+      typedef custom::indexed_priority_queue <int, Arity> PQ;
+      size_t numQueued = 0;
+      for (size_t slot = 0; slot < pq.slots.size(); slot++)
+         if (pq.slots[slot].key != PQ::noKey)
+            numQueued++;
+      assertIndirect(numQueued == pq.heap.size());
+      assertIndirect(pq.keys.size() == pq.heap.size());
+      assertIndirect(pq.position.size() == pq.heap.size());
+      assertIndirect(pq.slotOfKey.size() == pq.heap.size());
+      assertIndirect(numQueued + pq.handlesFree.size() == pq.slots.size());
+
+      for (size_t key = 0; key < pq.keys.size(); key++)
+         assertIndirect(pq.slots[pq.slotOfKey[key]].key == key);
+
+      for (size_t indexHeap = 1; indexHeap <= pq.heap.size(); indexHeap++)
+      {
+         assertIndirect(pq.position[pq.heap[indexHeap - 1]] == indexHeap);
+         if (indexHeap > 1)
+            assertIndirect(!pq.less(PQ::parent(indexHeap), indexHeap));
+      }
+   }
+};
+
+#endif // DEBUG
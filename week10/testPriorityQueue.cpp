@@ -16,6 +16,7 @@
  //#undef DEBUG  // Remove this comment to disable unit tests
 
 #include "testPriorityQueue.h"  // for the priority queue unit tests
+#include "testIndexedPriorityQueue.h" // for the indexed priority queue unit tests
 #include "testSpy.h"            // for the spy unit tests
 #include "testVector.h"         // for the vector unit tests
 int Spy::counters[] = {};
@@ -31,6 +32,7 @@ int main()
    TestSpy().run();
    TestVector().run();
    TestPQueue().run();
+   TestIndexedPQueue().run();
 #endif // DEBUG
    
    return 0;
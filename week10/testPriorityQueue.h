@@ -62,12 +62,16 @@ public:
       test_pushMove_levelOne();
       test_pushMove_levelTwo();
       test_pushMove_levelThree();
+      test_pushMove_spyNoCopy();
+      test_emplace_spyNoCopy();
 
       // Remove
       test_pop_empty();
       test_pop_one();
       test_pop_two();
       test_pop_standard();
+      test_pop_spyNoCopy();
+      test_pop_drainSorted();
 
       // Status
       test_size_empty();
@@ -83,6 +87,12 @@ public:
       test_heapify_oneLevel();
       test_heapify_twoLevels();
 
+      // Arity
+      test_heapify_fourAry();
+      test_push_fourAry();
+      test_pop_fourAry();
+      test_pop_eightAryDrain();
+
       report("PQueue");
    }
 
@@ -710,6 +720,115 @@ public:
       pq.container.clear();
    }
 
+   /***************************************
+    * ARITY
+    ***************************************/
+
+   // heapify with four children per node
+   void test_heapify_fourAry()
+   {  // setup
+      //  +---+---+---+---+---+
+      //  | 1 | 2 | 3 | 4 | 5 |
+      //  +---+---+---+---+---+
+      custom::priority_queue <int, 4> pq;
+      pq.container = { 1, 2, 3, 4, 5 };
+      // exercise
+      pq.heapify();
+      // verify
+      //  +---+---+---+---+---+
+      //  | 5 | 2 | 3 | 4 | 1 |
+      //  +---+---+---+---+---+
+      //            5
+      //     2   3     4   1
+      assertUnit(pq.container.size() == 5);
+      if (pq.container.size() == 5)
+      {
+         assertUnit(pq.container[0] == 5);
+         assertUnit(pq.container[1] == 2);
+         assertUnit(pq.container[2] == 3);
+         assertUnit(pq.container[3] == 4);
+         assertUnit(pq.container[4] == 1);
+      }
+   }  // teardown
+
+   // push climbs past the parent of a four-child node
+   void test_push_fourAry()
+   {  // setup
+      //            5
+      //     2   3     4   1
+      custom::priority_queue <int, 4> pq;
+      pq.container = { 5, 2, 3, 4, 1 };
+      // exercise
+      pq.push(6);
+      // verify
+      //            6
+      //     5   3     4   1
+      //   2
+      assertUnit(pq.container.size() == 6);
+      if (pq.container.size() == 6)
+      {
+         assertUnit(pq.container[0] == 6);
+         assertUnit(pq.container[1] == 5);
+         assertUnit(pq.container[2] == 3);
+         assertUnit(pq.container[3] == 4);
+         assertUnit(pq.container[4] == 1);
+         assertUnit(pq.container[5] == 2);
+      }
+   }  // teardown
+
+   // pop sinks the last item into the largest of four children
+   void test_pop_fourAry()
+   {  // setup
+      //            6
+      //     5   3     4   1
+      //   2
+      custom::priority_queue <int, 4> pq;
+      pq.container = { 6, 5, 3, 4, 1, 2 };
+      // exercise
+      pq.pop();
+      // verify
+      //            5
+      //     2   3     4   1
+      assertUnit(pq.container.size() == 5);
+      if (pq.container.size() == 5)
+      {
+         assertUnit(pq.container[0] == 5);
+         assertUnit(pq.container[1] == 2);
+         assertUnit(pq.container[2] == 3);
+         assertUnit(pq.container[3] == 4);
+         assertUnit(pq.container[4] == 1);
+      }
+   }  // teardown
+
+   // popping an eight-child heap gives the items largest first
+   void test_pop_eightAryDrain()
+   {  // setup
+      custom::vector <int> v;
+      for (int i = 0; i < 200; i++)
+         v.push_back((i * 73) % 200);
+      custom::priority_queue <int, 8> pq(std::move(v));
+      pq.push(500);
+      pq.push(-1);
+      // exercise
+      bool sorted = true;
+      int first = pq.top();
+      int previous = first;
+      size_t count = 0;
+      while (!pq.empty())
+      {
+         if (previous < pq.top())
+            sorted = false;
+         previous = pq.top();
+         pq.pop();
+         count++;
+      }
+      // verify
+      assertUnit(sorted);
+      assertUnit(count == 202);
+      assertUnit(first == 500);
+      assertUnit(previous == -1);
+   }  // teardown
+
    /***************************************
     * TOP
     ***************************************/
@@ -873,6 +992,60 @@ public:
       teardownStandardFixture(pq);
    }
 
+
+   // pop moves items into the hole rather than swapping them
+   void test_pop_spyNoCopy()
+   {  // setup
+      //               10
+      //         8            9
+      //      4     3      7     5
+      custom::priority_queue <Spy> pq;
+      setupStandardFixture(pq);
+      Spy::reset();
+      // exercise
+      pq.pop();
+      // verify
+      //                9
+      //          8            7
+      //       4     3      5
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numSwap() == 0);
+      assertUnit(Spy::numCopyMove() == 1);      // lift the 5 out of the root
+      assertUnit(Spy::numAssignMove() == 4);    // 5 to the root, 9 and 7 up, 5 down
+      assertUnit(pq.container.size() == 6);
+      if (pq.container.size() == 6)
+      {
+         assertUnit(pq.container[0].get() == 9);
+         assertUnit(pq.container[1].get() == 8);
+         assertUnit(pq.container[2].get() == 7);
+         assertUnit(pq.container[3].get() == 4);
+         assertUnit(pq.container[4].get() == 3);
+         assertUnit(pq.container[5].get() == 5);
+      }
+   }  // teardown
+
+   // popping everything gives the items largest first
+   void test_pop_drainSorted()
+   {  // setup
+      custom::priority_queue <int> pq;
+      for (int i = 0; i < 100; i++)
+         pq.push((i * 37) % 100);
+      // exercise
+      bool sorted = true;
+      int previous = pq.top();
+      while (!pq.empty())
+      {
+         if (previous < pq.top())
+            sorted = false;
+         previous = pq.top();
+         pq.pop();
+      }
+      // verify
+      assertUnit(sorted);
+      assertUnit(previous == 0);
+      assertEmptyFixture(pq);
+   }  // teardown
    
 
    /***************************************
@@ -1224,6 +1397,67 @@ public:
       teardownStandardFixture(pq);
    }
 
+   // push moves smaller parents down rather than swapping them
+   void test_pushMove_spyNoCopy()
+   {  // setup
+      //               10
+      //         8            9
+      //      4     3      7     5
+      custom::priority_queue <Spy> pq;
+      setupStandardFixture(pq);
+      Spy s(11);
+      Spy::reset();
+      // exercise
+      pq.push(std::move(s));
+      // verify
+      //                11
+      //          10           9
+      //       8     3      7     5
+      //     4
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numSwap() == 0);
+      assertUnit(Spy::numCopyMove() == 2);      // 11 into the leaf, lift it out again
+      assertUnit(Spy::numAssignMove() == 4);    // 4 8 10 down, 11 up
+      assertUnit(pq.container.size() == 8);
+      if (pq.container.size() == 8)
+      {
+         assertUnit(pq.container[0].get() == 11);
+         assertUnit(pq.container[1].get() == 10);
+         assertUnit(pq.container[3].get() == 8);
+         assertUnit(pq.container[7].get() == 4);
+      }
+   }  // teardown
+
+   // emplace builds the item in the leaf rather than moving a temporary there
+   void test_emplace_spyNoCopy()
+   {  // setup
+      //               10
+      //         8            9
+      //      4     3      7     5
+      custom::priority_queue <Spy> pq;
+      setupStandardFixture(pq);
+      Spy::reset();
+      // exercise
+      pq.emplace(11);
+      // verify
+      //                11
+      //          10           9
+      //       8     3      7     5
+      //     4
+      assertUnit(Spy::numNondefault() == 1);    // 11 built in the leaf
+      assertUnit(Spy::numCopy() == 0);
+      assertUnit(Spy::numAssign() == 0);
+      assertUnit(Spy::numCopyMove() == 1);      // lift the 11 out of the leaf
+      assertUnit(Spy::numAssignMove() == 4);    // 4 8 10 down, 11 up
+      assertUnit(pq.container.size() == 8);
+      if (pq.container.size() == 8)
+      {
+         assertUnit(pq.container[0].get() == 11);
+         assertUnit(pq.container[7].get() == 4);
+      }
+   }  // teardown
+
    /***************************************************
     * SETUP STANDARD FIXTURE
     *                 10
@@ -1239,6 +1473,12 @@ public:
       pq.container = {int(10), int(8), int(9), int(4), int(3), int(7), int(5)};
       pq.container.reserve(9);
    }
+   void setupStandardFixture(custom::priority_queue <Spy>& pq)
+   {
+      pq.container.reserve(9);
+      for (int value : {10, 8, 9, 4, 3, 7, 5})
+         pq.container.push_back(Spy(value));
+   }
    
    /***************************************************
     * VERIFY EMPTY FIXTURE